@@ -35,6 +35,25 @@ math(EXPR RTTR_VERSION_CALC "${RTTR_VERSION_MAJOR}*1000 + ${RTTR_VERSION_MINOR}*
 set(RTTR_PRODUCT_NAME "RTTR")
 message("Project version: ${RTTR_VERSION_STR}")
 
+# build configuration, which is written to 'rttr/detail/base/config.h'
+if (USE_32BIT_TYPE_ID)
+  set(RTTR_USE_32BIT_TYPE_ID 1)
+else()
+  set(RTTR_USE_32BIT_TYPE_ID 0)
+endif()
+
+if (NOT VARIANT_INLINE_SIZE MATCHES "^[0-9]+$" OR VARIANT_INLINE_SIZE LESS 8)
+  message(FATAL_ERROR "VARIANT_INLINE_SIZE has to be a number greater than or equal to 8, got: '${VARIANT_INLINE_SIZE}'")
+endif()
+set(RTTR_VARIANT_INLINE_SIZE ${VARIANT_INLINE_SIZE})
+message(STATUS "variant inline storage size: ${RTTR_VARIANT_INLINE_SIZE} bytes")
+
+if (NOT ITERATOR_INLINE_SIZE MATCHES "^[0-9]+$" OR ITERATOR_INLINE_SIZE LESS 8)
+  message(FATAL_ERROR "ITERATOR_INLINE_SIZE has to be a number greater than or equal to 8, got: '${ITERATOR_INLINE_SIZE}'")
+endif()
+set(RTTR_ITERATOR_INLINE_SIZE ${ITERATOR_INLINE_SIZE})
+message(STATUS "view iterator inline storage size: ${RTTR_ITERATOR_INLINE_SIZE} bytes")
+
 # files
 set(README_FILE "${CMAKE_SOURCE_DIR}/README.md")
 set(LICENSE_FILE "${CMAKE_SOURCE_DIR}/LICENSE.txt")
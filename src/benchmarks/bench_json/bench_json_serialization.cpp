@@ -0,0 +1,574 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/io/json.h>
+#include <rttr/io/binary.h>
+#include <rttr/io/binary_document.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_LINUX
+#include <malloc.h>
+#include <cstring>
+#include <fstream>
+#endif
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct bench_record
+{
+    int                 id = 0;
+    std::string         name;
+    double              value = 0.0;
+    std::vector<int>    samples;
+};
+
+struct bench_document
+{
+    std::string                 title;
+    std::vector<bench_record>   records;
+};
+
+// a newer version of the record: 'value' was removed, 'weight' was added and the order changed
+struct bench_record_v2
+{
+    std::string         name;
+    int                 id = 0;
+    std::vector<int>    samples;
+    float               weight = 1.0f;
+};
+
+struct bench_document_v2
+{
+    std::string                     title;
+    std::vector<bench_record_v2>    records;
+};
+
+RTTR_REGISTRATION
+{
+    registration::class_<bench_record>("bench_record")
+        .constructor()(policy::ctor::as_object)
+        .property("id", &bench_record::id)
+        .property("name", &bench_record::name)
+        .property("value", &bench_record::value)
+        .property("samples", &bench_record::samples)
+        ;
+
+    registration::class_<bench_document>("bench_document")
+        .property("title", &bench_document::title)
+        .property("records", &bench_document::records)
+        ;
+
+    registration::class_<bench_record_v2>("bench_record_v2")
+        .property("name", &bench_record_v2::name)
+        .property("id", &bench_record_v2::id)
+        .property("samples", &bench_record_v2::samples)
+        .property("weight", &bench_record_v2::weight)
+        ;
+
+    registration::class_<bench_document_v2>("bench_document_v2")
+        .property("title", &bench_document_v2::title)
+        .property("records", &bench_document_v2::records)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bench_document create_document(std::size_t record_count)
+{
+    bench_document doc;
+    doc.title = "benchmark document";
+    doc.records.resize(record_count);
+    for (std::size_t i = 0; i < record_count; ++i)
+    {
+        auto& record = doc.records[i];
+        record.id = static_cast<int>(i);
+        record.name = "record #" + std::to_string(i);
+        record.value = static_cast<double>(i) * 0.25;
+        for (int k = 0; k < 16; ++k)
+            record.samples.push_back(static_cast<int>(i) * k);
+    }
+
+    return doc;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static int sum_samples(const bench_record& record)
+{
+    int sum = 0;
+    for (const auto value : record.samples)
+        sum += value;
+
+    return sum;
+}
+
+static int sum_samples_mapped(string_view data, std::size_t index)
+{
+    io::binary_document doc(data);
+    const auto samples = doc.get_root().get_field("records").get_element(index).get_field("samples").get_array<int>();
+    int sum = 0;
+    for (const auto value : samples)
+        sum += value;
+
+    return sum;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// an output stream buffer, which discards everything
+class null_buffer : public std::streambuf
+{
+    protected:
+        int_type overflow(int_type c) { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize count) { return count; }
+};
+
+// an input stream buffer, which reads directly from an existing string, without copying it
+class memory_buffer : public std::streambuf
+{
+    public:
+        memory_buffer(const std::string& text)
+        {
+            char* data = const_cast<char*>(text.data());
+            setg(data, data, data + text.size());
+        }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// the serialization of the json example before 'rttr::io' was added,
+// every property and every type is resolved again for each object
+
+static void to_json_reflection_recursively(const instance& obj, rapidjson::Writer<rapidjson::StringBuffer>& writer);
+
+static bool write_atomic_types(const type& t, const variant& var, rapidjson::Writer<rapidjson::StringBuffer>& writer)
+{
+    if (t.is_arithmetic())
+    {
+        if (t == type::get<bool>())
+            writer.Bool(var.to_bool());
+        else if (t == type::get<char>())
+            writer.Int(var.to_int8());
+        else if (t == type::get<int8_t>())
+            writer.Int(var.to_int8());
+        else if (t == type::get<int16_t>())
+            writer.Int(var.to_int16());
+        else if (t == type::get<int32_t>())
+            writer.Int(var.to_int32());
+        else if (t == type::get<int64_t>())
+            writer.Int64(var.to_int64());
+        else if (t == type::get<uint8_t>())
+            writer.Uint(var.to_uint8());
+        else if (t == type::get<uint16_t>())
+            writer.Uint(var.to_uint16());
+        else if (t == type::get<uint32_t>())
+            writer.Uint(var.to_uint32());
+        else if (t == type::get<uint64_t>())
+            writer.Uint64(var.to_uint64());
+        else if (t == type::get<float>() || t == type::get<double>())
+            writer.Double(var.to_double());
+
+        return true;
+    }
+    else if (t.is_enumeration())
+    {
+        writer.String(var.to_string().c_str());
+        return true;
+    }
+    else if (t == type::get<std::string>())
+    {
+        const auto text = var.to_string();
+        writer.String(text.data(), static_cast<rapidjson::SizeType>(text.size()));
+        return true;
+    }
+
+    return false;
+}
+
+static void write_variant_reflection(const variant& var, rapidjson::Writer<rapidjson::StringBuffer>& writer)
+{
+    const type value_type = var.get_type();
+    const bool is_wrapper = value_type.is_wrapper();
+    const type wrapped_type = is_wrapper ? value_type.get_wrapped_type() : value_type;
+
+    if (write_atomic_types(wrapped_type, is_wrapper ? var.extract_wrapped_value() : var, writer))
+    {
+    }
+    else if (var.is_sequential_container())
+    {
+        writer.StartArray();
+        for (const auto& item : var.create_sequential_view())
+            write_variant_reflection(item, writer);
+        writer.EndArray();
+    }
+    else
+    {
+        to_json_reflection_recursively(var, writer);
+    }
+}
+
+static void to_json_reflection_recursively(const instance& obj2, rapidjson::Writer<rapidjson::StringBuffer>& writer)
+{
+    writer.StartObject();
+    instance obj = obj2.get_type().get_raw_type().is_wrapper() ? obj2.get_wrapped_instance() : obj2;
+
+    for (auto prop : obj.get_derived_type().get_properties())
+    {
+        if (prop.get_metadata("NO_SERIALIZE"))
+            continue;
+
+        variant prop_value = prop.get_value(obj);
+        if (!prop_value)
+            continue;
+
+        const auto name = prop.get_name();
+        writer.Key(name.data(), static_cast<rapidjson::SizeType>(name.length()), false);
+        write_variant_reflection(prop_value, writer);
+    }
+
+    writer.EndObject();
+}
+
+static std::string to_json_reflection(const instance& obj)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    to_json_reflection_recursively(obj, writer);
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+static std::string to_json_plan(const instance& obj)
+{
+    io::json_write_options options;
+    options.pretty = false;
+    return io::to_json(obj, options);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// the DOM based deserialization, as it was done in the json example before 'rttr::io' was added
+
+static void from_json_dom_recursively(instance obj, rapidjson::Value& json_object);
+
+static variant extract_basic_types(rapidjson::Value& json_value)
+{
+    if (json_value.IsString())
+        return std::string(json_value.GetString(), json_value.GetStringLength());
+    else if (json_value.IsBool())
+        return json_value.GetBool();
+    else if (json_value.IsInt())
+        return json_value.GetInt();
+    else if (json_value.IsDouble())
+        return json_value.GetDouble();
+    else if (json_value.IsUint())
+        return json_value.GetUint();
+    else if (json_value.IsInt64())
+        return json_value.GetInt64();
+    else if (json_value.IsUint64())
+        return json_value.GetUint64();
+
+    return variant();
+}
+
+static void from_json_dom_array(variant_sequential_view& view, rapidjson::Value& json_array)
+{
+    view.set_size(json_array.Size());
+    for (rapidjson::SizeType i = 0; i < json_array.Size(); ++i)
+    {
+        auto& json_index_value = json_array[i];
+        if (json_index_value.IsArray())
+        {
+            auto sub_array_view = view.get_value(i).create_sequential_view();
+            from_json_dom_array(sub_array_view, json_index_value);
+        }
+        else if (json_index_value.IsObject())
+        {
+            variant wrapped_var = view.get_value(i).extract_wrapped_value();
+            from_json_dom_recursively(wrapped_var, json_index_value);
+            view.set_value(i, wrapped_var);
+        }
+        else
+        {
+            variant extracted_value = extract_basic_types(json_index_value);
+            if (extracted_value.convert(view.get_value_type()))
+                view.set_value(i, extracted_value);
+        }
+    }
+}
+
+static void from_json_dom_recursively(instance obj2, rapidjson::Value& json_object)
+{
+    instance obj = obj2.get_type().get_raw_type().is_wrapper() ? obj2.get_wrapped_instance() : obj2;
+    for (auto prop : obj.get_derived_type().get_properties())
+    {
+        auto ret = json_object.FindMember(prop.get_name().data());
+        if (ret == json_object.MemberEnd())
+            continue;
+
+        auto& json_value = ret->value;
+        if (json_value.IsArray())
+        {
+            variant var = prop.get_value(obj);
+            auto view = var.create_sequential_view();
+            from_json_dom_array(view, json_value);
+            prop.set_value(obj, var);
+        }
+        else if (json_value.IsObject())
+        {
+            variant var = prop.get_value(obj);
+            from_json_dom_recursively(var, json_value);
+            prop.set_value(obj, var);
+        }
+        else
+        {
+            variant extracted_value = extract_basic_types(json_value);
+            if (extracted_value.convert(prop.get_type()))
+                prop.set_value(obj, extracted_value);
+        }
+    }
+}
+
+static bool from_json_dom(std::istream& in, instance obj)
+{
+    // the complete text and the DOM have to be kept in memory
+    const std::string json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    rapidjson::Document document;
+    if (document.Parse(json.c_str()).HasParseError())
+        return false;
+
+    from_json_dom_recursively(obj, document);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_LINUX
+static long read_proc_status(const char* key)
+{
+    std::ifstream file("/proc/self/status");
+    const std::size_t key_size = std::strlen(key);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.compare(0, key_size, key) == 0)
+            return std::stol(line.substr(key_size));
+    }
+
+    return -1;
+}
+#endif
+
+/*!
+ * Returns the growth of the peak resident set size, while \p func is executed.
+ */
+template<typename F>
+static std::string get_peak_rss_growth(const F& func)
+{
+#if RTTR_PLATFORM == RTTR_PLATFORM_LINUX
+    func();         // the code and lazy initialized data becomes resident
+    malloc_trim(0); // the freed heap is returned to the system, so reusing it, increases the peak again
+
+    {
+        // resets the peak (VmHWM) to the current resident set size
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        clear_refs << "5";
+    }
+
+    const long before = read_proc_status("VmRSS:");
+    func();
+    const long after = read_proc_status("VmHWM:");
+    if (before < 0 || after < 0)
+        return "n/a";
+
+    return std::to_string(after - before) + " KiB";
+#else
+    return "n/a";
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void write_dom(const bench_document& doc, std::ostream& out)
+{
+    const std::string text = io::to_json(doc);
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+static void write_streaming(const bench_document& doc, std::ostream& out)
+{
+    io::to_json(doc, out);
+}
+
+static void read_dom(const std::string& text)
+{
+    memory_buffer buffer(text);
+    std::istream in(&buffer);
+    bench_document doc;
+    from_json_dom(in, doc);
+}
+
+static void read_streaming(const std::string& text)
+{
+    memory_buffer buffer(text);
+    std::istream in(&buffer);
+    bench_document doc;
+    io::from_json(in, doc);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_json_serialization()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::io serialization";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_json_serialization.html");
+
+    const bench_document doc = create_document(5000);
+    const std::string text = io::to_json(doc);
+
+    null_buffer sink;
+    std::ostream out(&sink);
+
+    std::stringstream write_description;
+    write_description << "Writes a document of " << text.size() / 1024 << " KiB JSON text into an output stream.<br>"
+                      << "<i>DOM</i>: the whole text is created as string and then written; "
+                      << "<i>streaming</i>: the text is written in chunks of 64 KiB.<br>"
+                      << "Growth of the peak resident set size:<pre>"
+                      << "DOM:       " << get_peak_rss_growth([&]() { write_dom(doc, out); }) << "\n"
+                      << "streaming: " << get_peak_rss_growth([&]() { write_streaming(doc, out); }) << "</pre>";
+
+    reporter.set_current_group_name("write", write_description.str());
+    nonius::benchmark benchmarks_group_1[] =
+    {
+        nonius::benchmark("DOM", [&]() { write_dom(doc, out); }),
+        nonius::benchmark("streaming", [&]() { write_streaming(doc, out); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    std::stringstream read_description;
+    read_description << "Reads a document of " << text.size() / 1024 << " KiB JSON text from an input stream.<br>"
+                     << "<i>DOM</i>: the text is read completely, parsed into a <code>rapidjson::Document</code> "
+                     << "and then assigned to the properties; "
+                     << "<i>streaming</i>: the properties are set while the tokens are parsed from chunks of 64 KiB.<br>"
+                     << "Growth of the peak resident set size:<pre>"
+                     << "DOM:       " << get_peak_rss_growth([&]() { read_dom(text); }) << "\n"
+                     << "streaming: " << get_peak_rss_growth([&]() { read_streaming(text); }) << "</pre>";
+
+    reporter.set_current_group_name("read", read_description.str());
+    nonius::benchmark benchmarks_group_2[] =
+    {
+        nonius::benchmark("DOM", [&]() { read_dom(text); }),
+        nonius::benchmark("streaming", [&]() { read_streaming(text); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.set_current_group_name("serialization plan",
+                                    "Serializes the document into a compact JSON string.<br>"
+                                    "<i>per field reflection</i>: the properties and the type of every value are retrieved "
+                                    "and compared for every object; <i>plan</i>: every type is resolved once into a list of "
+                                    "fields, which is executed for every object.");
+    nonius::benchmark benchmarks_group_3[] =
+    {
+        nonius::benchmark("per field reflection", [&]() { return to_json_reflection(doc); }),
+        nonius::benchmark("plan", [&]() { return to_json_plan(doc); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    io::json_write_options compact;
+    compact.pretty = false;
+    const std::string compact_text = io::to_json(doc, compact);
+    const std::string data = io::to_binary(doc);
+
+    std::stringstream binary_description;
+    binary_description << "Serializes the document into a string.<br>"
+                       << "<i>json</i>: compact JSON text of " << compact_text.size() / 1024 << " KiB; "
+                       << "<i>binary</i>: binary format of " << data.size() / 1024 << " KiB, integers as varints, "
+                       << "the <code>std::vector&lt;int&gt;</code> samples as one block of bytes.";
+
+    reporter.set_current_group_name("binary - encode", binary_description.str());
+    nonius::benchmark benchmarks_group_4[] =
+    {
+        nonius::benchmark("json", [&]() { return io::to_json(doc, compact); }),
+        nonius::benchmark("binary", [&]() { return io::to_binary(doc); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    reporter.set_current_group_name("binary - decode", "Deserializes the document from the strings of the encode group.");
+    nonius::benchmark benchmarks_group_5[] =
+    {
+        nonius::benchmark("json", [&]() { bench_document result; return io::from_json(compact_text, result); }),
+        nonius::benchmark("binary", [&]() { bench_document result; return io::from_binary(data, result); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
+
+    reporter.set_current_group_name("binary - schema evolution",
+                                    "Deserializes the binary data of the encode group.<br>"
+                                    "<i>same schema</i>: into the written type, the fields are read directly; "
+                                    "<i>remapped</i>: into a newer version of the record type with a removed, an added "
+                                    "and reordered fields, the fields are read by a cached remapping plan.");
+    nonius::benchmark benchmarks_group_6[] =
+    {
+        nonius::benchmark("same schema", [&]() { bench_document result; return io::from_binary(data, result); }),
+        nonius::benchmark("remapped", [&]() { bench_document_v2 result; return io::from_binary(data, result); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
+
+    const std::size_t last = doc.records.size() - 1;
+    reporter.set_current_group_name("binary - document",
+                                    "Sums the samples of one record of the binary data of the encode group.<br>"
+                                    "<i>from_binary</i>: the whole document is deserialized first; "
+                                    "<i>first record</i>, <i>last record</i>: an <code>io::binary_document</code> is opened over the data and "
+                                    "the samples of that record are accessed in place; "
+                                    "the preceding records are skipped without being deserialized.");
+    nonius::benchmark benchmarks_group_7[] =
+    {
+        nonius::benchmark("from_binary", [&]() { bench_document result; io::from_binary(data, result); return sum_samples(result.records[last]); }),
+        nonius::benchmark("first record", [&]() { return sum_samples_mapped(data, 0); }),
+        nonius::benchmark("last record", [&]() { return sum_samples_mapped(data, last); })
+    };
+    nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -25,15 +25,13 @@
 *                                                                                   *
 *************************************************************************************/
 
-#include <string>
-#include <rttr/type>
+extern void bench_json_serialization();
 
-namespace io
-{
-/*!
- * Deserialize the given json string \p json to the given instance \p obj.
- */
-bool from_json(const std::string& json, rttr::instance obj);
+/////////////////////////////////////////////////////////////////////////////////////////
 
+int main(int /* argc */, char** /* argv */)
+{
+    bench_json_serialization();
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,163 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "benchmarks/bench_method/test_methods.h"
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_rttr_find_method_member_count()
+{
+    return nonius::benchmark("get_method", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        const auto name = "method_" + std::to_string(Member_Count - 1);
+        volatile std::size_t value = 0;
+        rttr::method m = rttr::type::get(nullptr).get_method("");
+        meter.measure([&]()
+        {
+            if ((m = rttr::type::get(obj).get_method(name)))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_rttr_find_property_member_count()
+{
+    return nonius::benchmark("get_property", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        const auto name = "property_" + std::to_string(Member_Count - 1);
+        volatile std::size_t value = 0;
+        rttr::property p = rttr::type::get(nullptr).get_property("");
+        meter.measure([&]()
+        {
+            if ((p = rttr::type::get(obj).get_property(name)))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, std::size_t Member_Count>
+nonius::benchmark bench_rttr_find_method_member_count_neg()
+{
+    return nonius::benchmark("get_method (not found)", [](nonius::chronometer meter)
+    {
+        Class_Type obj;
+        volatile std::size_t value = 0;
+        rttr::method m = rttr::type::get(nullptr).get_method("");
+        meter.measure([&]()
+        {
+            if ((m = rttr::type::get(obj).get_method("unknown_method")))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_find_member()
+{
+    nonius::configuration cfg;
+    cfg.title = "find member by name";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_find_member.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("10 members", "benchmark code:"
+                                                  "<pre>"
+                                                  "// class with 10 registered methods and 10 registered properties\n"
+                                                  "rttr::type::get(obj).get_method(\"method_9\");\n"
+                                                  "rttr::type::get(obj).get_property(\"property_9\");\n"
+                                                  "rttr::type::get(obj).get_method(\"unknown_method\");\n"
+                                                  "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_rttr_find_method_member_count<ns_foo::member_count_class_10, 10>(),
+                                               bench_rttr_find_property_member_count<ns_foo::member_count_class_10, 10>(),
+                                               bench_rttr_find_method_member_count_neg<ns_foo::member_count_class_10, 10>() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("50 members", "benchmark code:"
+                                                  "<pre>"
+                                                  "// class with 50 registered methods and 50 registered properties\n"
+                                                  "rttr::type::get(obj).get_method(\"method_49\");\n"
+                                                  "rttr::type::get(obj).get_property(\"property_49\");\n"
+                                                  "rttr::type::get(obj).get_method(\"unknown_method\");\n"
+                                                  "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_rttr_find_method_member_count<ns_foo::member_count_class_50, 50>(),
+                                               bench_rttr_find_property_member_count<ns_foo::member_count_class_50, 50>(),
+                                               bench_rttr_find_method_member_count_neg<ns_foo::member_count_class_50, 50>() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("200 members", "benchmark code:"
+                                                   "<pre>"
+                                                   "// class with 200 registered methods and 200 registered properties\n"
+                                                   "rttr::type::get(obj).get_method(\"method_199\");\n"
+                                                   "rttr::type::get(obj).get_property(\"property_199\");\n"
+                                                   "rttr::type::get(obj).get_method(\"unknown_method\");\n"
+                                                   "</pre>");
+    nonius::benchmark benchmarks_group_3[] = { bench_rttr_find_method_member_count<ns_foo::member_count_class_200, 200>(),
+                                               bench_rttr_find_property_member_count<ns_foo::member_count_class_200, 200>(),
+                                               bench_rttr_find_method_member_count_neg<ns_foo::member_count_class_200, 200>() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,24 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Signature, typename... Args>
+nonius::benchmark bench_rttr_invoker(const char* name, Args... args)
+{
+    return nonius::benchmark("rttr invoker", [=](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        auto invoker = rttr::type::get(obj).get_method(name).get_invoker<Signature>();
+
+        meter.measure([&]()
+        {
+            return invoker(obj, args...);
+        });
+    });
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +252,105 @@ nonius::benchmark bench_rttr_invoke_method_arg_3()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_native_invoke_method_arg_4()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.void_method_arg_4(23, 42, 5, 7);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_arg_4()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_4");
+
+        meter.measure([&]()
+        {
+            return m.invoke(obj, 23, 42, 5, 7);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_invoke_method_arg_5()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.void_method_arg_5(23, 42, 5, 7, 11);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_arg_5()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_5");
+
+        meter.measure([&]()
+        {
+            return m.invoke(obj, 23, 42, 5, 7, 11);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_invoke_method_arg_6()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.void_method_arg_6(23, 42, 5, 7, 11, 13);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_method_arg_6()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_6");
+
+        meter.measure([&]()
+        {
+            return m.invoke(obj, 23, 42, 5, 7, 11, 13);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_native_invoke_method_arg_8()
 {
     return nonius::benchmark("native", [](nonius::chronometer meter)
@@ -322,15 +439,20 @@ void bench_invoke_method()
                                             "// Setup\n"
                                             "Foo obj;\n"
                                             "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                            "auto invoker = m.get_invoker<Signature>();\n"
                                             "// Benchmarking:\n\n"
                                             "// native approach\n"
                                             "obj.method();\n"
                                             "\n"
                                             "// rttr approach\n"
                                             "m.invoke(obj);\n"
+                                            "\n"
+                                            "// rttr invoker approach\n"
+                                            "invoker(obj);\n"
                                             "</pre>");
     nonius::benchmark benchmarks_group_1[] = { bench_native_invoke_method_void_return_value(),
-                                               bench_rttr_invoke_method_void_return_value()};
+                                               bench_rttr_invoke_method_void_return_value(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&)>("method_0")};
     // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
     auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_invoke_method_void_return_value()};
     nonius::go(cfg, dummy_benchmark);
@@ -351,15 +473,20 @@ void bench_invoke_method()
                                             "// Setup\n"
                                             "Foo obj;\n"
                                             "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                            "auto invoker = m.get_invoker<Signature>();\n"
                                             "// Benchmarking:\n\n"
                                             "// native approach\n"
                                             "obj.method();\n"
                                             "\n"
                                             "// rttr approach\n"
                                             "m.invoke(obj);\n"
+                                            "\n"
+                                            "// rttr invoker approach\n"
+                                            "invoker(obj);\n"
                                             "</pre>");
     nonius::benchmark benchmarks_group_2[] = { bench_native_invoke_method_int_return_value(),
-                                               bench_rttr_invoke_method_int_return_value()};
+                                               bench_rttr_invoke_method_int_return_value(),
+                                               bench_rttr_invoker<int(ns_foo::method_class&)>("int_method")};
 
     nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
 
@@ -378,15 +505,20 @@ void bench_invoke_method()
                                                    "// Setup\n"
                                                    "Foo obj;\n"
                                                    "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                                   "auto invoker = m.get_invoker<Signature>();\n"
                                                    "// Benchmarking:\n\n"
                                                    "// native approach\n"
                                                    "obj.method();\n"
                                                    "\n"
                                                    "// rttr approach\n"
                                                    "m.invoke(obj);\n"
+                                                   "\n"
+                                                   "// rttr invoker approach\n"
+                                                   "invoker(obj);\n"
                                                    "</pre>");
     nonius::benchmark benchmarks_group_3[] = { bench_native_invoke_method_string_return_value(),
-                                               bench_rttr_invoke_method_string_return_value()};
+                                               bench_rttr_invoke_method_string_return_value(),
+                                               bench_rttr_invoker<std::string(ns_foo::method_class&)>("string_method")};
 
     nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
 
@@ -406,15 +538,20 @@ void bench_invoke_method()
                                               "// Setup\n"
                                               "Foo obj;\n"
                                               "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
                                               "// Benchmarking:\n\n"
                                               "// native approach\n"
                                               "obj.method(42);\n"
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 42);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_4[] = { bench_native_invoke_method_arg_1(),
-                                               bench_rttr_invoke_method_arg_1()};
+                                               bench_rttr_invoke_method_arg_1(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&, int)>("void_method_arg_1", 42)};
 
     nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
 
@@ -434,15 +571,20 @@ void bench_invoke_method()
                                               "// Setup\n"
                                               "Foo obj;\n"
                                               "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
                                               "// Benchmarking:\n\n"
                                               "// native approach\n"
                                               "obj.method(42, 23);\n"
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42, 23);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 42, 23);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_5[] = { bench_native_invoke_method_arg_2(),
-                                               bench_rttr_invoke_method_arg_2()};
+                                               bench_rttr_invoke_method_arg_2(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&, int, int)>("void_method_arg_2", 42, 23)};
 
     nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
 
@@ -462,20 +604,124 @@ void bench_invoke_method()
                                               "// Setup\n"
                                               "Foo obj;\n"
                                               "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
                                               "// Benchmarking:\n\n"
                                               "// native approach\n"
                                               "obj.method(42, 23, 5);\n"
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42, 23, 5);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 42, 23, 5);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_6[] = { bench_native_invoke_method_arg_3(),
-                                               bench_rttr_invoke_method_arg_3()};
+                                               bench_rttr_invoke_method_arg_3(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&, int, int, int)>("void_method_arg_3", 42, 23, 5)};
 
     nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
 
     /////////////////////////////////////
 
+    reporter.set_current_group_name("arg 4", "benchmark code:"
+                                              "<pre>"
+                                              "// Foo.h\n"
+                                              "struct Foo {\n"
+                                              "    void method(int arg_1, int arg_2, int arg_3, int arg_4);\n"
+                                              "    int value_1; int value_2; int value_3; int value_4;\n"
+                                              "};\n"
+                                              "// Foo.cpp\n"
+                                              "void Foo::method(int arg_1, int arg_2, int arg_3, int arg_4)\n"
+                                              "{ value_1 = arg_1; value_2 = arg_2; value_3 = arg_3; value_4 = arg_4; }\n"
+                                              "\n"
+                                              "// Setup\n"
+                                              "Foo obj;\n"
+                                              "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
+                                              "// Benchmarking:\n\n"
+                                              "// native approach\n"
+                                              "obj.method(23, 42, 5, 7);\n"
+                                              "\n"
+                                              "// rttr approach\n"
+                                              "m.invoke(obj, 23, 42, 5, 7);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 23, 42, 5, 7);\n"
+                                              "</pre>");
+    nonius::benchmark benchmarks_group_7[] = { bench_native_invoke_method_arg_4(),
+                                               bench_rttr_invoke_method_arg_4(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&, int, int, int, int)>("void_method_arg_4", 23, 42, 5, 7)};
+
+    nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("arg 5", "benchmark code:"
+                                              "<pre>"
+                                              "// Foo.h\n"
+                                              "struct Foo {\n"
+                                              "    void method(int arg_1, int arg_2, int arg_3, int arg_4, int arg_5);\n"
+                                              "    int value_1; int value_2; int value_3; int value_4; int value_5;\n"
+                                              "};\n"
+                                              "// Foo.cpp\n"
+                                              "void Foo::method(int arg_1, int arg_2, int arg_3, int arg_4, int arg_5)\n"
+                                              "{ value_1 = arg_1; value_2 = arg_2; value_3 = arg_3; value_4 = arg_4; value_5 = arg_5; }\n"
+                                              "\n"
+                                              "// Setup\n"
+                                              "Foo obj;\n"
+                                              "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
+                                              "// Benchmarking:\n\n"
+                                              "// native approach\n"
+                                              "obj.method(23, 42, 5, 7, 11);\n"
+                                              "\n"
+                                              "// rttr approach\n"
+                                              "m.invoke(obj, 23, 42, 5, 7, 11);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 23, 42, 5, 7, 11);\n"
+                                              "</pre>");
+    nonius::benchmark benchmarks_group_8[] = { bench_native_invoke_method_arg_5(),
+                                               bench_rttr_invoke_method_arg_5(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&, int, int, int, int, int)>("void_method_arg_5", 23, 42, 5, 7, 11)};
+
+    nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("arg 6", "benchmark code:"
+                                              "<pre>"
+                                              "// Foo.h\n"
+                                              "struct Foo {\n"
+                                              "    void method(int arg_1, int arg_2, int arg_3, int arg_4, int arg_5, int arg_6);\n"
+                                              "    int value_1; int value_2; int value_3; int value_4; int value_5; int value_6;\n"
+                                              "};\n"
+                                              "// Foo.cpp\n"
+                                              "void Foo::method(int arg_1, int arg_2, int arg_3, int arg_4, int arg_5, int arg_6)\n"
+                                              "{ value_1 = arg_1; value_2 = arg_2; value_3 = arg_3; value_4 = arg_4; value_5 = arg_5; value_6 = arg_6; }\n"
+                                              "\n"
+                                              "// Setup\n"
+                                              "Foo obj;\n"
+                                              "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
+                                              "// Benchmarking:\n\n"
+                                              "// native approach\n"
+                                              "obj.method(23, 42, 5, 7, 11, 13);\n"
+                                              "\n"
+                                              "// rttr approach\n"
+                                              "m.invoke(obj, 23, 42, 5, 7, 11, 13);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 23, 42, 5, 7, 11, 13);\n"
+                                              "</pre>");
+    nonius::benchmark benchmarks_group_9[] = { bench_native_invoke_method_arg_6(),
+                                               bench_rttr_invoke_method_arg_6(),
+                                               bench_rttr_invoker<void(ns_foo::method_class&, int, int, int, int, int, int)>("void_method_arg_6", 23, 42, 5, 7, 11, 13)};
+
+    nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
+
+    /////////////////////////////////////
+
     reporter.set_current_group_name("arg 8", "benchmark code:"
                                               "<pre>"
                                               "// Foo.h\n"
@@ -494,6 +740,7 @@ void bench_invoke_method()
                                               "// Setup\n"
                                               "Foo obj;\n"
                                               "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                              "auto invoker = m.get_invoker<Signature>();\n"
                                               "std::vector<argument> args = {1, 2, 3, 4, 5, 6, 7, 8}\n"
                                               "// Benchmarking:\n\n"
                                               "// native approach\n"
@@ -501,11 +748,15 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke_variadic(obj, args);\n"
+                                              "\n"
+                                              "// rttr invoker approach\n"
+                                              "invoker(obj, 1, 2, 3, 4, 5, 6, 7, 8);\n"
                                               "</pre>");
-    nonius::benchmark benchmarks_group_7[] = { bench_native_invoke_method_arg_8(),
-                                               bench_rttr_invoke_method_arg_8()};
+    nonius::benchmark benchmarks_group_10[] = { bench_native_invoke_method_arg_8(),
+                                                bench_rttr_invoke_method_arg_8(),
+                                                bench_rttr_invoker<void(ns_foo::method_class&, int, int, int, int, int, int, int, int)>("void_method_arg_8", 1, 2, 3, 4, 5, 6, 7, 8)};
 
-    nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
 
 
     /////////////////////////////////////
@@ -522,18 +773,23 @@ void bench_invoke_method()
                                                 "// Setup\n"
                                                 "Foo obj;\n"
                                                 "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                                "auto invoker = m.get_invoker<Signature>();\n"
                                                 "// Benchmarking:\n\n"
                                                 "// native approach\n"
                                                 "obj.method(nullptr);\n"
                                                 "\n"
                                                 "// rttr approach\n"
                                                 "m.invoke(obj, nullptr);\n"
+                                                "\n"
+                                                "// rttr invoker approach\n"
+                                                "invoker(obj, nullptr);\n"
                                                 "</pre>");
-    nonius::benchmark benchmarks_group_8[] = { bench_native_invoke_method_ptr_arg(),
-                                               bench_rttr_invoke_method_ptr_arg()};
+    nonius::benchmark benchmarks_group_11[] = { bench_native_invoke_method_ptr_arg(),
+                                                bench_rttr_invoke_method_ptr_arg(),
+                                                bench_rttr_invoker<void(ns_foo::method_class&, int*)>("method_ptr_arg", static_cast<int*>(nullptr))};
 
     nonius::go(cfg, dummy_benchmark);
-    nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
 
     /////////////////////////////////////
 
@@ -32,5 +32,7 @@ set(HEADER_FILES version.rc.in
 set(SOURCE_FILES main.cpp
                  bench_method.cpp
                  bench_find_method.cpp
+                 bench_find_member.cpp
+                 bench_property_access.cpp
                  bench_invoke_method.cpp
                  test_methods.cpp)
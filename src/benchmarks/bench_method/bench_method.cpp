@@ -33,12 +33,16 @@
 #include <nonius/html_group_reporter.h>
 
 extern void bench_find_method();
+extern void bench_find_member();
+extern void bench_property_access();
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 void bench_method()
 {
     bench_find_method();
+    bench_find_member();
+    bench_property_access();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,250 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct property_access_class
+{
+    int         int_value = 42;
+    std::string string_value = "a string, which is too long for the small string optimization";
+
+    const std::string& get_name() const { return name; }
+    void set_name(const std::string& value) { name = value; }
+
+    std::string name = "another string, which is too long for the small string optimization";
+};
+
+RTTR_REGISTRATION
+{
+    rttr::registration::class_<property_access_class>("property_access_class")
+        .property("int_value", &property_access_class::int_value)
+        .property("string_value", &property_access_class::string_value)
+        .property("name", &property_access_class::get_name, &property_access_class::set_name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_raw_get_member(T property_access_class::* member)
+{
+    return nonius::benchmark("raw member", [member](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        meter.measure([&]()
+        {
+            return (obj.*member);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_raw_get_name()
+{
+    return nonius::benchmark("raw getter", [](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        meter.measure([&]()
+        {
+            return obj.get_name();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_get_value(const char* name)
+{
+    return nonius::benchmark("rttr::property::get_value", [name](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        rttr::property prop = rttr::type::get<property_access_class>().get_property(name);
+        meter.measure([&]()
+        {
+            return prop.get_value(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_rttr_accessor_get_value(const char* name)
+{
+    return nonius::benchmark("rttr::typed_property_accessor::get_value", [name](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        auto accessor = rttr::type::get<property_access_class>().get_property(name).get_accessor<property_access_class, T>();
+        meter.measure([&]()
+        {
+            return accessor.get_value(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_raw_set_member(T property_access_class::* member, T value)
+{
+    return nonius::benchmark("raw member", [member, value](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        meter.measure([&]()
+        {
+            (obj.*member) = value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_rttr_property_set_value(const char* name, T value)
+{
+    return nonius::benchmark("rttr::property::set_value", [name, value](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        rttr::property prop = rttr::type::get<property_access_class>().get_property(name);
+        meter.measure([&]()
+        {
+            return prop.set_value(obj, value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_rttr_accessor_set_value(const char* name, T value)
+{
+    return nonius::benchmark("rttr::typed_property_accessor::set_value", [name, value](nonius::chronometer meter)
+    {
+        property_access_class obj;
+        auto accessor = rttr::type::get<property_access_class>().get_property(name).get_accessor<property_access_class, T>();
+        meter.measure([&]()
+        {
+            return accessor.set_value(obj, value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_access()
+{
+    nonius::configuration cfg;
+    cfg.title = "property access";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_access.html");
+
+    const std::string new_string = "a new string, which is too long for the small string optimization";
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get int", "benchmark code:"
+                                               "<pre>"
+                                               "obj.int_value;\n"
+                                               "prop.get_value(obj);\n"
+                                               "accessor.get_value(obj);\n"
+                                               "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_raw_get_member(&property_access_class::int_value),
+                                               bench_rttr_property_get_value("int_value"),
+                                               bench_rttr_accessor_get_value<int>("int_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get std::string", "benchmark code:"
+                                                       "<pre>"
+                                                       "obj.string_value;\n"
+                                                       "prop.get_value(obj);\n"
+                                                       "accessor.get_value(obj);\n"
+                                                       "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_raw_get_member(&property_access_class::string_value),
+                                               bench_rttr_property_get_value("string_value"),
+                                               bench_rttr_accessor_get_value<std::string>("string_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get std::string via getter", "benchmark code:"
+                                                                  "<pre>"
+                                                                  "obj.get_name();\n"
+                                                                  "prop.get_value(obj);\n"
+                                                                  "accessor.get_value(obj);\n"
+                                                                  "</pre>");
+    nonius::benchmark benchmarks_group_3[] = { bench_raw_get_name(),
+                                               bench_rttr_property_get_value("name"),
+                                               bench_rttr_accessor_get_value<std::string>("name") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set int", "benchmark code:"
+                                               "<pre>"
+                                               "obj.int_value = 23;\n"
+                                               "prop.set_value(obj, 23);\n"
+                                               "accessor.set_value(obj, 23);\n"
+                                               "</pre>");
+    nonius::benchmark benchmarks_group_4[] = { bench_raw_set_member(&property_access_class::int_value, 23),
+                                               bench_rttr_property_set_value("int_value", 23),
+                                               bench_rttr_accessor_set_value("int_value", 23) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set std::string", "benchmark code:"
+                                                       "<pre>"
+                                                       "obj.string_value = str;\n"
+                                                       "prop.set_value(obj, str);\n"
+                                                       "accessor.set_value(obj, str);\n"
+                                                       "</pre>");
+    nonius::benchmark benchmarks_group_5[] = { bench_raw_set_member(&property_access_class::string_value, new_string),
+                                               bench_rttr_property_set_value("string_value", new_string),
+                                               bench_rttr_accessor_set_value("string_value", new_string) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
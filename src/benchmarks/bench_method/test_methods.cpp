@@ -29,6 +29,33 @@
 
 #include <rttr/registration>
 
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename class_type>
+static void register_member_count_class(rttr::string_view class_name, std::size_t member_count)
+{
+    using namespace rttr;
+
+    // the registration stores only a view to the name, so the strings have to be kept alive
+    static std::vector<std::string> method_names;
+    static std::vector<std::string> property_names;
+    for (std::size_t i = 0; i < member_count; ++i)
+    {
+        method_names.push_back("method_" + std::to_string(i));
+        property_names.push_back("property_" + std::to_string(i));
+    }
+
+    registration::class_<class_type> c(class_name);
+    for (const auto& name : method_names)
+        c.method(name, &class_type::method);
+
+    for (const auto& name : property_names)
+        c.property(name, &class_type::value);
+}
+
 
 RTTR_REGISTRATION
 {
@@ -44,6 +71,9 @@ RTTR_REGISTRATION
         .method("void_method_arg_1",    &ns_foo::method_class::void_method_arg_1)
         .method("void_method_arg_2",    &ns_foo::method_class::void_method_arg_2)
         .method("void_method_arg_3",    &ns_foo::method_class::void_method_arg_3)
+        .method("void_method_arg_4",    &ns_foo::method_class::void_method_arg_4)
+        .method("void_method_arg_5",    &ns_foo::method_class::void_method_arg_5)
+        .method("void_method_arg_6",    &ns_foo::method_class::void_method_arg_6)
         .method("void_method_arg_8",    &ns_foo::method_class::void_method_arg_8)
         .method("method_ptr_arg",       &ns_foo::method_class::method_ptr_arg)
         ;
@@ -83,6 +113,9 @@ RTTR_REGISTRATION
     CLASS_REGISTER(class_multiple_final, 18)
     CLASS_REGISTER(class_multiple_final_D, 19)
 
+    register_member_count_class<ns_foo::member_count_class_10>("ns_foo::member_count_class_10", 10);
+    register_member_count_class<ns_foo::member_count_class_50>("ns_foo::member_count_class_50", 50);
+    register_member_count_class<ns_foo::member_count_class_200>("ns_foo::member_count_class_200", 200);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +197,40 @@ void method_class::void_method_arg_3(int arg_1, int arg_2, int arg_3)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void method_class::void_method_arg_4(int arg_1, int arg_2, int arg_3, int arg_4)
+{
+    value_1 = arg_1;
+    value_2 = arg_2;
+    value_3 = arg_3;
+    value_4 = arg_4;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class::void_method_arg_5(int arg_1, int arg_2, int arg_3, int arg_4, int arg_5)
+{
+    value_1 = arg_1;
+    value_2 = arg_2;
+    value_3 = arg_3;
+    value_4 = arg_4;
+    value_5 = arg_5;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void method_class::void_method_arg_6(int arg_1, int arg_2, int arg_3,
+                                     int arg_4, int arg_5, int arg_6)
+{
+    value_1 = arg_1;
+    value_2 = arg_2;
+    value_3 = arg_3;
+    value_4 = arg_4;
+    value_5 = arg_5;
+    value_6 = arg_6;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void method_class::void_method_arg_8(int arg_1, int arg_2, int arg_3,
                                      int arg_4, int arg_5, int arg_6,
                                      int arg_7, int arg_8)
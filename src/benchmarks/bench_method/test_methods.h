@@ -57,6 +57,10 @@ struct method_class
     void void_method_arg_1(int arg_1);
     void void_method_arg_2(int arg_1, int arg_2);
     void void_method_arg_3(int arg_1, int arg_2, int arg_3);
+    void void_method_arg_4(int arg_1, int arg_2, int arg_3, int arg_4);
+    void void_method_arg_5(int arg_1, int arg_2, int arg_3, int arg_4, int arg_5);
+    void void_method_arg_6(int arg_1, int arg_2, int arg_3,
+                           int arg_4, int arg_5, int arg_6);
     void void_method_arg_8(int arg_1, int arg_2, int arg_3,
                            int arg_4, int arg_5, int arg_6,
                            int arg_7, int arg_8);
@@ -165,6 +169,16 @@ struct class_multiple_final_D : class_multiple_final
     RTTR_ENABLE(class_multiple_final)
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Every registered method/property of these classes is bound to the same member, only the name differs;
+// it is used to measure the lookup time by name in relation to the member count.
+#define MEMBER_COUNT_CLASS(MEMBER_COUNT) struct RTTR_CAT(member_count_class_, MEMBER_COUNT) { void method() { } int value = 0; };
+
+MEMBER_COUNT_CLASS(10)
+MEMBER_COUNT_CLASS(50)
+MEMBER_COUNT_CLASS(200)
+
 } // end namespace ns_foo
 
 #define CLASS_REGISTER(CLASS_NAME, NUMBER) \
@@ -212,6 +212,22 @@ bench_data<ClassMultiple6A> setup_cross_cast_class_hierachy_2()
 }
 
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T1, typename T2>
+bench_data<ClassDeepBase> setup_deep_level()
+{
+    std::vector<std::shared_ptr<ClassDeepBase> > vec;
+    vec.reserve(ITEM_COUNT * 2);
+    for (int i = 0; i < ITEM_COUNT; ++i)
+    {
+        vec.push_back(std::make_shared<T1>());
+        vec.push_back(std::make_shared<T2>());
+    }
+
+    return bench_data<ClassDeepBase>{std::move(vec)};
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -861,6 +877,93 @@ nonius::benchmark bench_level_6_type()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T1, typename T2>
+nonius::benchmark bench_deep_level_dynamic_cast()
+{
+    return nonius::benchmark("dynamic_cast", [](nonius::chronometer meter)
+    {
+        const auto bench_data = setup_deep_level<T1, T2>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (dynamic_cast<T1*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+                else if (dynamic_cast<T2*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T1, typename T2>
+nonius::benchmark bench_deep_level_rttr_cast()
+{
+    return nonius::benchmark("rttr_cast", [](nonius::chronometer meter)
+    {
+        const auto bench_data = setup_deep_level<T1, T2>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                if (rttr_cast<T1*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+                else if (rttr_cast<T2*>(bench_data.m_vec[i].get()))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T1, typename T2>
+nonius::benchmark bench_deep_level_is_derived_from()
+{
+    return nonius::benchmark("type::is_derived_from", [](nonius::chronometer meter)
+    {
+        const auto bench_data = setup_deep_level<T1, T2>();
+        const type base_type_1 = type::get<ClassDeep1A>();
+        const type base_type_2 = type::get<ClassDeep1B>();
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < bench_data.m_vec.size(); ++i)
+            {
+                const type t = type::get(*bench_data.m_vec[i].get());
+                if (t.is_derived_from(base_type_1))
+                {
+                    value += 1;
+                }
+                else if (t.is_derived_from(base_type_2))
+                {
+                    value += 1;
+                }
+            }
+
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -916,6 +1019,26 @@ void start_rttr_cast_benchmark()
     nonius::benchmark benchmarks_group_9[] = { bench_cross_cast_dynamic_cast_2(), bench_cross_cast_rttr_cast_2() };
     nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
 
+    ///////////////////////////////////////////////////////////////////////////////
+
+    reporter.set_current_group_name("downcast to level 10", "A cast from the base class ten hierarchy levels down.");
+    nonius::benchmark benchmarks_group_10[] = { bench_deep_level_dynamic_cast<ClassDeep10A, ClassDeep10B>(),
+                                                bench_deep_level_rttr_cast<ClassDeep10A, ClassDeep10B>() };
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
+
+    reporter.set_current_group_name("downcast to level 20", "A cast from the base class twenty hierarchy levels down.");
+    nonius::benchmark benchmarks_group_11[] = { bench_deep_level_dynamic_cast<ClassDeep20A, ClassDeep20B>(),
+                                                bench_deep_level_rttr_cast<ClassDeep20A, ClassDeep20B>() };
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
+
+    reporter.set_current_group_name("is_derived_from level 10", "Checks whether the most derived type (ten hierarchy levels down)<br>is derived from the first class of the hierarchy.");
+    nonius::benchmark benchmarks_group_12[] = { bench_deep_level_is_derived_from<ClassDeep10A, ClassDeep10B>() };
+    nonius::go(cfg, std::begin(benchmarks_group_12), std::end(benchmarks_group_12), reporter);
+
+    reporter.set_current_group_name("is_derived_from level 20", "Checks whether the most derived type (twenty hierarchy levels down)<br>is derived from the first class of the hierarchy.");
+    nonius::benchmark benchmarks_group_13[] = { bench_deep_level_is_derived_from<ClassDeep20A, ClassDeep20B>() };
+    nonius::go(cfg, std::begin(benchmarks_group_13), std::end(benchmarks_group_13), reporter);
+
     reporter.generate_report();
 }
 
@@ -165,6 +165,55 @@ CLASS_INHERIT(ClassDiamondRight6, ClassDiamondRight5)
 
 CLASS_MULTI_INHERIT_3(ClassDiamondFinal, ClassDiamondLeft5, ClassDiamondMiddle5, ClassDiamondRight5)
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// The following class structures has 21 hierarchy levels and is 2 classes wide;
+// only single inheritance, used to measure the costs of deep class hierarchies
+/////////////////////////////////////////////////////////////////////////////////////////
+
+CLASS(ClassDeepBase)
+
+CLASS_INHERIT(ClassDeep1A, ClassDeepBase)
+CLASS_INHERIT(ClassDeep2A, ClassDeep1A)
+CLASS_INHERIT(ClassDeep3A, ClassDeep2A)
+CLASS_INHERIT(ClassDeep4A, ClassDeep3A)
+CLASS_INHERIT(ClassDeep5A, ClassDeep4A)
+CLASS_INHERIT(ClassDeep6A, ClassDeep5A)
+CLASS_INHERIT(ClassDeep7A, ClassDeep6A)
+CLASS_INHERIT(ClassDeep8A, ClassDeep7A)
+CLASS_INHERIT(ClassDeep9A, ClassDeep8A)
+CLASS_INHERIT(ClassDeep10A, ClassDeep9A)
+CLASS_INHERIT(ClassDeep11A, ClassDeep10A)
+CLASS_INHERIT(ClassDeep12A, ClassDeep11A)
+CLASS_INHERIT(ClassDeep13A, ClassDeep12A)
+CLASS_INHERIT(ClassDeep14A, ClassDeep13A)
+CLASS_INHERIT(ClassDeep15A, ClassDeep14A)
+CLASS_INHERIT(ClassDeep16A, ClassDeep15A)
+CLASS_INHERIT(ClassDeep17A, ClassDeep16A)
+CLASS_INHERIT(ClassDeep18A, ClassDeep17A)
+CLASS_INHERIT(ClassDeep19A, ClassDeep18A)
+CLASS_INHERIT(ClassDeep20A, ClassDeep19A)
+
+CLASS_INHERIT(ClassDeep1B, ClassDeepBase)
+CLASS_INHERIT(ClassDeep2B, ClassDeep1B)
+CLASS_INHERIT(ClassDeep3B, ClassDeep2B)
+CLASS_INHERIT(ClassDeep4B, ClassDeep3B)
+CLASS_INHERIT(ClassDeep5B, ClassDeep4B)
+CLASS_INHERIT(ClassDeep6B, ClassDeep5B)
+CLASS_INHERIT(ClassDeep7B, ClassDeep6B)
+CLASS_INHERIT(ClassDeep8B, ClassDeep7B)
+CLASS_INHERIT(ClassDeep9B, ClassDeep8B)
+CLASS_INHERIT(ClassDeep10B, ClassDeep9B)
+CLASS_INHERIT(ClassDeep11B, ClassDeep10B)
+CLASS_INHERIT(ClassDeep12B, ClassDeep11B)
+CLASS_INHERIT(ClassDeep13B, ClassDeep12B)
+CLASS_INHERIT(ClassDeep14B, ClassDeep13B)
+CLASS_INHERIT(ClassDeep15B, ClassDeep14B)
+CLASS_INHERIT(ClassDeep16B, ClassDeep15B)
+CLASS_INHERIT(ClassDeep17B, ClassDeep16B)
+CLASS_INHERIT(ClassDeep18B, ClassDeep17B)
+CLASS_INHERIT(ClassDeep19B, ClassDeep18B)
+CLASS_INHERIT(ClassDeep20B, ClassDeep19B)
+
 #if RTTR_COMPILER == RTTR_COMPILER_CLANG
 #   pragma GCC diagnostic pop
 #endif
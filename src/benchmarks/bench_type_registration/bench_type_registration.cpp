@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/type>
+#include <rttr/detail/misc/flat_map.h>
+#include <rttr/detail/misc/concurrent_string_map.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::vector<std::string>& get_synthetic_type_names(std::size_t count)
+{
+    static std::vector<std::string> name_list;
+    for (auto i = name_list.size(); i < count; ++i)
+        name_list.push_back("my_namespace::synthetic_type<" + std::to_string(i) + ">");
+
+    return name_list;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// This is what happens for the original name during the registration of a new type: a lookup, followed by an insertion
+nonius::benchmark bench_orig_name_registration(std::size_t type_count)
+{
+    return nonius::benchmark(std::to_string(type_count) + " types", [type_count](nonius::chronometer meter)
+    {
+        const auto& name_list = get_synthetic_type_names(type_count);
+        meter.measure([&]()
+        {
+            detail::flat_map<string_view, std::size_t> name_to_id;
+            for (std::size_t i = 0; i < type_count; ++i)
+            {
+                const string_view name = name_list[i];
+                if (name_to_id.find(name) == name_to_id.end())
+                    name_to_id.insert(std::make_pair(name, i));
+            }
+            return name_to_id.value_data().size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// This is what happens for the custom name during the registration of a new type
+nonius::benchmark bench_custom_name_registration(std::size_t type_count)
+{
+    return nonius::benchmark(std::to_string(type_count) + " types", [type_count](nonius::chronometer meter)
+    {
+        const auto& name_list = get_synthetic_type_names(type_count);
+        meter.measure([&]()
+        {
+            detail::concurrent_string_map<std::size_t> name_to_id;
+            for (std::size_t i = 0; i < type_count; ++i)
+                name_to_id.insert(name_list[i], i);
+
+            return name_to_id.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// The lookup by name, after all types were registered
+nonius::benchmark bench_orig_name_lookup(std::size_t type_count)
+{
+    return nonius::benchmark(std::to_string(type_count) + " types", [type_count](nonius::chronometer meter)
+    {
+        const auto& name_list = get_synthetic_type_names(type_count);
+        detail::flat_map<string_view, std::size_t> name_to_id;
+        for (std::size_t i = 0; i < type_count; ++i)
+            name_to_id.insert(std::make_pair(string_view(name_list[i]), i));
+
+        meter.measure([&](int i)
+        {
+            return name_to_id.find(string_view(name_list[static_cast<std::size_t>(i) % type_count])) != name_to_id.end();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_type_registration()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr type registration";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_type_registration.html");
+
+    reporter.set_current_group_name("orig name registration",
+                                    "Registers the original names of N synthetic types, like it is done during the startup of a process.");
+    nonius::benchmark benchmarks_group_1[] = { bench_orig_name_registration(1000),
+                                               bench_orig_name_registration(10000),
+                                               bench_orig_name_registration(40000) };
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.set_current_group_name("custom name registration",
+                                    "Registers the custom names of N synthetic types, like it is done during the startup of a process.");
+    nonius::benchmark benchmarks_group_2[] = { bench_custom_name_registration(1000),
+                                               bench_custom_name_registration(10000),
+                                               bench_custom_name_registration(40000) };
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.set_current_group_name("name lookup", "Looks up one of the registered names.");
+    nonius::benchmark benchmarks_group_3[] = { bench_orig_name_lookup(1000),
+                                               bench_orig_name_lookup(10000),
+                                               bench_orig_name_lookup(40000) };
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -25,16 +25,14 @@
 *                                                                                   *
 *************************************************************************************/
 
-#include <string>
-#include <rttr/type>
 
-namespace io
-{
+extern void bench_type_registration();
 
-/*!
- * Serialize the given instance to a json encoded string.
- */
-std::string to_json(rttr::instance obj);
+/////////////////////////////////////////////////////////////////////////////////////////
 
+int main(int /* argc */, char** /* argv */)
+{
+    bench_type_registration();
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_variant/allocation_counter.h"
+
+#include <rttr/detail/base/core_prerequisites.h>
+
+#include <cstdlib>
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::atomic<std::size_t> g_allocation_count(0);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* operator new(std::size_t size)
+{
+    ++g_allocation_count;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void operator delete(void* ptr) RTTR_NOEXCEPT
+{
+    std::free(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void operator delete(void* ptr, std::size_t) RTTR_NOEXCEPT
+{
+    std::free(ptr);
+}
@@ -25,8 +25,14 @@
 #                                                                                  #
 ####################################################################################
 
-set(HEADER_FILES version.rc.in)
+set(HEADER_FILES version.rc.in
+                 allocation_counter.h)
 
 set(SOURCE_FILES main.cpp
+                 allocation_counter.cpp
+                 bench_variant_access.cpp
                  bench_variant_conversion.cpp
-                 bench_variant_create.cpp)
+                 bench_variant_create.cpp
+                 bench_variant_inline_size.cpp
+                 bench_variant_memory_resource.cpp
+                 bench_variant_view_iteration.cpp)
@@ -0,0 +1,154 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/variant.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+#include <vector>
+
+struct MyBigCustomType
+{
+    double      m_data[8];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::vector<rttr::variant> create_variant_list(std::size_t count, const T& value)
+{
+    return std::vector<rttr::variant>(count, rttr::variant(value));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_variant_get_type(const char* name, const T& value)
+{
+    return nonius::benchmark(name, [value](nonius::chronometer meter)
+    {
+        auto vec = create_variant_list(meter.runs(), value);
+        meter.measure([&](int i)
+        {
+            return vec[i].get_type();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_variant_get_value(const char* name, const T& value)
+{
+    return nonius::benchmark(name, [value](nonius::chronometer meter)
+    {
+        auto vec = create_variant_list(meter.runs(), value);
+        meter.measure([&](int i)
+        {
+            return &vec[i].template get_value<T>();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_variant_is_valid(const char* name, const T& value)
+{
+    return nonius::benchmark(name, [value](nonius::chronometer meter)
+    {
+        auto vec = create_variant_list(meter.runs(), value);
+        meter.measure([&](int i)
+        {
+            return vec[i].is_valid();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_variant_copy(const char* name, const T& value)
+{
+    return nonius::benchmark(name, [value](nonius::chronometer meter)
+    {
+        const rttr::variant var = value;
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i)
+        {
+            vec[i].construct(var);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_access()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant access";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_access.html");
+
+    const std::string text = "hello world";
+    const MyBigCustomType big_obj = {};
+
+    reporter.set_current_group_name("get_type", "Retrieve the type of the contained value with <code>rttr::variant::get_type()</code>.");
+    nonius::benchmark benchmarks_group_1[] = { bench_variant_get_type("int", 42),
+                                               bench_variant_get_type("double", 42.0),
+                                               bench_variant_get_type("std::string", text),
+                                               bench_variant_get_type("big custom", big_obj) };
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.set_current_group_name("get_value", "Access the contained value with <code>rttr::variant::get_value<T>()</code>.");
+    nonius::benchmark benchmarks_group_2[] = { bench_variant_get_value("int", 42),
+                                               bench_variant_get_value("double", 42.0),
+                                               bench_variant_get_value("std::string", text),
+                                               bench_variant_get_value("big custom", big_obj) };
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.set_current_group_name("is_valid", "Check whether a value is contained with <code>rttr::variant::is_valid()</code>.");
+    nonius::benchmark benchmarks_group_3[] = { bench_variant_is_valid("int", 42),
+                                               bench_variant_is_valid("std::string", text) };
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    reporter.set_current_group_name("copy", "The copy construction of a <code>rttr::variant</code>.");
+    nonius::benchmark benchmarks_group_4[] = { bench_variant_copy("int", 42),
+                                               bench_variant_copy("std::string", text),
+                                               bench_variant_copy("big custom", big_obj) };
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +91,13 @@ static std::string setup_string_bool()
     return std::string("1");
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string setup_string_invalid()
+{
+    return std::string("abc123");
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +167,45 @@ nonius::benchmark bench_variant_string_to_int()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_native_string_to_int_invalid()
+{
+    return nonius::benchmark("native (invalid)", [](nonius::chronometer meter)
+    {
+        std::string number_string = setup_string_invalid();
+        int result = 0;
+        meter.measure([&]()
+        {
+            try
+            {
+                std::size_t pos = 0;
+                result = std::stoi(number_string, &pos);
+            }
+            catch (...)
+            {
+                result = 0;
+            }
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_string_to_int_invalid()
+{
+    return nonius::benchmark("rttr::variant (invalid)", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_string_invalid();
+        int result = 0;
+        bool ok = false;
+        meter.measure([&]()
+        {
+            result = var.to_int(&ok);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_native_float_to_string()
 {
     return nonius::benchmark("native", [](nonius::chronometer meter)
@@ -224,6 +270,45 @@ nonius::benchmark bench_variant_string_to_float()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_native_string_to_float_invalid()
+{
+    return nonius::benchmark("native (invalid)", [](nonius::chronometer meter)
+    {
+        std::string number_string = setup_string_invalid();
+        float result = 0;
+        meter.measure([&]()
+        {
+            try
+            {
+                std::size_t pos = 0;
+                result = std::stof(number_string, &pos);
+            }
+            catch (...)
+            {
+                result = 0;
+            }
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_string_to_float_invalid()
+{
+    return nonius::benchmark("rttr::variant (invalid)", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_string_invalid();
+        float result = 0;
+        bool ok = false;
+        meter.measure([&]()
+        {
+            result = var.to_float(&ok);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_native_double_to_string()
 {
     return nonius::benchmark("native", [](nonius::chronometer meter)
@@ -288,6 +373,45 @@ nonius::benchmark bench_variant_string_to_double()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_native_string_to_double_invalid()
+{
+    return nonius::benchmark("native (invalid)", [](nonius::chronometer meter)
+    {
+        std::string number_string = setup_string_invalid();
+        double result = 0;
+        meter.measure([&]()
+        {
+            try
+            {
+                std::size_t pos = 0;
+                result = std::stod(number_string, &pos);
+            }
+            catch (...)
+            {
+                result = 0;
+            }
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_string_to_double_invalid()
+{
+    return nonius::benchmark("rttr::variant (invalid)", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_string_invalid();
+        double result = 0;
+        bool ok = false;
+        meter.measure([&]()
+        {
+            result = var.to_double(&ok);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_native_bool_to_string()
 {
     return nonius::benchmark("native", [](nonius::chronometer meter)
@@ -381,27 +505,31 @@ void bench_variant_conversion()
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("string to int", "Converts a <code>std::string</code> to an integer:<br><pre>rttr::variant var = std::string(\"12345\");\nvar.to_int()</pre>");
+    reporter.set_current_group_name("string to int", "Converts a <code>std::string</code> to an integer:<br><pre>rttr::variant var = std::string(\"12345\");\nvar.to_int()</pre> The invalid text <code>\"abc123\"</code> is converted as well.");
 
     nonius::benchmark benchmarks_group_2[] = { bench_native_string_to_int(),
-                                               bench_variant_string_to_int()
+                                               bench_variant_string_to_int(),
+                                               bench_native_string_to_int_invalid(),
+                                               bench_variant_string_to_int_invalid()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("float to string", "Converts a floating point number to a <code>std::string</code>:<br><pre>rttr::variant var = 123.12345f;\nvar.to_string();</pre>");
+    reporter.set_current_group_name("string to float", "Converts a <code>std::string</code> to a floating point number:<br><pre>rttr::variant var = std::string(\"123.12345\");\nvar.to_float();</pre> The invalid text <code>\"abc123\"</code> is converted as well.");
 
     nonius::benchmark benchmarks_group_3[] = { bench_native_string_to_float(),
-                                               bench_variant_string_to_float()
+                                               bench_variant_string_to_float(),
+                                               bench_native_string_to_float_invalid(),
+                                               bench_variant_string_to_float_invalid()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("string to float", "Converts a <code>std::string</code> to a floating point number:<br><pre>rttr::variant var = std::string(\"123.12345\");\nvar.to_float().");
+    reporter.set_current_group_name("float to string", "Converts a floating point number to a <code>std::string</code>:<br><pre>rttr::variant var = 123.12345f;\nvar.to_string();</pre>");
 
     nonius::benchmark benchmarks_group_4[] = { bench_native_float_to_string(),
                                                bench_variant_float_to_string()
@@ -411,17 +539,19 @@ void bench_variant_conversion()
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("double to string", "Converts a double number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
+    reporter.set_current_group_name("string to double", "Converts a <code>std::string</code> to a double number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_double();</pre> The invalid text <code>\"abc123\"</code> is converted as well.");
 
     nonius::benchmark benchmarks_group_5[] = { bench_native_string_to_double(),
-                                               bench_variant_string_to_double()
+                                               bench_variant_string_to_double(),
+                                               bench_native_string_to_double_invalid(),
+                                               bench_variant_string_to_double_invalid()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("string to double", "Converts a <code>std::string</code> to a double number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_double();</pre>");
+    reporter.set_current_group_name("double to string", "Converts a double number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
 
     nonius::benchmark benchmarks_group_6[] = { bench_native_double_to_string(),
                                                bench_variant_double_to_string()
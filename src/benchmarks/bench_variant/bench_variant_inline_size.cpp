@@ -0,0 +1,115 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_variant/allocation_counter.h"
+
+#include <rttr/type>
+#include <rttr/variant.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct payload_8  { std::uint64_t m_data[1]; };
+struct payload_16 { std::uint64_t m_data[2]; };
+struct payload_32 { std::uint64_t m_data[4]; };
+struct payload_64 { std::uint64_t m_data[8]; };
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static std::size_t get_allocations_per_variant(const T& value)
+{
+    const std::size_t count = 1000;
+    const auto start = g_allocation_count.load();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        rttr::variant var = value;
+        rttr::variant var_moved = std::move(var);
+    }
+
+    return (g_allocation_count.load() - start) / count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_variant_inline_size_ctor(const char* name, const T& value)
+{
+    return nonius::benchmark(name, [value](nonius::chronometer meter)
+    {
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i )
+        {
+           vec[i].construct(value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_inline_size()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant inline storage";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_inline_size.html");
+
+    // a string, which is short enough for the small string optimization of the standard library
+    const std::string text("hello");
+
+    std::stringstream description;
+    description << "The construction of a <code>rttr::variant</code> with payloads of different size. "
+                << "The inline storage of a variant has a size of " << sizeof(rttr::detail::variant_data)
+                << " bytes (CMake option <code>VARIANT_INLINE_SIZE</code>).<br>"
+                << "Heap allocations for creating and moving one variant:<pre>"
+                << "8 bytes:     " << get_allocations_per_variant(payload_8{}) << "\n"
+                << "16 bytes:    " << get_allocations_per_variant(payload_16{}) << "\n"
+                << "32 bytes:    " << get_allocations_per_variant(payload_32{}) << "\n"
+                << "64 bytes:    " << get_allocations_per_variant(payload_64{}) << "\n"
+                << "std::string: " << get_allocations_per_variant(text) << "</pre>";
+
+    reporter.set_current_group_name("inline storage", description.str());
+    nonius::benchmark benchmarks_group_1[] = { bench_variant_inline_size_ctor("8 bytes", payload_8{}),
+                                               bench_variant_inline_size_ctor("16 bytes", payload_16{}),
+                                               bench_variant_inline_size_ctor("32 bytes", payload_32{}),
+                                               bench_variant_inline_size_ctor("64 bytes", payload_64{}),
+                                               bench_variant_inline_size_ctor("std::string", text)};
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,194 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/variant.h>
+#include <rttr/variant_memory_resource.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// too big for the inline storage of a variant
+struct heap_payload
+{
+    std::uint64_t m_data[8];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A simple pool, which is used by one thread only.
+ * Freed blocks are kept in a free list per size class of 16 bytes.
+ */
+class thread_pool_resource : public rttr::variant_memory_resource
+{
+    public:
+        ~thread_pool_resource()
+        {
+            for (auto& free_list : m_free_lists)
+            {
+                while (free_list)
+                {
+                    auto next = free_list->m_next;
+                    std::free(free_list);
+                    free_list = next;
+                }
+            }
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            const auto size_class = get_size_class(size);
+            if (size_class >= size_class_count || alignment > 16)
+                return std::malloc(size);
+
+            if (auto block = m_free_lists[size_class])
+            {
+                m_free_lists[size_class] = block->m_next;
+                return block;
+            }
+
+            return std::malloc((size_class + 1) * 16);
+        }
+
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT
+        {
+            const auto size_class = get_size_class(size);
+            if (size_class >= size_class_count || alignment > 16)
+                return std::free(ptr);
+
+            auto block = static_cast<free_block*>(ptr);
+            block->m_next = m_free_lists[size_class];
+            m_free_lists[size_class] = block;
+        }
+
+    private:
+        static std::size_t get_size_class(std::size_t size) { return (size + 15) / 16 - 1; }
+
+        struct free_block { free_block* m_next; };
+        static const std::size_t size_class_count = 16;
+        free_block* m_free_lists[size_class_count] = {};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t variants_per_thread = 10000;
+
+static std::size_t get_thread_count()
+{
+    const auto count = std::thread::hardware_concurrency();
+    return (count > 1 ? count : 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void create_and_destroy_variants()
+{
+    std::vector<rttr::variant> vec(64);
+    for (std::size_t i = 0; i < variants_per_thread; ++i)
+        vec[i % vec.size()] = heap_payload{{i}};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Func>
+static void run_in_threads(const Func& func)
+{
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < get_thread_count(); ++i)
+        threads.emplace_back(func);
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_create_destroy_global_new()
+{
+    return nonius::benchmark("global new/delete", [](nonius::chronometer meter)
+    {
+        meter.measure([&]()
+        {
+            run_in_threads([]() { create_and_destroy_variants(); });
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_create_destroy_thread_pool()
+{
+    return nonius::benchmark("thread pool resource", [](nonius::chronometer meter)
+    {
+        meter.measure([&]()
+        {
+            run_in_threads([]()
+            {
+                thread_pool_resource pool;
+                rttr::scoped_variant_memory_resource scope(&pool);
+                create_and_destroy_variants();
+            });
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_memory_resource()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant memory resource";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_memory_resource.html");
+
+    std::stringstream description;
+    description << get_thread_count() << " threads create and destroy " << variants_per_thread
+                << " variants each; every value (" << sizeof(heap_payload) << " bytes) is stored on the heap.<br>"
+                << "The memory is allocated with the global <code>operator new</code> "
+                << "or with a <code>rttr::variant_memory_resource</code>, which uses a pool per thread.";
+
+    reporter.set_current_group_name("multithreaded create/destroy", description.str());
+    nonius::benchmark benchmarks_group_1[] = { bench_variant_create_destroy_global_new(),
+                                               bench_variant_create_destroy_thread_pool()};
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
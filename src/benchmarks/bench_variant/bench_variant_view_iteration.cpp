@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_variant/allocation_counter.h"
+
+#include <rttr/type>
+#include <rttr/variant.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <deque>
+#include <list>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+static const int g_item_count = 1000;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static T create_sequential_container()
+{
+    T container;
+    for (int i = 0; i < g_item_count; ++i)
+        container.insert(container.end(), i);
+
+    return container;
+}
+
+template<typename T>
+static T create_associative_container()
+{
+    T container;
+    for (int i = 0; i < g_item_count; ++i)
+        container.insert({i, i});
+
+    return container;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename View>
+static std::size_t iterate_view(const View& view)
+{
+    std::size_t count = 0;
+    for (auto itr = view.begin(); itr != view.end(); itr++)
+        ++count;
+
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename View>
+static std::size_t get_allocations_per_iteration(const View& view)
+{
+    const auto start = g_allocation_count.load();
+    iterate_view(view);
+    return (g_allocation_count.load() - start);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_sequential_view_iteration(const char* name, const rttr::variant& var)
+{
+    return nonius::benchmark(name, [var](nonius::chronometer meter)
+    {
+        auto view = var.create_sequential_view();
+        meter.measure([&]()
+        {
+            return iterate_view(view);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static nonius::benchmark bench_associative_view_iteration(const char* name, const rttr::variant& var)
+{
+    return nonius::benchmark(name, [var](nonius::chronometer meter)
+    {
+        auto view = var.create_associative_view();
+        meter.measure([&]()
+        {
+            return iterate_view(view);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_variant_view_iteration()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant view iteration";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_variant_view_iteration.html");
+
+    const rttr::variant var_vector  = create_sequential_container<std::vector<int>>();
+    const rttr::variant var_deque   = create_sequential_container<std::deque<int>>();
+    const rttr::variant var_list    = create_sequential_container<std::list<int>>();
+
+    std::stringstream description;
+    description << "Iterating with <code>operator++(int)</code> over a <code>variant_sequential_view</code> of "
+                << g_item_count << " items. "
+                << "The inline storage of an iterator has a size of " << sizeof(rttr::detail::iterator_data)
+                << " bytes (CMake option <code>ITERATOR_INLINE_SIZE</code>).<br>"
+                << "Heap allocations for one iteration:<pre>"
+                << "std::vector: " << get_allocations_per_iteration(var_vector.create_sequential_view()) << "\n"
+                << "std::deque:  " << get_allocations_per_iteration(var_deque.create_sequential_view()) << "\n"
+                << "std::list:   " << get_allocations_per_iteration(var_list.create_sequential_view()) << "</pre>";
+
+    reporter.set_current_group_name("sequential view", description.str());
+    nonius::benchmark benchmarks_group_1[] = { bench_sequential_view_iteration("std::vector<int>", var_vector),
+                                               bench_sequential_view_iteration("std::deque<int>", var_deque),
+                                               bench_sequential_view_iteration("std::list<int>", var_list)};
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    const rttr::variant var_map             = create_associative_container<std::map<int, int>>();
+    const rttr::variant var_unordered_map   = create_associative_container<std::unordered_map<int, int>>();
+
+    description.str("");
+    description << "Iterating with <code>operator++(int)</code> over a <code>variant_associative_view</code> of "
+                << g_item_count << " items.<br>"
+                << "Heap allocations for one iteration:<pre>"
+                << "std::map:           " << get_allocations_per_iteration(var_map.create_associative_view()) << "\n"
+                << "std::unordered_map: " << get_allocations_per_iteration(var_unordered_map.create_associative_view()) << "</pre>";
+
+    reporter.set_current_group_name("associative view", description.str());
+    nonius::benchmark benchmarks_group_2[] = { bench_associative_view_iteration("std::map<int, int>", var_map),
+                                               bench_associative_view_iteration("std::unordered_map<int, int>", var_unordered_map)};
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,10 @@
 
 extern void bench_variant_create();
 extern void bench_variant_conversion();
+extern void bench_variant_inline_size();
+extern void bench_variant_memory_resource();
+extern void bench_variant_access();
+extern void bench_variant_view_iteration();
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +38,10 @@ int main(int /* argc */, char** /* argv */)
 {
     bench_variant_create();
     bench_variant_conversion();
+    bench_variant_inline_size();
+    bench_variant_memory_resource();
+    bench_variant_access();
+    bench_variant_view_iteration();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
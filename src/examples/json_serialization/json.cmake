@@ -25,12 +25,8 @@
 #                                                                                  #
 ####################################################################################
 
-set(HEADER_FILES to_json.h
-                 from_json.h
-                 version.rc.in
+set(HEADER_FILES version.rc.in
                  )
 
 set(SOURCE_FILES main.cpp
-                 to_json.cpp
-                 from_json.cpp
                  )
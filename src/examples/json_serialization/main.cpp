@@ -33,9 +33,7 @@
 #include <iostream>
 
 #include <rttr/registration>
-
-#include "to_json.h"
-#include "from_json.h"
+#include <rttr/io/json.h>
 
 using namespace rttr;
 
@@ -141,17 +139,17 @@ int main(int argc, char** argv)
 
         c_1.no_serialize = 12345;
 
-        json_string = io::to_json(my_shape); // serialize the circle to 'json_string'
+        json_string = rttr::io::to_json(my_shape); // serialize the circle to 'json_string'
     }
 
     std::cout << "Circle: c_1:\n" << json_string << std::endl;
 
     circle c_2("Circle #2"); // create a new empty circle
 
-    io::from_json(json_string, c_2); // deserialize it with the content of 'c_1'
+    rttr::io::from_json(json_string, c_2); // deserialize it with the content of 'c_1'
     std::cout << "\n############################################\n" << std::endl;
 
-    std::cout << "Circle c_2:\n" << io::to_json(c_2) << std::endl;
+    std::cout << "Circle c_2:\n" << rttr::io::to_json(c_2) << std::endl;
 
     return 0;
 }
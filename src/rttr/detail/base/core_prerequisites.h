@@ -29,6 +29,7 @@
 #define RTTR_CORE_PREREQUISITES_H_
 
 #include "rttr/detail/base/version.h"
+#include "rttr/detail/base/config.h"
 
 namespace rttr
 {
@@ -89,6 +90,15 @@ namespace rttr
 #   define RTTR_ARCH_TYPE RTTR_ARCH_32
 #endif
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// Endianness
+/////////////////////////////////////////////////////////////////////////////////////////
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#   define RTTR_ENDIAN RTTR_ENDIAN_BIG
+#else
+#   define RTTR_ENDIAN RTTR_ENDIAN_LITTLE
+#endif
+
 #if RTTR_COMPILER == RTTR_COMPILER_MSVC
 #   define RTTR_INLINE          inline
 #   define RTTR_FORCE_INLINE    __forceinline
@@ -198,6 +208,12 @@ namespace rttr
 
 #define RTTR_STATIC_CONSTEXPR static RTTR_CONSTEXPR_OR_CONST
 
+#if RTTR_COMPILER == RTTR_COMPILER_MSVC && RTTR_COMP_VER <= 1800
+#   define RTTR_THREAD_LOCAL __declspec(thread)
+#else
+#   define RTTR_THREAD_LOCAL thread_local
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // deprecated macro
 #if RTTR_COMPILER == RTTR_COMPILER_GNUC || RTTR_COMPILER == RTTR_COMPILER_CLANG
@@ -0,0 +1,135 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/comparison/compute_hash.h"
+
+#include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/type_hasher.h"
+#include "rttr/type.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t hash_integer(std::uint64_t value) RTTR_NOEXCEPT
+{
+    // the finalizer of SplitMix64, every input bit affects every output bit
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ull;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBull;
+    value ^= value >> 31;
+    return static_cast<std::size_t>(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t hash_floating_point(double value) RTTR_NOEXCEPT
+{
+    if (std::isnan(value))
+        return hash_integer(0x7FF8000000000000ull);
+
+    // integral values compare equal to integers, so they need the same hash value; this includes -0.0
+    if (value >= -9223372036854775808.0 && value < 9223372036854775808.0 && std::trunc(value) == value)
+        return hash_integer(static_cast<std::uint64_t>(static_cast<std::int64_t>(value)));
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    return hash_integer(bits);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t hash_bytes(const void* data, std::size_t size) RTTR_NOEXCEPT
+{
+    // MurmurHash64A of Austin Appleby
+    const std::uint64_t m = 0xC6A4A7935BD1E995ull;
+    const int r = 47;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::uint64_t h = 0xE17A1465ull ^ (static_cast<std::uint64_t>(size) * m);
+
+    for (; size >= 8; size -= 8, bytes += 8)
+    {
+        std::uint64_t k;
+        std::memcpy(&k, bytes, sizeof(k));
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    if (size > 0)
+    {
+        std::uint64_t k = 0;
+        for (std::size_t i = size; i > 0; --i)
+            k = (k << 8) | bytes[i - 1];
+
+        h ^= k;
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+
+    return static_cast<std::size_t>(h);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t hash_combine(std::size_t seed, std::size_t value) RTTR_NOEXCEPT
+{
+    return hash_integer(static_cast<std::uint64_t>(seed) * 31u + value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool compute_registered_hash(const void* value, const type& t, std::size_t& result)
+{
+    if (auto hasher = type_register_private::get_hasher(t))
+    {
+        result = hasher->hash(value);
+        return true;
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
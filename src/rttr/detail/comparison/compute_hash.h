@@ -0,0 +1,93 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_COMPUTE_HASH_H_
+#define RTTR_COMPUTE_HASH_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rttr
+{
+class type;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the hash value of the integer \p value; signed integers have to be sign extended.
+ */
+RTTR_API std::size_t hash_integer(std::uint64_t value) RTTR_NOEXCEPT;
+
+/*!
+ * Returns the hash value of \p value; when it is an integral number,
+ * the same value as for the corresponding integer is returned.
+ */
+RTTR_API std::size_t hash_floating_point(double value) RTTR_NOEXCEPT;
+
+/*!
+ * Returns the hash value of the given byte sequence.
+ */
+RTTR_API std::size_t hash_bytes(const void* data, std::size_t size) RTTR_NOEXCEPT;
+
+/*!
+ * Returns the combination of the hash value \p seed with the hash value \p value.
+ * The result depends on the order of the combined values.
+ */
+RTTR_API std::size_t hash_combine(std::size_t seed, std::size_t value) RTTR_NOEXCEPT;
+
+/*!
+ * Computes the hash value of \p value with the hash function, which was registered for the type \p t.
+ *
+ * \return `true`, when a hash function was registered; otherwise `false`.
+ */
+RTTR_API bool compute_registered_hash(const void* value, const type& t, std::size_t& result);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Computes the hash value of \p value and stores it in \p result.
+ *
+ * The hash value is consistent with the equality check of the \ref variant class.
+ *
+ * \return `true`, when a hash value could be computed; otherwise `false`.
+ */
+template<typename T>
+RTTR_INLINE bool compute_hash(const T& value, std::size_t& result);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#include "rttr/detail/comparison/compute_hash_impl.h"
+
+#endif // RTTR_COMPUTE_HASH_H_
@@ -0,0 +1,240 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_COMPUTE_HASH_IMPL_H_
+#define RTTR_COMPUTE_HASH_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+#include "rttr/type.h"
+#include "rttr/string_view.h"
+#include "rttr/sequential_mapper.h"
+#include "rttr/associative_mapper.h"
+
+#include <type_traits>
+#include <string>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct hash_integral_tag {};
+struct hash_floating_point_tag {};
+struct hash_enum_tag {};
+struct hash_string_tag {};
+struct hash_nullptr_tag {};
+struct hash_pointer_tag {};
+struct hash_sequential_container_tag {};
+struct hash_associative_container_tag {};
+struct hash_pair_tag {};
+struct hash_registered_tag {};
+
+template<typename T>
+struct is_std_pair : std::false_type {};
+
+template<typename T1, typename T2>
+struct is_std_pair<std::pair<T1, T2>> : std::true_type {};
+
+template<typename T>
+using hash_tag_t = conditional_t<std::is_integral<T>::value,                hash_integral_tag,
+                   conditional_t<std::is_floating_point<T>::value,          hash_floating_point_tag,
+                   conditional_t<std::is_enum<T>::value,                    hash_enum_tag,
+                   conditional_t<std::is_same<T, std::string>::value ||
+                                 std::is_same<T, string_view>::value,       hash_string_tag,
+                   conditional_t<std::is_same<T, std::nullptr_t>::value,    hash_nullptr_tag,
+                   conditional_t<std::is_pointer<T>::value &&
+                                 !std::is_function<remove_pointer_t<T>>::value, hash_pointer_tag,
+                   conditional_t<is_sequential_container<T>::value,         hash_sequential_container_tag,
+                   conditional_t<is_associative_container<T>::value,        hash_associative_container_tag,
+                   conditional_t<is_std_pair<T>::value,                     hash_pair_tag,
+                                                                            hash_registered_tag>>>>>>>>>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_integral_tag)
+{
+    // equal numbers of different integer types shall get the same hash value
+    using extended_type = conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>;
+    result = hash_integer(static_cast<std::uint64_t>(static_cast<extended_type>(value)));
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_floating_point_tag)
+{
+    result = hash_floating_point(static_cast<double>(value));
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_enum_tag)
+{
+    using underlying_type = typename std::underlying_type<T>::type;
+    return compute_hash(static_cast<underlying_type>(value), result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_string_tag)
+{
+    result = hash_bytes(value.data(), value.size());
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T&, std::size_t& result, hash_nullptr_tag)
+{
+    // the same hash value as for any other null pointer
+    result = hash_integer(0);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_pointer_tag)
+{
+    result = hash_integer(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value)));
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_sequential_container_tag)
+{
+    using mapper = sequential_container_mapper<T>;
+
+    using const_itr_t = typename mapper::const_itr_t;
+
+    std::size_t seed = hash_integer(0);
+    for (const_itr_t itr = mapper::begin(value), end = mapper::end(value); itr != end; ++itr)
+    {
+        // select the const overload, for std::initializer_list both iterator types are identical
+        const const_itr_t& const_itr = itr;
+        std::size_t item_hash;
+        if (!compute_hash(mapper::get_data(const_itr), item_hash))
+            return false;
+
+        seed = hash_combine(seed, item_hash);
+    }
+
+    result = seed;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Mapper, typename Itr>
+RTTR_INLINE enable_if_t<std::is_void<typename Mapper::value_t>::value, bool>
+compute_associative_item_hash(const Itr& itr, std::size_t& result)
+{
+    return compute_hash(Mapper::get_key(itr), result);
+}
+
+template<typename Mapper, typename Itr>
+RTTR_INLINE enable_if_t<!std::is_void<typename Mapper::value_t>::value, bool>
+compute_associative_item_hash(const Itr& itr, std::size_t& result)
+{
+    std::size_t key_hash, value_hash;
+    if (!compute_hash(Mapper::get_key(itr), key_hash) || !compute_hash(Mapper::get_value(itr), value_hash))
+        return false;
+
+    result = hash_combine(key_hash, value_hash);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_associative_container_tag)
+{
+    using mapper = associative_container_mapper<T>;
+
+    // the items are summed up, so the order of the items,
+    // e.g. inside an unordered container, does not change the hash value
+    std::size_t seed = hash_integer(0);
+    for (auto itr = mapper::begin(value), end = mapper::end(value); itr != end; ++itr)
+    {
+        std::size_t item_hash;
+        if (!compute_associative_item_hash<mapper>(itr, item_hash))
+            return false;
+
+        seed += hash_integer(item_hash);
+    }
+
+    result = seed;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_pair_tag)
+{
+    std::size_t first_hash, second_hash;
+    if (!compute_hash(value.first, first_hash) || !compute_hash(value.second, second_hash))
+        return false;
+
+    result = hash_combine(first_hash, second_hash);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash_impl(const T& value, std::size_t& result, hash_registered_tag)
+{
+    return compute_registered_hash(&value, type::get<T>(), result);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool compute_hash(const T& value, std::size_t& result)
+{
+    return compute_hash_impl(value, result, hash_tag_t<T>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_COMPUTE_HASH_IMPL_H_
@@ -0,0 +1,103 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/conversion/basic_conversion_table.h"
+
+#include "rttr/type.h"
+#include "rttr/argument.h"
+#include "rttr/detail/variant/variant_data_converter.h"
+
+namespace rttr
+{
+namespace detail
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+using basic_conversion_func = bool (*)(const void* from, void* to);
+
+RTTR_STATIC_CONSTEXPR std::size_t basic_conversion_count = type_list_size<basic_conversion_types>::value;
+
+struct basic_conversion_row
+{
+    basic_conversion_func m_funcs[basic_conversion_count];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source, typename Target>
+static bool convert_basic(const void* from, void* to)
+{
+    return convert_from<Source>::to(*static_cast<const Source*>(from), *static_cast<Target*>(to));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source, typename Target_List>
+struct basic_conversion_row_creator;
+
+template<typename Source, typename... Targets>
+struct basic_conversion_row_creator<Source, type_list<Targets...>>
+{
+    static RTTR_CONSTEXPR basic_conversion_row get()
+    {
+        return basic_conversion_row{ { &convert_basic<Source, Targets>... } };
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source_List>
+struct basic_conversion_table_creator;
+
+template<typename... Sources>
+struct basic_conversion_table_creator<type_list<Sources...>>
+{
+    static RTTR_INLINE const basic_conversion_row* get()
+    {
+        // all entries are address constants, so the table is initialized at compile time
+        static const basic_conversion_row table[] = { basic_conversion_row_creator<Sources, basic_conversion_types>::get()... };
+        return table;
+    }
+};
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool convert_basic_type(std::uint8_t source_index, std::uint8_t target_index, const void* from, void* to)
+{
+    const basic_conversion_row* table = basic_conversion_table_creator<basic_conversion_types>::get();
+    return table[source_index].m_funcs[target_index](from, to);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
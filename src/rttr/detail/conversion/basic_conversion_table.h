@@ -0,0 +1,102 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BASIC_CONVERSION_TABLE_H_
+#define RTTR_BASIC_CONVERSION_TABLE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/misc_type_traits.h"
+
+#include <cstdint>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The list of all types, which have a build in conversion to each other.
+ *
+ * For every pair of these types, the conversion function is stored in a precomputed table.
+ * A type is referenced in this table with its position inside this list, see \ref basic_conversion_index.
+ */
+using basic_conversion_types = type_list<bool, char,
+                                         int8_t, int16_t, int32_t, int64_t,
+                                         uint8_t, uint16_t, uint32_t, uint64_t,
+                                         float, double, std::string>;
+
+/*!
+ * The index value for all types, which are not contained in \ref basic_conversion_types.
+ */
+RTTR_STATIC_CONSTEXPR std::uint8_t invalid_conversion_index = 0xFF;
+
+template<typename T, std::uint8_t Index, typename List>
+struct basic_conversion_index_impl;
+
+template<typename T, std::uint8_t Index>
+struct basic_conversion_index_impl<T, Index, type_list<>> : std::integral_constant<std::uint8_t, invalid_conversion_index>
+{
+};
+
+template<typename T, std::uint8_t Index, typename Head, typename... Tail>
+struct basic_conversion_index_impl<T, Index, type_list<Head, Tail...>>
+:   conditional_t<std::is_same<T, Head>::value,
+                  std::integral_constant<std::uint8_t, Index>,
+                  basic_conversion_index_impl<T, static_cast<std::uint8_t>(Index + 1), type_list<Tail...>>>
+{
+};
+
+/*!
+ * Returns the position of \p T inside \ref basic_conversion_types,
+ * or \ref invalid_conversion_index when \p T is not contained in this list.
+ */
+template<typename T>
+using basic_conversion_index = basic_conversion_index_impl<T, 0, basic_conversion_types>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Converts the value \p from into the value \p to, by using the precomputed conversion table.
+ *
+ * \param source_index The \ref basic_conversion_index of the type of \p from.
+ * \param target_index The \ref basic_conversion_index of the type of \p to.
+ *
+ * \remark Both indices have to be valid; this is not checked.
+ *
+ * \return True, when the value could be converted; otherwise false.
+ */
+RTTR_API bool convert_basic_type(std::uint8_t source_index, std::uint8_t target_index, const void* from, void* to);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BASIC_CONVERSION_TABLE_H_
@@ -0,0 +1,79 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_CHARS_TO_NUMBER_H_
+#define RTTR_CHARS_TO_NUMBER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Parses the characters in the range [\p first, \p last) as an integer number and stores it in \p value.
+ *
+ * The whole range has to match the pattern `[+-]?[0-9]+`; a minus sign is not accepted for unsigned types.
+ * Leading or trailing whitespace is not skipped, the current locale is not used,
+ * no exception is thrown and no memory is allocated.
+ *
+ * \return `true` when the range could be parsed and the number is representable by the target type; otherwise `false`.
+ *         On failure, \p value is not modified.
+ */
+bool chars_to_number(const char* first, const char* last, int& value) RTTR_NOEXCEPT;
+bool chars_to_number(const char* first, const char* last, long& value) RTTR_NOEXCEPT;
+bool chars_to_number(const char* first, const char* last, long long& value) RTTR_NOEXCEPT;
+bool chars_to_number(const char* first, const char* last, unsigned int& value) RTTR_NOEXCEPT;
+bool chars_to_number(const char* first, const char* last, unsigned long& value) RTTR_NOEXCEPT;
+bool chars_to_number(const char* first, const char* last, unsigned long long& value) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Parses the characters in the range [\p first, \p last) as a floating point number and stores it in \p value.
+ *
+ * The whole range has to match the pattern `[+-]?([0-9]+[.]?[0-9]*|[.][0-9]+)([eE][+-]?[0-9]+)?`,
+ * or one of `inf`, `infinity` and `nan` (case insensitive, with an optional sign).
+ * The result is correctly rounded to the nearest representable value (ties to even).
+ * Like `std::from_chars`, the current locale is not used, no exception is thrown and no memory is allocated.
+ *
+ * \return `true` when the range could be parsed and the number is within the range of the target type; otherwise `false`.
+ *         A finite number, which is too big or too small (but not zero) to be represented, is reported as failure.
+ *         On failure, \p value is not modified.
+ */
+bool chars_to_number(const char* first, const char* last, float& value) RTTR_NOEXCEPT;
+bool chars_to_number(const char* first, const char* last, double& value) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CHARS_TO_NUMBER_H_
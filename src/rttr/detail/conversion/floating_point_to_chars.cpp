@@ -0,0 +1,536 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/conversion/floating_point_to_chars.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace rttr
+{
+namespace detail
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The shortest representation is computed with the Grisu2 algorithm of Florian Loitsch:
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010.
+// The generated digits are always read back into the same value;
+// in very rare cases, they are not the shortest possible ones.
+
+/*!
+ * A floating point number without any hidden bit: value = m_f * 2^m_e
+ */
+struct diy_fp
+{
+    std::uint64_t   m_f;
+    int             m_e;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE diy_fp subtract(const diy_fp& x, const diy_fp& y) RTTR_NOEXCEPT
+{
+    return diy_fp{x.m_f - y.m_f, x.m_e};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the upper 64 bits of the 128 bit product of the significands, correctly rounded.
+ */
+static RTTR_INLINE diy_fp multiply(const diy_fp& x, const diy_fp& y) RTTR_NOEXCEPT
+{
+    const std::uint64_t x_lo = x.m_f & 0xFFFFFFFFu;
+    const std::uint64_t x_hi = x.m_f >> 32;
+    const std::uint64_t y_lo = y.m_f & 0xFFFFFFFFu;
+    const std::uint64_t y_hi = y.m_f >> 32;
+
+    const std::uint64_t p0 = x_lo * y_lo;
+    const std::uint64_t p1 = x_lo * y_hi;
+    const std::uint64_t p2 = x_hi * y_lo;
+    const std::uint64_t p3 = x_hi * y_hi;
+
+    std::uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+    q += std::uint64_t(1) << 31; // round half up
+
+    return diy_fp{p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.m_e + y.m_e + 64};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE diy_fp normalize(diy_fp x) RTTR_NOEXCEPT
+{
+    while ((x.m_f >> 63) == 0)
+    {
+        x.m_f <<= 1;
+        --x.m_e;
+    }
+
+    return x;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE diy_fp normalize_to(const diy_fp& x, int target_exponent) RTTR_NOEXCEPT
+{
+    return diy_fp{x.m_f << (x.m_e - target_exponent), target_exponent};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The normalized value \p m_w and its normalized boundaries \p m_minus and \p m_plus.
+ * All values in between the boundaries are rounded to \p m_w, when they are read back.
+ */
+struct boundaries
+{
+    diy_fp m_w;
+    diy_fp m_minus;
+    diy_fp m_plus;
+};
+
+template<typename T>
+struct float_bits;
+
+template<>
+struct float_bits<float>
+{
+    using type = std::uint32_t;
+};
+
+template<>
+struct float_bits<double>
+{
+    using type = std::uint64_t;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Computes the boundaries of a finite and positive value.
+ */
+template<typename T>
+static boundaries compute_boundaries(T value) RTTR_NOEXCEPT
+{
+    using bits_type = typename float_bits<T>::type;
+
+    const int           precision   = std::numeric_limits<T>::digits; // including the hidden bit
+    const int           bias        = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    const int           min_exp     = 1 - bias;
+    const std::uint64_t hidden_bit  = std::uint64_t(1) << (precision - 1);
+
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+
+    const std::uint64_t exponent_bits   = static_cast<std::uint64_t>(bits) >> (precision - 1);
+    const std::uint64_t fraction_bits   = static_cast<std::uint64_t>(bits) & (hidden_bit - 1);
+
+    const bool is_denormal = (exponent_bits == 0);
+    const diy_fp v = is_denormal ? diy_fp{fraction_bits, min_exp}
+                                 : diy_fp{fraction_bits + hidden_bit, static_cast<int>(exponent_bits) - bias};
+
+    // the distance to the next smaller value is only half as big, when the fraction is zero
+    const bool lower_boundary_is_closer = (fraction_bits == 0 && exponent_bits > 1);
+
+    const diy_fp m_plus     = diy_fp{2 * v.m_f + 1, v.m_e - 1};
+    const diy_fp m_minus    = lower_boundary_is_closer ? diy_fp{4 * v.m_f - 1, v.m_e - 2}
+                                                       : diy_fp{2 * v.m_f - 1, v.m_e - 1};
+
+    const diy_fp w_plus     = normalize(m_plus);
+    const diy_fp w_minus    = normalize_to(m_minus, w_plus.m_e);
+
+    return boundaries{normalize(v), w_minus, w_plus};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// the binary exponent of the scaled values has to be inside this range,
+// then the integral part fits into 32 bit and the digit generation is simple
+static RTTR_CONSTEXPR_OR_CONST int min_target_exponent = -60;
+static RTTR_CONSTEXPR_OR_CONST int max_target_exponent = -32;
+
+struct cached_power
+{
+    std::uint64_t   m_f;
+    int             m_e;
+    int             m_k;
+};
+
+/*!
+ * Returns a normalized power of ten c = 10^k, such that the product of c with
+ * a normalized value, which has the binary exponent \p e, has an exponent in the range
+ * [min_target_exponent, max_target_exponent].
+ */
+static cached_power get_cached_power(int e) RTTR_NOEXCEPT
+{
+    // 10^k, for k = -300, -292, ..., 324; the significands are correctly rounded
+    static const cached_power powers[] =
+    {
+        { 0xAB70FE17C79AC6CA, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4F, -1034, -292 },
+        { 0xBE5691EF416BD60C, -1007, -284 },
+        { 0x8DD01FAD907FFC3C,  -980, -276 },
+        { 0xD3515C2831559A83,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5,  -927, -260 },
+        { 0xEA9C227723EE8BCB,  -901, -252 },
+        { 0xAECC49914078536D,  -874, -244 },
+        { 0x823C12795DB6CE57,  -847, -236 },
+        { 0xC21094364DFB5637,  -821, -228 },
+        { 0x9096EA6F3848984F,  -794, -220 },
+        { 0xD77485CB25823AC7,  -768, -212 },
+        { 0xA086CFCD97BF97F4,  -741, -204 },
+        { 0xEF340A98172AACE5,  -715, -196 },
+        { 0xB23867FB2A35B28E,  -688, -188 },
+        { 0x84C8D4DFD2C63F3B,  -661, -180 },
+        { 0xC5DD44271AD3CDBA,  -635, -172 },
+        { 0x936B9FCEBB25C996,  -608, -164 },
+        { 0xDBAC6C247D62A584,  -582, -156 },
+        { 0xA3AB66580D5FDAF6,  -555, -148 },
+        { 0xF3E2F893DEC3F126,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8,  -502, -132 },
+        { 0x87625F056C7C4A8B,  -475, -124 },
+        { 0xC9BCFF6034C13053,  -449, -116 },
+        { 0x964E858C91BA2655,  -422, -108 },
+        { 0xDFF9772470297EBD,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88F,  -369,  -92 },
+        { 0xF8A95FCF88747D94,  -343,  -84 },
+        { 0xB94470938FA89BCF,  -316,  -76 },
+        { 0x8A08F0F8BF0F156B,  -289,  -68 },
+        { 0xCDB02555653131B6,  -263,  -60 },
+        { 0x993FE2C6D07B7FAC,  -236,  -52 },
+        { 0xE45C10C42A2B3B06,  -210,  -44 },
+        { 0xAA242499697392D3,  -183,  -36 },
+        { 0xFD87B5F28300CA0E,  -157,  -28 },
+        { 0xBCE5086492111AEB,  -130,  -20 },
+        { 0x8CBCCC096F5088CC,  -103,  -12 },
+        { 0xD1B71758E219652C,   -77,   -4 },
+        { 0x9C40000000000000,   -50,    4 },
+        { 0xE8D4A51000000000,   -24,   12 },
+        { 0xAD78EBC5AC620000,     3,   20 },
+        { 0x813F3978F8940984,    30,   28 },
+        { 0xC097CE7BC90715B3,    56,   36 },
+        { 0x8F7E32CE7BEA5C70,    83,   44 },
+        { 0xD5D238A4ABE98068,   109,   52 },
+        { 0x9F4F2726179A2245,   136,   60 },
+        { 0xED63A231D4C4FB27,   162,   68 },
+        { 0xB0DE65388CC8ADA8,   189,   76 },
+        { 0x83C7088E1AAB65DB,   216,   84 },
+        { 0xC45D1DF942711D9A,   242,   92 },
+        { 0x924D692CA61BE758,   269,  100 },
+        { 0xDA01EE641A708DEA,   295,  108 },
+        { 0xA26DA3999AEF774A,   322,  116 },
+        { 0xF209787BB47D6B85,   348,  124 },
+        { 0xB454E4A179DD1877,   375,  132 },
+        { 0x865B86925B9BC5C2,   402,  140 },
+        { 0xC83553C5C8965D3D,   428,  148 },
+        { 0x952AB45CFA97A0B3,   455,  156 },
+        { 0xDE469FBD99A05FE3,   481,  164 },
+        { 0xA59BC234DB398C25,   508,  172 },
+        { 0xF6C69A72A3989F5C,   534,  180 },
+        { 0xB7DCBF5354E9BECE,   561,  188 },
+        { 0x88FCF317F22241E2,   588,  196 },
+        { 0xCC20CE9BD35C78A5,   614,  204 },
+        { 0x98165AF37B2153DF,   641,  212 },
+        { 0xE2A0B5DC971F303A,   667,  220 },
+        { 0xA8D9D1535CE3B396,   694,  228 },
+        { 0xFB9B7CD9A4A7443C,   720,  236 },
+        { 0xBB764C4CA7A44410,   747,  244 },
+        { 0x8BAB8EEFB6409C1A,   774,  252 },
+        { 0xD01FEF10A657842C,   800,  260 },
+        { 0x9B10A4E5E9913129,   827,  268 },
+        { 0xE7109BFBA19C0C9D,   853,  276 },
+        { 0xAC2820D9623BF429,   880,  284 },
+        { 0x80444B5E7AA7CF85,   907,  292 },
+        { 0xBF21E44003ACDD2D,   933,  300 },
+        { 0x8E679C2F5E44FF8F,   960,  308 },
+        { 0xD433179D9C8CB841,   986,  316 },
+        { 0x9E19DB92B4E31BA9,  1013,  324 }
+    };
+
+    const int min_decimal_exponent  = -300;
+    const int decimal_exponent_step = 8;
+
+    // k = ceil((min_target_exponent - e - 1) * log10(2))
+    const int f = min_target_exponent - e - 1;
+    const int k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+    const int index = (-min_decimal_exponent + k + (decimal_exponent_step - 1)) / decimal_exponent_step;
+
+    return powers[index];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the number of decimal digits of \p n and sets \p pow10 to 10^(digits - 1).
+ */
+static RTTR_INLINE int find_largest_pow10(std::uint32_t n, std::uint32_t& pow10) RTTR_NOEXCEPT
+{
+    std::uint32_t p = 1000000000;
+    int digits = 10;
+    while (p > n && digits > 1)
+    {
+        p /= 10;
+        --digits;
+    }
+
+    pow10 = p;
+    return digits;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Moves the last digit in \p buffer closer to the exact value \p w, as long as it stays inside the boundaries.
+ */
+static RTTR_INLINE void round_last_digit(char* buffer, int length, std::uint64_t dist, std::uint64_t delta,
+                                         std::uint64_t rest, std::uint64_t ten_k) RTTR_NOEXCEPT
+{
+    while (rest < dist && delta - rest >= ten_k &&
+           (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+    {
+        --buffer[length - 1];
+        rest += ten_k;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Generates the shortest digits for a value in the range [m_minus, m_plus].
+ */
+static void generate_digits(char* buffer, int& length, int& decimal_exponent,
+                            const diy_fp& m_minus, const diy_fp& w, const diy_fp& m_plus) RTTR_NOEXCEPT
+{
+    std::uint64_t delta = subtract(m_plus, m_minus).m_f;
+    std::uint64_t dist  = subtract(m_plus, w).m_f;
+
+    // split m_plus into an integral part p1 and a fractional part p2
+    const diy_fp one{std::uint64_t(1) << -m_plus.m_e, m_plus.m_e};
+
+    std::uint32_t p1 = static_cast<std::uint32_t>(m_plus.m_f >> -one.m_e);
+    std::uint64_t p2 = m_plus.m_f & (one.m_f - 1);
+
+    std::uint32_t pow10;
+    int n = find_largest_pow10(p1, pow10);
+
+    while (n > 0)
+    {
+        const std::uint32_t digit = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + digit);
+        --n;
+
+        const std::uint64_t rest = (static_cast<std::uint64_t>(p1) << -one.m_e) + p2;
+        if (rest <= delta)
+        {
+            decimal_exponent += n;
+            round_last_digit(buffer, length, dist, delta, rest, static_cast<std::uint64_t>(pow10) << -one.m_e);
+            return;
+        }
+
+        pow10 /= 10;
+    }
+
+    int m = 0;
+    for (;;)
+    {
+        p2 *= 10;
+        const std::uint64_t digit = p2 >> -one.m_e;
+        p2 &= one.m_f - 1;
+        buffer[length++] = static_cast<char>('0' + digit);
+        ++m;
+
+        delta *= 10;
+        dist  *= 10;
+        if (p2 <= delta)
+            break;
+    }
+
+    decimal_exponent -= m;
+    round_last_digit(buffer, length, dist, delta, p2, one.m_f);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes the shortest digits of the finite and positive \p value into \p buffer.
+ * The value is then: digits * 10^decimal_exponent
+ */
+template<typename T>
+static void grisu2(char* buffer, int& length, int& decimal_exponent, T value) RTTR_NOEXCEPT
+{
+    const boundaries b = compute_boundaries(value);
+    const cached_power cached = get_cached_power(b.m_plus.m_e);
+    const diy_fp c_minus_k{cached.m_f, cached.m_e};
+
+    const diy_fp w          = multiply(b.m_w, c_minus_k);
+    const diy_fp w_minus    = multiply(b.m_minus, c_minus_k);
+    const diy_fp w_plus     = multiply(b.m_plus, c_minus_k);
+
+    // the multiplication has an error of one ulp, so the boundaries are moved inwards
+    const diy_fp m_minus{w_minus.m_f + 1, w_minus.m_e};
+    const diy_fp m_plus{w_plus.m_f - 1, w_plus.m_e};
+
+    length = 0;
+    decimal_exponent = -cached.m_k;
+    generate_digits(buffer, length, decimal_exponent, m_minus, w, m_plus);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE char* write_exponent(char* buffer, int exponent) RTTR_NOEXCEPT
+{
+    *buffer++ = 'e';
+    if (exponent < 0)
+    {
+        *buffer++ = '-';
+        exponent = -exponent;
+    }
+    else
+    {
+        *buffer++ = '+';
+    }
+
+    // at least two digits, like printf
+    if (exponent >= 100)
+    {
+        *buffer++ = static_cast<char>('0' + exponent / 100);
+        exponent %= 100;
+    }
+
+    *buffer++ = static_cast<char>('0' + exponent / 10);
+    *buffer++ = static_cast<char>('0' + exponent % 10);
+    return buffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Formats the digits, which were placed at the begin of \p buffer, in place.
+ */
+static char* format_digits(char* buffer, int length, int decimal_exponent, int precision) RTTR_NOEXCEPT
+{
+    // the position of the decimal point, relative to the first digit
+    const int n = length + decimal_exponent;
+    const int scientific_exponent = n - 1;
+
+    if (scientific_exponent < -4 || scientific_exponent >= precision)
+    {
+        // d[.ddd]e+XX
+        if (length > 1)
+        {
+            std::memmove(buffer + 2, buffer + 1, static_cast<std::size_t>(length - 1));
+            buffer[1] = '.';
+            ++length;
+        }
+
+        return write_exponent(buffer + length, scientific_exponent);
+    }
+
+    if (n >= length)
+    {
+        // ddd000
+        std::memset(buffer + length, '0', static_cast<std::size_t>(n - length));
+        return buffer + n;
+    }
+
+    if (n > 0)
+    {
+        // ddd.ddd
+        std::memmove(buffer + n + 1, buffer + n, static_cast<std::size_t>(length - n));
+        buffer[n] = '.';
+        return buffer + length + 1;
+    }
+
+    // 0.000ddd
+    std::memmove(buffer + 2 - n, buffer, static_cast<std::size_t>(length));
+    buffer[0] = '0';
+    buffer[1] = '.';
+    std::memset(buffer + 2, '0', static_cast<std::size_t>(-n));
+    return buffer + 2 - n + length;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static char* floating_point_to_chars_impl(char* buffer, T value) RTTR_NOEXCEPT
+{
+    if (value != value)
+    {
+        std::memcpy(buffer, "nan", 3);
+        return buffer + 3;
+    }
+
+    if (std::signbit(value))
+    {
+        *buffer++ = '-';
+        value = -value;
+    }
+
+    if (value == std::numeric_limits<T>::infinity())
+    {
+        std::memcpy(buffer, "inf", 3);
+        return buffer + 3;
+    }
+
+    if (value == 0)
+    {
+        *buffer++ = '0';
+        return buffer;
+    }
+
+    int length = 0;
+    int decimal_exponent = 0;
+    grisu2(buffer, length, decimal_exponent, value);
+
+    return format_digits(buffer, length, decimal_exponent, std::numeric_limits<T>::digits10);
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+char* floating_point_to_chars(char* buffer, float value)
+{
+    return floating_point_to_chars_impl(buffer, value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+char* floating_point_to_chars(char* buffer, double value)
+{
+    return floating_point_to_chars_impl(buffer, value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,77 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_FLOATING_POINT_TO_CHARS_H_
+#define RTTR_FLOATING_POINT_TO_CHARS_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The minimum size of the buffer, which has to be provided to \ref floating_point_to_chars.
+ */
+RTTR_STATIC_CONSTEXPR int floating_point_buffer_size = 32;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Writes the shortest decimal representation of \p value into \p buffer,
+ *        which can be read back into exactly the same value.
+ *
+ * The output does not depend on the current locale and no memory is allocated.
+ * The notation is chosen like the `%g` format with a precision of `std::numeric_limits<float>::digits10`,
+ * i.e. the scientific notation (e.g. `1.5e+20`) is used, when the decimal exponent is smaller than -4
+ * or not smaller than this precision; otherwise the fixed notation is used.
+ * Infinity and NaN are written as `inf`, `-inf` and `nan`.
+ *
+ * \remark The buffer has to be at least \ref floating_point_buffer_size bytes big; no null terminator is written.
+ *
+ * \return A pointer one past the last written character.
+ */
+char* floating_point_to_chars(char* buffer, float value);
+
+/*!
+ * \brief Writes the shortest decimal representation of \p value into \p buffer,
+ *        which can be read back into exactly the same value.
+ *
+ * The same rules as for the float overload apply,
+ * however the precision for the notation is `std::numeric_limits<double>::digits10`.
+ *
+ * \return A pointer one past the last written character.
+ */
+char* floating_point_to_chars(char* buffer, double value);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_FLOATING_POINT_TO_CHARS_H_
@@ -27,14 +27,11 @@
 
 #include "rttr/detail/conversion/std_conversion_functions.h"
 
-#include "rttr/detail/conversion/number_conversion.h"
+#include "rttr/detail/conversion/floating_point_to_chars.h"
+#include "rttr/detail/conversion/chars_to_number.h"
 
-#include <sstream>
 #include <locale>
-#include <limits>
 #include <algorithm>
-#include <climits>
-#include <iomanip>
 
 namespace rttr
 {
@@ -106,46 +103,41 @@ std::string to_string(unsigned long long value, bool* ok)
 
 std::string to_string(float value, bool* ok)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<float>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    char buffer[floating_point_buffer_size];
+    char* end = floating_point_to_chars(buffer, value);
+    if (ok)
+        *ok = true;
+    return std::string(buffer, end);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::string to_string(double value, bool* ok)
 {
-    try
-    {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<double>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    char buffer[floating_point_buffer_size];
+    char* end = floating_point_to_chars(buffer, value);
+    if (ok)
+        *ok = true;
+    return std::string(buffer, end);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+static RTTR_INLINE T string_to_number(const std::string& source, bool* ok)
+{
+    T value = T();
+    const bool result = chars_to_number(source.data(), source.data() + source.size(), value);
+    if (ok)
+        *ok = result;
+
+    return value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool string_to_bool(std::string text, bool* ok)
 {
     std::transform(text.begin(), text.end(), text.begin(), [](char ch) { return std::tolower(ch, std::locale::classic()); });
@@ -168,168 +160,42 @@ bool string_to_bool(std::string text, bool* ok)
 
 int string_to_int(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const int value = std::stoi(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<int>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 unsigned long string_to_ulong(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        unsigned long result = 0;
-        if (pos == source.length() && convert_to(value, result))
-        {
-            if (ok)
-                *ok = true;
-            return result;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<unsigned long>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 long long string_to_long_long(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<long long>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 unsigned long long string_to_ulong_long(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const auto itr = std::find_if(source.begin(), source.end(), [](char c){ return !std::isdigit(c, std::locale()); });
-        if (itr == source.end())
-        {
-            const unsigned long long value = std::stoull(source, &pos);
-            if (pos == source.length())
-            {
-                if (ok)
-                    *ok = true;
-                return value;
-            }
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<unsigned long long>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 float string_to_float(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const float value = std::stof(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-    return 0;
+    return string_to_number<float>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 double string_to_double(const std::string& source, bool* ok)
 {
-    try
-    {
-        std::size_t pos = 0;
-        const double value = std::stod(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
-    }
-    catch (...)
-    {
-        if (ok)
-            *ok = false;
-        return 0;
-    }
-
-    if (ok)
-        *ok = false;
-
-    return 0;
+    return string_to_number<double>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +51,25 @@ namespace rttr
 namespace detail
 {
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Determines whether the elements of the container type \p T are stored contiguously in memory.
+ */
+template<typename T>
+struct is_contiguous_container : std::false_type {};
+
+template<typename T>
+struct is_contiguous_container<std::vector<T>> : std::true_type {};
+
+template<>
+struct is_contiguous_container<std::vector<bool>> : std::false_type {};
+
+template<typename T, std::size_t N>
+struct is_contiguous_container<std::array<T, N>> : std::true_type {};
+
+template<typename T, std::size_t N>
+struct is_contiguous_container<T[N]> : std::true_type {};
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -144,6 +163,23 @@ struct sequential_container_mapper_wrapper : iterator_wrapper_base<Tp>
 
     /////////////////////////////////////////////////////////////////////////
 
+    template<typename..., typename C = ConstType,
+             enable_if_t<is_contiguous_container<T>::value && !std::is_const<C>::value, int> = 0>
+    static void* get_data_address(void* container)
+    {
+        auto& cont = get_container(container);
+        return (base_class::is_empty(cont) ? nullptr : static_cast<void*>(&base_class::get_value(cont, 0)));
+    }
+
+    template<typename..., typename C = ConstType,
+             enable_if_t<!is_contiguous_container<T>::value || std::is_const<C>::value, int> = 0>
+    static void* get_data_address(void* container)
+    {
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+
     template<typename..., typename C = ConstType, enable_if_t<!std::is_const<C>::value, int> = 0>
     static bool set_size(void* container, std::size_t size)
     {
@@ -904,6 +940,11 @@ struct sequential_container_empty
         return 0;
     }
 
+    static void* get_data_address(void* container)
+    {
+        return nullptr;
+    }
+
     static bool set_size(void* container, std::size_t size)
     {
         return false;
@@ -0,0 +1,92 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_METHOD_INVOKER_IMPL_H_
+#define RTTR_TYPED_METHOD_INVOKER_IMPL_H_
+
+#include <utility>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE typed_method_invoker<R(Args...)>::typed_method_invoker() RTTR_NOEXCEPT
+:   m_access{nullptr, nullptr}
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE typed_method_invoker<R(Args...)>::typed_method_invoker(const detail::typed_method_access<R(Args...)>& access) RTTR_NOEXCEPT
+:   m_access(access)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE bool typed_method_invoker<R(Args...)>::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_access.m_invoke != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE typed_method_invoker<R(Args...)>::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_access.m_invoke != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE R typed_method_invoker<R(Args...)>::operator()(Args... args) const
+{
+    return m_access.m_invoke(m_access.m_func, std::forward<Args>(args)...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Signature>
+RTTR_INLINE typed_method_invoker<Signature> method::get_invoker() const RTTR_NOEXCEPT
+{
+    const auto items = detail::typed_invoke_signature<Signature>::get_items();
+    detail::typed_method_access<Signature> access = {nullptr, nullptr};
+    get_typed_invoker(items.data(), items.size(), &access);
+    return typed_method_invoker<Signature>(access);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_TYPED_METHOD_INVOKER_IMPL_H_
@@ -0,0 +1,127 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_PROPERTY_ACCESSOR_IMPL_H_
+#define RTTR_TYPED_PROPERTY_ACCESSOR_IMPL_H_
+
+#include "rttr/type.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE typed_property_accessor<Class_Type, T>::typed_property_accessor() RTTR_NOEXCEPT
+:   m_access{nullptr, nullptr, nullptr, nullptr, nullptr}
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE typed_property_accessor<Class_Type, T>::typed_property_accessor(const detail::typed_property_access<Class_Type, T>& access) RTTR_NOEXCEPT
+:   m_access(access)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE bool typed_property_accessor<Class_Type, T>::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_access.m_getter != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE typed_property_accessor<Class_Type, T>::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_access.m_getter != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE bool typed_property_accessor<Class_Type, T>::is_readonly() const RTTR_NOEXCEPT
+{
+    return (m_access.m_setter == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE T typed_property_accessor<Class_Type, T>::get_value(const Class_Type& object) const
+{
+    return m_access.m_getter(m_access.m_getter_data, object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE bool typed_property_accessor<Class_Type, T>::has_reference() const RTTR_NOEXCEPT
+{
+    return (m_access.m_reference != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE const T& typed_property_accessor<Class_Type, T>::get_reference(const Class_Type& object) const
+{
+    return m_access.m_reference(m_access.m_getter_data, object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE bool typed_property_accessor<Class_Type, T>::set_value(Class_Type& object, const T& value) const
+{
+    if (!m_access.m_setter)
+        return false;
+
+    m_access.m_setter(m_access.m_setter_data, object, value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Class_Type, typename T>
+RTTR_INLINE typed_property_accessor<Class_Type, T> property::get_accessor() const RTTR_NOEXCEPT
+{
+    detail::typed_property_access<Class_Type, T> access = {nullptr, nullptr, nullptr, nullptr, nullptr};
+    get_typed_access(type::get<Class_Type>(), type::get<T>(), &access);
+    return typed_property_accessor<Class_Type, T>(access);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_TYPED_PROPERTY_ACCESSOR_IMPL_H_
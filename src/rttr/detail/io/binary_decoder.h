@@ -0,0 +1,847 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_DECODER_H_
+#define RTTR_BINARY_DECODER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/io/binary_format.h"
+#include "rttr/detail/io/binary_schema.h"
+#include "rttr/detail/io/chunked_stream.h"
+#include "rttr/detail/io/serialization_plan.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns `false`, when it is known already, that the stream \p stream has less than \p size bytes left;
+ * it is used to reject corrupt sizes, before memory is allocated for them.
+ */
+RTTR_INLINE bool has_bytes(const memory_input_stream& stream, uint64_t size)
+{
+    return stream.has_bytes(size);
+}
+
+RTTR_INLINE bool has_bytes(const chunked_input_stream&, uint64_t)
+{
+    return true;
+}
+
+/*!
+ * Returns the number of bytes or elements out of \p size, which are allocated at first for a string or container.
+ *
+ * The remaining size of a chunked stream is unknown; so a string or container grows only while its data arrives,
+ * otherwise a corrupt size could allocate an arbitrary amount of memory.
+ */
+RTTR_INLINE std::size_t get_initial_size(const memory_input_stream&, std::size_t size)
+{
+    return size; // the size was checked already with has_bytes()
+}
+
+RTTR_INLINE std::size_t get_initial_size(const chunked_input_stream&, std::size_t size)
+{
+    return std::min(size, binary_allocation_step);
+}
+
+/*!
+ * Returns the next size of a string or container of the final size \p size, which has the size \p current now.
+ */
+RTTR_INLINE std::size_t get_next_size(std::size_t current, std::size_t size)
+{
+    return current + std::min(size - current, current);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads objects in the binary format described in "binary_format.h" from a stream,
+ * which provides the member functions `Take()`, `eof()`, `Tell()` and `read(char*, std::size_t)`.
+ *
+ * An object, whose schema has the fingerprint of the plan of the target object, is read directly by that plan;
+ * otherwise by a \ref remap_plan "remapping plan". Values, which have no target, are skipped.
+ *
+ * Every read function returns `false`, when the data is truncated or malformed; this includes objects and containers,
+ * which are nested deeper than \ref binary_max_depth, so crafted data cannot exhaust the stack.
+ */
+template<typename Stream>
+class binary_decoder
+{
+    public:
+        /*!
+         * Creates a decoder, which reads from the current position of \p stream and records
+         * the schema definitions it meets in \p schemas.
+         */
+        binary_decoder(Stream& stream, schema_table& schemas)
+        :   m_stream(stream), m_schemas(schemas)
+        {
+        }
+
+        //! Reads the magic bytes and the version of the format.
+        bool read_header()
+        {
+            char magic[sizeof(binary_magic)];
+            uint8_t version = 0;
+            return (m_stream.read(magic, sizeof(magic)) == sizeof(magic) &&
+                    std::memcmp(magic, binary_magic, sizeof(magic)) == 0 &&
+                    read_byte(version) && version == binary_version);
+        }
+
+        bool read_document(const instance& obj_in)
+        {
+            if (!read_header())
+                return false;
+
+            const instance obj = get_object(obj_in);
+            if (!obj.is_valid())
+                return false;
+
+            stream_schema* schema = nullptr;
+            if (!read_schema(schema) || !schema)
+                return false;
+
+            return read_fields(obj, *schema, get_type_plan(obj.get_derived_type()));
+        }
+
+        /*!
+         * Reads an object into \p obj; its values are skipped, when \p obj is not valid.
+         */
+        bool read_object(const instance& obj)
+        {
+            return read_object(get_object(obj), nullptr);
+        }
+
+        static instance get_object(const instance& obj)
+        {
+            return (obj.get_type().get_raw_type().is_wrapper() ? obj.get_wrapped_instance() : obj);
+        }
+
+        // the following functions read or skip single values; they are used to find values without reading them
+
+        bool read_byte(uint8_t& value)
+        {
+            if (m_stream.eof())
+                return false;
+
+            value = static_cast<uint8_t>(m_stream.Take());
+            return true;
+        }
+
+        bool read_kind(field_kind& kind)
+        {
+            uint8_t value = 0;
+            if (!read_byte(value) || value > static_cast<uint8_t>(field_kind::OTHER))
+                return false;
+
+            kind = static_cast<field_kind>(value);
+            return true;
+        }
+
+        /*!
+         * Reads the kind of the elements of a sequential container and the padding in front of them.
+         */
+        bool read_element_kind(field_kind& kind)
+        {
+            return (read_kind(kind) && skip_bytes(get_padding(m_stream.Tell(), get_fixed_width(kind))));
+        }
+
+        bool read_varint(uint64_t& value)
+        {
+            value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7)
+            {
+                uint8_t byte = 0;
+                if (!read_byte(byte))
+                    return false;
+
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        /*!
+         * Reads a size, which is followed by at least \p size bytes.
+         */
+        bool read_size(uint64_t& size)
+        {
+            return (read_varint(size) && has_bytes(m_stream, size));
+        }
+
+        bool skip_bytes(uint64_t size)
+        {
+            if (!has_bytes(m_stream, size))
+                return false;
+
+            char buffer[256];
+            while (size > 0)
+            {
+                const std::size_t count = static_cast<std::size_t>(std::min<uint64_t>(size, sizeof(buffer)));
+                if (m_stream.read(buffer, count) != count)
+                    return false;
+
+                size -= count;
+            }
+
+            return true;
+        }
+
+        template<typename T>
+        bool read_fixed(T& value)
+        {
+            char buffer[sizeof(T)];
+            if (m_stream.read(buffer, sizeof(T)) != sizeof(T))
+                return false;
+
+            swap_to_little_endian(buffer, sizeof(T));
+            std::memcpy(&value, buffer, sizeof(T));
+            return true;
+        }
+
+        template<typename T>
+        enable_if_t<std::is_signed<T>::value, bool> read_integer(T& value, bool fixed_width)
+        {
+            if (fixed_width)
+                return read_fixed(value);
+
+            uint64_t encoded = 0;
+            if (!read_varint(encoded))
+                return false;
+
+            const int64_t decoded = zigzag_decode(encoded);
+            if (decoded < std::numeric_limits<T>::min() || decoded > std::numeric_limits<T>::max())
+                return false;
+
+            value = static_cast<T>(decoded);
+            return true;
+        }
+
+        template<typename T>
+        enable_if_t<std::is_unsigned<T>::value, bool> read_integer(T& value, bool fixed_width)
+        {
+            if (fixed_width)
+                return read_fixed(value);
+
+            uint64_t decoded = 0;
+            if (!read_varint(decoded) || decoded > std::numeric_limits<T>::max())
+                return false;
+
+            value = static_cast<T>(decoded);
+            return true;
+        }
+
+        template<typename T>
+        bool read_byte_value(variant& var)
+        {
+            uint8_t value = 0;
+            if (!read_byte(value))
+                return false;
+
+            var = static_cast<T>(value);
+            return true;
+        }
+
+        template<typename T>
+        bool read_integer_value(variant& var, bool fixed_width)
+        {
+            T value = 0;
+            if (!read_integer(value, fixed_width))
+                return false;
+
+            var = value;
+            return true;
+        }
+
+        template<typename T>
+        bool read_fixed_value(variant& var)
+        {
+            T value = 0;
+            if (!read_fixed(value))
+                return false;
+
+            var = value;
+            return true;
+        }
+
+        bool read_string(std::string& text)
+        {
+            uint64_t size = 0;
+            if (!read_size(size))
+                return false;
+
+            const auto count = static_cast<std::size_t>(size);
+            text.clear();
+            for (std::size_t end = get_initial_size(m_stream, count); text.size() < count; end = get_next_size(end, count))
+            {
+                const std::size_t begin = text.size();
+                text.resize(end);
+                if (m_stream.read(&text[begin], end - begin) != end - begin)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /*!
+         * Reads a value of the scalar kind \p kind and converts it to \p target_type.
+         * When the value cannot be converted (e.g. an unknown enumerator), \p var stays invalid.
+         */
+        bool read_scalar(field_kind kind, const type& target_type, bool fixed_width, variant& var)
+        {
+            if (!decode_scalar(kind, fixed_width, var))
+                return false;
+
+            if (var.get_type() != target_type && !var.convert(target_type))
+                var = variant();
+
+            return true;
+        }
+
+        /*!
+         * Reads a value of the scalar kind \p kind; enumerations are read as `int64_t`, other types as `std::string`.
+         */
+        bool decode_scalar(field_kind kind, bool fixed_width, variant& var)
+        {
+            switch (kind)
+            {
+                case field_kind::BOOL:
+                {
+                    uint8_t value = 0;
+                    if (!read_byte(value))
+                        return false;
+
+                    var = (value != 0);
+                    return true;
+                }
+                case field_kind::CHAR:   return read_byte_value<char>(var);
+                case field_kind::INT8:   return read_byte_value<int8_t>(var);
+                case field_kind::UINT8:  return read_byte_value<uint8_t>(var);
+                case field_kind::INT16:  return read_integer_value<int16_t>(var, fixed_width);
+                case field_kind::INT32:  return read_integer_value<int32_t>(var, fixed_width);
+                case field_kind::INT64:  return read_integer_value<int64_t>(var, fixed_width);
+                case field_kind::UINT16: return read_integer_value<uint16_t>(var, fixed_width);
+                case field_kind::UINT32: return read_integer_value<uint32_t>(var, fixed_width);
+                case field_kind::UINT64: return read_integer_value<uint64_t>(var, fixed_width);
+                case field_kind::FLOAT:  return read_fixed_value<float>(var);
+                case field_kind::DOUBLE: return read_fixed_value<double>(var);
+                case field_kind::ENUM:   return read_integer_value<int64_t>(var, false);
+                case field_kind::STRING:
+                case field_kind::OTHER:
+                {
+                    std::string text;
+                    if (!read_string(text))
+                        return false;
+
+                    var = std::move(text);
+                    return true;
+                }
+                case field_kind::SEQUENTIAL:
+                case field_kind::ASSOCIATIVE:
+                case field_kind::OBJECT:
+                {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /*!
+         * Skips a value of kind \p kind.
+         */
+        bool skip_value(field_kind kind, bool fixed_width)
+        {
+            const std::size_t width = get_fixed_width(kind);
+            switch (kind)
+            {
+                case field_kind::BOOL:
+                case field_kind::CHAR:
+                case field_kind::INT8:
+                case field_kind::UINT8:
+                case field_kind::FLOAT:
+                case field_kind::DOUBLE:
+                {
+                    return skip_bytes(std::max<std::size_t>(width, 1));
+                }
+                case field_kind::INT16:
+                case field_kind::INT32:
+                case field_kind::INT64:
+                case field_kind::UINT16:
+                case field_kind::UINT32:
+                case field_kind::UINT64:
+                case field_kind::ENUM:
+                {
+                    uint64_t value = 0;
+                    return ((fixed_width && width > 0) ? skip_bytes(width) : read_varint(value));
+                }
+                case field_kind::STRING:
+                case field_kind::OTHER:
+                {
+                    uint64_t size = 0;
+                    return (read_varint(size) && skip_bytes(size));
+                }
+                case field_kind::SEQUENTIAL:
+                case field_kind::ASSOCIATIVE:
+                case field_kind::OBJECT:
+                {
+                    return skip_compound(kind);
+                }
+            }
+
+            return false;
+        }
+
+        bool skip_elements(field_kind kind, uint64_t size)
+        {
+            const std::size_t width = get_fixed_width(kind);
+            if (width > 0)
+                return (size <= std::numeric_limits<uint64_t>::max() / width && skip_bytes(size * width));
+
+            for (uint64_t index = 0; index < size; ++index)
+            {
+                if (!skip_value(kind, true))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool skip_pairs(field_kind key_kind, field_kind value_kind, bool has_value, uint64_t size)
+        {
+            for (uint64_t index = 0; index < size; ++index)
+            {
+                if (!skip_value(key_kind, false) || (has_value && !skip_value(value_kind, false)))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool skip_fields(const stream_schema& schema)
+        {
+            for (const auto& field : schema.m_schema.m_fields)
+            {
+                if (!skip_value(field.m_kind, false))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool read_pair_kinds(field_kind& key_kind, field_kind& value_kind, bool& has_value)
+        {
+            uint8_t value = 0;
+            if (!read_kind(key_kind) || !read_byte(value))
+                return false;
+
+            has_value = (value != binary_no_kind);
+            if (!has_value)
+                return true;
+            if (value > static_cast<uint8_t>(field_kind::OTHER))
+                return false;
+
+            value_kind = static_cast<field_kind>(value);
+            return true;
+        }
+
+        /*!
+         * Reads the reference to a schema; \p schema is set to `nullptr` for a null object.
+         */
+        bool read_schema(stream_schema*& schema)
+        {
+            const uint64_t position = m_stream.Tell();
+            uint64_t reference = 0;
+            if (!read_varint(reference))
+                return false;
+
+            if (reference == binary_null_object)
+            {
+                schema = nullptr;
+                return true;
+            }
+
+            if (reference != binary_new_schema)
+            {
+                if (reference - 2 >= m_schemas.size())
+                    return false;
+
+                schema = &m_schemas.get(static_cast<std::size_t>(reference - 2));
+                return true;
+            }
+
+            if (stream_schema* known = m_schemas.find(position))
+            {
+                // the definition was read before; it is only passed
+                wire_schema definition;
+                schema = known;
+                return read_schema_definition(definition);
+            }
+
+            schema = &m_schemas.add(position);
+            return read_schema_definition(schema->m_schema);
+        }
+
+        /*!
+         * Reads the definition of a schema; it is rejected, when its fingerprint does not match its fields.
+         */
+        bool read_schema_definition(wire_schema& schema)
+        {
+            uint64_t count = 0;
+            if (!read_fixed(schema.m_fingerprint) || !read_size(count) || count > binary_max_schema_fields)
+                return false;
+
+            schema.m_fields.clear();
+            fingerprint_builder builder;
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                // a field is appended only after its data arrived, so a corrupt count allocates no memory up front
+                wire_field field;
+                if (!read_string(field.m_name) || !read_kind(field.m_kind))
+                    return false;
+
+                builder.add_field(field.m_name, field.m_kind);
+                schema.m_fields.push_back(std::move(field));
+            }
+
+            // the fingerprint selects the plan to read the fields with, so it has to match the fields
+            return (builder.get_fingerprint() == schema.m_fingerprint);
+        }
+
+    private:
+        /*!
+         * Increments the nesting depth of the decoder, while the current object or container is decoded.
+         */
+        class depth_scope
+        {
+            public:
+                explicit depth_scope(std::size_t& depth) : m_depth(depth) { ++m_depth; }
+                ~depth_scope() { --m_depth; }
+
+                //! Returns `false`, when the current value is nested deeper than \ref binary_max_depth.
+                bool is_valid() const { return (m_depth <= binary_max_depth); }
+
+            private:
+                std::size_t& m_depth;
+        };
+
+        bool skip_compound(field_kind kind)
+        {
+            const depth_scope scope(m_depth);
+            if (!scope.is_valid())
+                return false;
+
+            if (kind == field_kind::SEQUENTIAL)
+            {
+                uint64_t size = 0;
+                field_kind element_kind = field_kind::OTHER;
+                if (!read_size(size))
+                    return false;
+
+                return (size == 0 || (read_element_kind(element_kind) && skip_elements(element_kind, size)));
+            }
+            else if (kind == field_kind::ASSOCIATIVE)
+            {
+                uint64_t size = 0;
+                if (!read_size(size))
+                    return false;
+
+                field_kind key_kind = field_kind::OTHER;
+                field_kind value_kind = field_kind::OTHER;
+                bool has_value = false;
+                return (size == 0 || (read_pair_kinds(key_kind, value_kind, has_value) &&
+                                      skip_pairs(key_kind, value_kind, has_value, size)));
+            }
+
+            stream_schema* schema = nullptr;
+            return (read_schema(schema) && (!schema || skip_fields(*schema)));
+        }
+
+        /*!
+         * Reads an object or container of kind `plan.m_kind` into the value \p var in place.
+         */
+        bool read_compound(variant& var, const value_plan& plan)
+        {
+            const depth_scope scope(m_depth);
+            if (!scope.is_valid())
+                return false;
+
+            switch (plan.m_kind)
+            {
+                case field_kind::OBJECT:
+                    return read_object(get_object(var), plan.m_nested);
+                case field_kind::SEQUENTIAL:
+                    return read_sequential_container(var.create_sequential_view());
+                case field_kind::ASSOCIATIVE:
+                    return read_associative_container(var.create_associative_view());
+                default:
+                    return false;
+            }
+        }
+
+        /*!
+         * Reads a new value of type `plan.m_type` from a value of kind \p kind, e.g. a key of an associative container.
+         * When the value cannot be created, it is skipped and \p var stays invalid.
+         */
+        bool read_new_value(field_kind kind, const value_plan& plan, variant& var)
+        {
+            if (is_scalar_kind(kind))
+                return read_scalar(kind, plan.m_type, false, var);
+
+            var = create_value(plan.m_type);
+            if (!var.is_valid())
+                return skip_value(kind, false);
+
+            return read_compound(var, plan);
+        }
+
+        bool read_object(const instance& obj, const type_plan* static_plan)
+        {
+            stream_schema* schema = nullptr;
+            if (!read_schema(schema))
+                return false;
+
+            if (!schema)
+                return true; // a null pointer; the target is left as it is
+
+            if (!obj.is_valid())
+                return skip_fields(*schema); // there is no object, which could be filled
+
+            const type derived_type = obj.get_derived_type();
+            const auto& plan = (static_plan && static_plan->m_type == derived_type) ? *static_plan
+                                                                                   : get_type_plan(derived_type);
+            return read_fields(obj, *schema, plan);
+        }
+
+        bool read_fields(const instance& obj, stream_schema& schema, const type_plan& plan)
+        {
+            if (schema.m_schema.m_fingerprint == plan.m_fingerprint)
+            {
+                for (const auto& field : plan.m_fields)
+                {
+                    if (field.m_serialize && !read_field(obj, field, field.m_value.m_kind))
+                        return false;
+                }
+
+                return true;
+            }
+
+            if (schema.m_plan != &plan)
+            {
+                schema.m_plan = &plan;
+                schema.m_remap = &get_remap_plan(schema.m_schema, plan);
+            }
+
+            for (const auto& field : schema.m_remap->m_fields)
+            {
+                if (field.m_target ? !read_field(obj, *field.m_target, field.m_kind) : !skip_value(field.m_kind, false))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /*!
+         * Reads a value of kind \p kind into the field \p field of the object \p obj.
+         */
+        bool read_field(const instance& obj, const field_plan& field, field_kind kind)
+        {
+            if (field.m_readonly)
+                return skip_value(kind, false);
+
+            variant value;
+            if (!is_scalar_kind(kind))
+            {
+                value = field.get_value(obj);
+                if (!value)
+                    return skip_value(kind, false);
+
+                if (!read_compound(value, field.m_value))
+                    return false;
+
+                if (field.m_by_reference && value.get_type().is_wrapper())
+                    return true; // a 'std::reference_wrapper<T>' to the member object, which was filled in place
+            }
+            else if (!read_scalar(kind, field.m_value.m_type, false, value))
+            {
+                return false;
+            }
+
+            if (value)
+                field.m_prop.set_value(obj, value);
+
+            return true;
+        }
+
+        bool read_sequential_container(variant_sequential_view view)
+        {
+            uint64_t size = 0;
+            field_kind kind = field_kind::OTHER;
+            if (!read_size(size) || (size > 0 && !read_element_kind(kind)))
+                return false;
+
+            const auto plan = get_value_plan(view.get_value_type());
+            const auto count = static_cast<std::size_t>(size);
+            std::size_t end = (view.is_dynamic() ? get_initial_size(m_stream, count) : count);
+            if ((size > 0 && !is_compatible_kind(kind, plan.m_kind)) ||
+                (!view.set_size(end) && view.get_size() != end))
+            {
+                return skip_elements(kind, size); // the container is left as it is
+            }
+
+            for (std::size_t begin = 0; begin < count; begin = end, end = get_next_size(end, count))
+            {
+                if ((begin > 0 && !view.set_size(end)) || !read_elements(view, kind, plan, begin, end))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /*!
+         * Reads the elements of kind \p kind with the indices [\p begin, \p end) of the sequential container \p view.
+         */
+        bool read_elements(variant_sequential_view& view, field_kind kind, const value_plan& plan,
+                           std::size_t begin, std::size_t end)
+        {
+#if RTTR_ENDIAN == RTTR_ENDIAN_LITTLE
+            const std::size_t width = get_fixed_width(kind);
+            if (width > 0 && kind == plan.m_kind)
+            {
+                if (void* data = view.get_data_address())
+                {
+                    const std::size_t size = (end - begin) * width;
+                    return (m_stream.read(static_cast<char*>(data) + begin * width, size) == size);
+                }
+            }
+#endif
+
+            const bool scalar = is_scalar_kind(kind);
+            for (std::size_t index = begin; index < end; ++index)
+            {
+                variant value;
+                if (!scalar)
+                {
+                    // holds a 'std::reference_wrapper<T>' to the element, so it is filled in place
+                    value = view.get_value(index);
+                    if (!value || !read_compound(value, plan))
+                        return false;
+
+                    if (value.get_type().is_wrapper())
+                        continue;
+                }
+                else if (!read_scalar(kind, plan.m_type, true, value))
+                {
+                    return false;
+                }
+
+                if (value)
+                    view.set_value(index, value);
+            }
+
+            return true;
+        }
+
+        bool read_associative_container(variant_associative_view view)
+        {
+            uint64_t size = 0;
+            if (!read_size(size))
+                return false;
+
+            if (size == 0)
+            {
+                view.clear();
+                return true;
+            }
+
+            field_kind key_kind = field_kind::OTHER;
+            field_kind value_kind = field_kind::OTHER;
+            bool has_value = false;
+            if (!read_pair_kinds(key_kind, value_kind, has_value))
+                return false;
+
+            const auto key_plan = get_value_plan(view.get_key_type());
+            const bool target_has_value = view.get_value_type().is_valid();
+            const auto value_plan = target_has_value ? get_value_plan(view.get_value_type()) : key_plan;
+            if (has_value != target_has_value || !is_compatible_kind(key_kind, key_plan.m_kind) ||
+                (has_value && !is_compatible_kind(value_kind, value_plan.m_kind)))
+            {
+                return skip_pairs(key_kind, value_kind, has_value, size); // the container is left as it is
+            }
+
+            view.clear();
+            for (uint64_t index = 0; index < size; ++index)
+            {
+                variant key;
+                if (!read_new_value(key_kind, key_plan, key))
+                    return false;
+
+                if (has_value)
+                {
+                    variant value;
+                    if (!read_new_value(value_kind, value_plan, value))
+                        return false;
+
+                    if (key && value)
+                        view.insert(key, value);
+                }
+                else if (key)
+                {
+                    view.insert(key);
+                }
+            }
+
+            return true;
+        }
+
+    private:
+        Stream&         m_stream;
+        //! All schemas defined so far in the stream.
+        schema_table&   m_schemas;
+        //! The number of objects and containers, which enclose the current value.
+        std::size_t     m_depth = 0;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_DECODER_H_
@@ -0,0 +1,232 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_FORMAT_H_
+#define RTTR_BINARY_FORMAT_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/io/serialization_plan.h"
+#include "rttr/string_view.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The binary format starts with the magic bytes and the version of the format.
+ *
+ * The root object follows. An object starts with a varint reference to its schema: `0` denotes a null pointer,
+ * `1` the definition of a new schema, `n` the (n-2)th defined schema. A schema is defined only once per stream,
+ * as fingerprint (8 bytes) and the number of fields, followed by the name and kind of every field (see \ref wire_schema).
+ * The values of the fields follow in the order of the schema.
+ *
+ * Values are encoded by their \ref field_kind:
+ *  - `bool`, `char`, `int8_t` and `uint8_t` as one byte
+ *  - signed integers as zigzag encoded varints, unsigned integers as varints
+ *  - `float` and `double` as 4 and 8 bytes in little endian byte order
+ *  - strings as varint length followed by the bytes; other types as the string of \ref variant::to_string()
+ *  - enumerations as zigzag encoded varint of their underlying value
+ *  - sequential containers as varint size, followed by the kind of the elements and the elements, when it is not empty;
+ *    arithmetic elements have their fixed width in little endian byte order, so they form one contiguous block,
+ *    which is preceded by zero bytes up to the next multiple of the width (counted from the start of the stream);
+ *    so the block can be used in place as array, when the stream is loaded at an aligned address
+ *  - associative containers as varint size, followed by the kinds of the keys and values
+ *    (\ref binary_no_kind for sets) and every key with its value, when it is not empty
+ */
+static const char binary_magic[4] = {'R', 'T', 'T', 'B'};
+static const uint8_t binary_version = 3;
+
+//! The kind of the values of associative containers without values, e.g. `std::set<T>`.
+static const uint8_t binary_no_kind = 0xff;
+
+//! The schema references of an object; larger values refer to the (n-2)th schema of the stream.
+static const uint64_t binary_null_object = 0;
+static const uint64_t binary_new_schema = 1;
+
+//! The maximum number of bytes of a varint encoded 64 bit value.
+static const std::size_t max_varint_size = 10;
+
+//! The maximum number of fields of a schema; a larger number in a stream is treated as corrupt.
+static const uint64_t binary_max_schema_fields = 0xffff;
+
+//! The maximum nesting depth of objects and containers; deeper values are treated as corrupt.
+static const std::size_t binary_max_depth = 256;
+
+//! The number of bytes or elements, which are allocated at once, when the remaining size of the input is unknown.
+static const std::size_t binary_allocation_step = 64 * 1024;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE uint64_t zigzag_encode(int64_t value) RTTR_NOEXCEPT
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+RTTR_INLINE int64_t zigzag_decode(uint64_t value) RTTR_NOEXCEPT
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes \p value as varint into \p buffer, which has room for \ref max_varint_size bytes.
+ *
+ * \return The number of written bytes.
+ */
+RTTR_INLINE std::size_t encode_varint(uint64_t value, char* buffer) RTTR_NOEXCEPT
+{
+    std::size_t size = 0;
+    while (value >= 0x80)
+    {
+        buffer[size++] = static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    buffer[size++] = static_cast<char>(value);
+    return size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Converts the bytes of an arithmetic value between the byte order of the host and little endian.
+ */
+RTTR_INLINE void swap_to_little_endian(char* data, std::size_t size) RTTR_NOEXCEPT
+{
+#if RTTR_ENDIAN == RTTR_ENDIAN_BIG
+    std::reverse(data, data + size);
+#else
+    (void)data;
+    (void)size;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the number of bytes of an arithmetic value of kind \p kind, which can be copied
+ * as it is between memory and the byte stream; otherwise `0`.
+ *
+ * \remark A `bool` is always decoded separately, because not every byte is a valid `bool` object.
+ */
+RTTR_INLINE std::size_t get_fixed_width(field_kind kind) RTTR_NOEXCEPT
+{
+    switch (kind)
+    {
+        case field_kind::CHAR:
+        case field_kind::INT8:
+        case field_kind::UINT8:     return 1;
+        case field_kind::INT16:
+        case field_kind::UINT16:    return 2;
+        case field_kind::INT32:
+        case field_kind::UINT32:
+        case field_kind::FLOAT:     return 4;
+        case field_kind::INT64:
+        case field_kind::UINT64:
+        case field_kind::DOUBLE:    return 8;
+        default:                    return 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the number of padding bytes in front of a block of arithmetic values of \p width bytes,
+ * which starts at the stream position \p position.
+ */
+RTTR_INLINE std::size_t get_padding(uint64_t position, std::size_t width) RTTR_NOEXCEPT
+{
+    return (width > 1 ? static_cast<std::size_t>((width - position % width) % width) : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * An output stream, which appends all bytes to a string.
+ */
+class string_output_stream
+{
+    public:
+        explicit string_output_stream(std::string& str) : m_str(str) { }
+
+        void Put(char c) { m_str.push_back(c); }
+        void write(const char* data, std::size_t size) { m_str.append(data, size); }
+        std::size_t Tell() const { return m_str.size(); }
+
+    private:
+        std::string& m_str;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * An input stream over a block of memory; it provides the same interface as \ref chunked_input_stream.
+ */
+class memory_input_stream
+{
+    public:
+        explicit memory_input_stream(string_view data)
+        :   m_begin(data.data()), m_current(data.data()), m_end(data.data() + data.size())
+        {
+        }
+
+        char Take() { return (m_current < m_end ? *m_current++ : '\0'); }
+        bool eof() const { return (m_current == m_end); }
+        std::size_t Tell() const { return static_cast<std::size_t>(m_current - m_begin); }
+
+        //! Continues reading at the position \p position, which is not behind the end of the input.
+        void seek(std::size_t position) { m_current = m_begin + position; }
+
+        std::size_t read(char* data, std::size_t size)
+        {
+            size = std::min(size, static_cast<std::size_t>(m_end - m_current));
+            std::memcpy(data, m_current, size);
+            m_current += size;
+            return size;
+        }
+
+        //! Returns `false`, when the input has less than \p size bytes left.
+        bool has_bytes(uint64_t size) const { return (size <= static_cast<uint64_t>(m_end - m_current)); }
+
+    private:
+        const char* m_begin;
+        const char* m_current;
+        const char* m_end;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_FORMAT_H_
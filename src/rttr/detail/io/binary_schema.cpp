@@ -0,0 +1,107 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/io/binary_schema.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The table of all built remapping plans, indexed by the fingerprint of the schema and the id of the reader type.
+ */
+class remap_plan_table
+{
+    public:
+        const remap_plan& get_remap_plan(const wire_schema& schema, const type_plan& plan)
+        {
+            const auto key = std::make_pair(schema.m_fingerprint, plan.m_type.get_id());
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto itr = m_plans.find(key);
+            if (itr == m_plans.end())
+                itr = m_plans.emplace(key, build(schema, plan)).first;
+
+            return *itr->second;
+        }
+
+    private:
+        static std::unique_ptr<remap_plan> build(const wire_schema& schema, const type_plan& plan)
+        {
+            std::unique_ptr<remap_plan> result(new remap_plan);
+            result->m_fields.reserve(schema.m_fields.size());
+
+            std::size_t hint = 0;
+            for (const auto& field : schema.m_fields)
+            {
+                const field_plan* target = plan.find_field(field.m_name, hint);
+                if (target && (!target->m_serialize || !is_compatible_kind(field.m_kind, target->m_value.m_kind)))
+                    target = nullptr;
+
+                result->m_fields.push_back(remap_field{field.m_kind, target});
+            }
+
+            return result;
+        }
+
+    private:
+        std::mutex                                                              m_mutex;
+        std::map<std::pair<uint64_t, type::type_id>, std::unique_ptr<remap_plan>>  m_plans;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+remap_plan_table& get_remap_plan_table()
+{
+    static remap_plan_table table;
+    return table;
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const remap_plan& get_remap_plan(const wire_schema& schema, const type_plan& plan)
+{
+    return get_remap_plan_table().get_remap_plan(schema, plan);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
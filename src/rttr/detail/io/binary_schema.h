@@ -0,0 +1,161 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_SCHEMA_H_
+#define RTTR_BINARY_SCHEMA_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/io/serialization_plan.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * One field of a \ref wire_schema.
+ */
+struct wire_field
+{
+    std::string m_name;
+    field_kind  m_kind;
+};
+
+/*!
+ * The schema of an object type as it was written into a binary stream, i.e. the serialized fields of
+ * the \ref type_plan of the writer in their order.
+ */
+struct wire_schema
+{
+    uint64_t                m_fingerprint;
+    std::vector<wire_field> m_fields;
+};
+
+/*!
+ * Describes how one field of a \ref wire_schema is read.
+ */
+struct remap_field
+{
+    //! The kind of the field in the stream.
+    field_kind          m_kind;
+    //! The field of the reader, which receives the value; `nullptr`, when the value is skipped.
+    const field_plan*   m_target;
+};
+
+/*!
+ * Maps the fields of a \ref wire_schema to the fields of a \ref type_plan, which has a different fingerprint.
+ *
+ * Fields are matched by name. A field is skipped, when the reader has no such field anymore or when
+ * its kind cannot be converted; e.g. an object cannot be read into an integer, but an `int32_t` into a `double`.
+ * Fields of the reader, which are not in the schema, keep their current value.
+ */
+struct remap_plan
+{
+    std::vector<remap_field> m_fields;
+};
+
+/*!
+ * A schema, which was defined in a binary stream; with the remapping plan for the last used reader type.
+ */
+struct stream_schema
+{
+    wire_schema         m_schema;
+    const type_plan*    m_plan;
+    const remap_plan*   m_remap;
+};
+
+/*!
+ * The schemas defined in one binary stream, in the order of their definition.
+ *
+ * A reader, which jumps back to values it has passed before (see \ref io::binary_document),
+ * meets a definition more than once; so every schema is recorded with the stream position of its definition.
+ */
+class schema_table
+{
+    public:
+        std::size_t size() const { return m_schemas.size(); }
+
+        stream_schema& get(std::size_t index) { return m_schemas[index]; }
+
+        //! Returns the schema defined at the stream position \p position; `nullptr`, when it was not read so far.
+        stream_schema* find(uint64_t position)
+        {
+            const auto itr = std::lower_bound(m_positions.begin(), m_positions.end(), position);
+            if (itr == m_positions.end() || *itr != position)
+                return nullptr;
+
+            return &m_schemas[static_cast<std::size_t>(itr - m_positions.begin())];
+        }
+
+        //! Adds the empty schema defined at \p position, which is behind the definitions read so far.
+        stream_schema& add(uint64_t position)
+        {
+            m_positions.push_back(position);
+            m_schemas.push_back(stream_schema{wire_schema{0, {}}, nullptr, nullptr});
+            return m_schemas.back();
+        }
+
+    private:
+        //! A deque keeps the addresses of its elements.
+        std::deque<stream_schema>   m_schemas;
+        std::vector<uint64_t>       m_positions;
+};
+
+/*!
+ * Returns `true`, when a value of kind \p kind is not an object or container.
+ */
+RTTR_INLINE bool is_scalar_kind(field_kind kind) RTTR_NOEXCEPT
+{
+    return (kind != field_kind::OBJECT && kind != field_kind::SEQUENTIAL && kind != field_kind::ASSOCIATIVE);
+}
+
+/*!
+ * Returns `true`, when a value of kind \p wire_kind can be read into a value of kind \p target_kind.
+ */
+RTTR_INLINE bool is_compatible_kind(field_kind wire_kind, field_kind target_kind) RTTR_NOEXCEPT
+{
+    return (wire_kind == target_kind || (is_scalar_kind(wire_kind) && is_scalar_kind(target_kind)));
+}
+
+/*!
+ * Returns the remapping plan from the schema \p schema to the plan \p plan.
+ *
+ * The remapping plan is built once for every pair of schema fingerprint and reader type and stored in a table.
+ * This function is thread safe.
+ */
+RTTR_LOCAL const remap_plan& get_remap_plan(const wire_schema& schema, const type_plan& plan);
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_SCHEMA_H_
@@ -0,0 +1,212 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/io/chunked_stream.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+chunked_output_stream::chunked_output_stream(write_func func, void* sink, std::size_t chunk_size)
+:   m_write_func(func),
+    m_sink(sink),
+    m_buffer(std::max<std::size_t>(chunk_size, 1)),
+    m_current(m_buffer.data()),
+    m_end(m_buffer.data() + m_buffer.size()),
+    m_count(0),
+    m_good(true)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void chunked_output_stream::flush_buffer()
+{
+    const auto size = static_cast<std::size_t>(m_current - m_buffer.data());
+    if (size > 0 && m_good)
+        m_good = m_write_func(m_sink, m_buffer.data(), size);
+
+    m_count += size;
+    m_current = m_buffer.data();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void chunked_output_stream::write(const char* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        if (m_current == m_end)
+            flush_buffer();
+
+        const auto count = std::min(size, static_cast<std::size_t>(m_end - m_current));
+        std::memcpy(m_current, data, count);
+        m_current += count;
+        data += count;
+        size -= count;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+chunked_input_stream::chunked_input_stream(read_func func, void* source, std::size_t chunk_size)
+:   m_read_func(func),
+    m_source(source),
+    m_buffer(std::max<std::size_t>(chunk_size, 1) + 1), // one additional byte for the terminating '\0'
+    m_current(m_buffer.data()),
+    m_last(m_buffer.data()),
+    m_count(0),
+    m_read_count(0),
+    m_eof(false)
+{
+    read_chunk();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void chunked_input_stream::read_chunk()
+{
+    m_count += m_read_count;
+    m_read_count = m_read_func(m_source, m_buffer.data(), m_buffer.size() - 1);
+    m_current = m_buffer.data();
+
+    if (m_read_count == 0)
+    {
+        m_buffer[0] = '\0';
+        m_last = m_buffer.data();
+        m_eof = true;
+    }
+    else
+    {
+        m_last = m_buffer.data() + m_read_count - 1;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t chunked_input_stream::read(char* data, std::size_t size)
+{
+    std::size_t result = 0;
+    while (size > 0 && !(m_eof && m_current == m_last))
+    {
+        const auto count = std::min(size, static_cast<std::size_t>(m_last - m_current) + 1);
+        std::memcpy(data, m_current, count);
+        m_current += count - 1;
+        advance();
+        data += count;
+        size -= count;
+        result += count;
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool write_to_ostream(void* sink, const char* data, std::size_t size)
+{
+    auto& out = *static_cast<std::ostream*>(sink);
+    out.write(data, static_cast<std::streamsize>(size));
+    return static_cast<bool>(out);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool write_to_fd(void* sink, const char* data, std::size_t size)
+{
+    const int fd = *static_cast<int*>(sink);
+    while (size > 0)
+    {
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+        const auto written = ::_write(fd, data, static_cast<unsigned int>(size));
+#else
+        const auto written = ::write(fd, data, size);
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t read_from_istream(void* source, char* data, std::size_t size)
+{
+    auto& in = *static_cast<std::istream*>(source);
+    in.read(data, static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(in.gcount());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t read_from_fd(void* source, char* data, std::size_t size)
+{
+    const int fd = *static_cast<int*>(source);
+    for (;;)
+    {
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+        const auto count = ::_read(fd, data, static_cast<unsigned int>(size));
+#else
+        const auto count = ::read(fd, data, size);
+#endif
+        if (count < 0 && errno == EINTR)
+            continue;
+
+        return (count > 0 ? static_cast<std::size_t>(count) : 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
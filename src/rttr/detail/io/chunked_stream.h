@@ -0,0 +1,171 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_CHUNKED_STREAM_H_
+#define RTTR_CHUNKED_STREAM_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <vector>
+#include <iosfwd>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A byte output stream, which collects the written characters in a buffer of fixed size
+ * and hands over the whole buffer to a sink function, as soon as it is full.
+ *
+ * The member functions `Put()` and `Flush()` fulfill the output stream concept of rapidjson.
+ */
+class RTTR_LOCAL chunked_output_stream
+{
+    public:
+        using Ch = char;
+        //! Writes \p size bytes; returns `false` when not all bytes could be written.
+        using write_func = bool(*)(void* sink, const char* data, std::size_t size);
+
+        chunked_output_stream(write_func func, void* sink, std::size_t chunk_size);
+
+        void Put(Ch c)
+        {
+            if (m_current == m_end)
+                flush_buffer();
+
+            *m_current++ = c;
+        }
+
+        void Flush() { flush_buffer(); }
+
+        /*!
+         * Writes the \p size bytes of \p data.
+         */
+        void write(const char* data, std::size_t size);
+
+        //! Returns the number of bytes written so far.
+        std::size_t Tell() const { return m_count + static_cast<std::size_t>(m_current - m_buffer.data()); }
+
+        /*!
+         * Returns `true` as long as every chunk could be written by the sink function.
+         */
+        bool good() const RTTR_NOEXCEPT { return m_good; }
+
+    private:
+        void flush_buffer();
+
+    private:
+        write_func          m_write_func;
+        void*               m_sink;
+        std::vector<char>   m_buffer;
+        char*               m_current;
+        char*               m_end;
+        std::size_t         m_count;
+        bool                m_good;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A byte input stream, which fills a buffer of fixed size by calling a source function;
+ * the next chunk is only read, when all characters of the current one were consumed.
+ * The end of the input is reported with the character `'\0'`.
+ *
+ * The member functions `Peek()`, `Take()` and `Tell()` fulfill the input stream concept of rapidjson.
+ */
+class RTTR_LOCAL chunked_input_stream
+{
+    public:
+        using Ch = char;
+        //! Reads up to \p size bytes; returns the number of read bytes, `0` indicates the end of the input.
+        using read_func = std::size_t(*)(void* source, char* data, std::size_t size);
+
+        chunked_input_stream(read_func func, void* source, std::size_t chunk_size);
+
+        Ch Peek() const { return *m_current; }
+
+        Ch Take()
+        {
+            Ch c = *m_current;
+            advance();
+            return c;
+        }
+
+        std::size_t Tell() const { return m_count + static_cast<std::size_t>(m_current - m_buffer.data()); }
+
+        //! Returns `true` when every byte of the input was consumed.
+        bool eof() const { return m_eof; }
+
+        /*!
+         * Reads \p size bytes into \p data.
+         *
+         * \return The number of read bytes, which is less than \p size only at the end of the input.
+         */
+        std::size_t read(char* data, std::size_t size);
+
+        // not used for reading; but required by the stream concept
+        Ch* PutBegin() { return nullptr; }
+        void Put(Ch) { }
+        void Flush() { }
+        std::size_t PutEnd(Ch*) { return 0; }
+
+    private:
+        void advance()
+        {
+            if (m_current < m_last)
+                ++m_current;
+            else if (!m_eof)
+                read_chunk();
+        }
+
+        void read_chunk();
+
+    private:
+        read_func           m_read_func;
+        void*               m_source;
+        std::vector<char>   m_buffer;
+        char*               m_current;
+        char*               m_last;
+        std::size_t         m_count;
+        std::size_t         m_read_count;
+        bool                m_eof;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_LOCAL bool write_to_ostream(void* sink, const char* data, std::size_t size);
+RTTR_LOCAL bool write_to_fd(void* sink, const char* data, std::size_t size);
+
+RTTR_LOCAL std::size_t read_from_istream(void* source, char* data, std::size_t size);
+RTTR_LOCAL std::size_t read_from_fd(void* source, char* data, std::size_t size);
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CHUNKED_STREAM_H_
@@ -0,0 +1,253 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/io/serialization_plan.h"
+
+#include "rttr/constructor.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+field_kind get_field_kind(const type& t) RTTR_NOEXCEPT
+{
+    if (t.is_arithmetic())
+    {
+        if (t == type::get<bool>())
+            return field_kind::BOOL;
+        else if (t == type::get<char>())
+            return field_kind::CHAR;
+        else if (t == type::get<int8_t>())
+            return field_kind::INT8;
+        else if (t == type::get<int16_t>())
+            return field_kind::INT16;
+        else if (t == type::get<int32_t>())
+            return field_kind::INT32;
+        else if (t == type::get<int64_t>())
+            return field_kind::INT64;
+        else if (t == type::get<uint8_t>())
+            return field_kind::UINT8;
+        else if (t == type::get<uint16_t>())
+            return field_kind::UINT16;
+        else if (t == type::get<uint32_t>())
+            return field_kind::UINT32;
+        else if (t == type::get<uint64_t>())
+            return field_kind::UINT64;
+        else if (t == type::get<float>())
+            return field_kind::FLOAT;
+        else if (t == type::get<double>())
+            return field_kind::DOUBLE;
+    }
+    else if (t.is_enumeration())
+    {
+        return field_kind::ENUM;
+    }
+    else if (t == type::get<std::string>())
+    {
+        return field_kind::STRING;
+    }
+    else if (t.is_sequential_container())
+    {
+        return field_kind::SEQUENTIAL;
+    }
+    else if (t.is_associative_container())
+    {
+        return field_kind::ASSOCIATIVE;
+    }
+    else if (!t.get_raw_type().get_properties().empty())
+    {
+        return field_kind::OBJECT;
+    }
+
+    return field_kind::OTHER;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Computes the fingerprint of the serialized fields of \p plan.
+ */
+uint64_t compute_fingerprint(const type_plan& plan) RTTR_NOEXCEPT
+{
+    fingerprint_builder builder;
+    for (const auto& field : plan.m_fields)
+    {
+        if (field.m_serialize)
+            builder.add_field(field.m_name, field.m_value.m_kind);
+    }
+
+    return builder.get_fingerprint();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The table of all compiled plans, indexed by the id of the type.
+ */
+class type_plan_table
+{
+    public:
+        const type_plan& get_type_plan(const type& t)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return compile(t.get_raw_type());
+        }
+
+        value_plan get_value_plan(const type& t)
+        {
+            const type value_type = t.is_wrapper() ? t.get_wrapped_type() : t;
+            const field_kind kind = get_field_kind(value_type);
+            if (kind != field_kind::OBJECT)
+                return value_plan{value_type, kind, nullptr};
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return value_plan{value_type, kind, &compile(value_type.get_raw_type())};
+        }
+
+    private:
+        value_plan make_value_plan(const type& t)
+        {
+            const type value_type = t.is_wrapper() ? t.get_wrapped_type() : t;
+            const field_kind kind = get_field_kind(value_type);
+            return value_plan{value_type, kind, (kind == field_kind::OBJECT ? &compile(value_type.get_raw_type()) : nullptr)};
+        }
+
+        const type_plan& compile(const type& raw_type)
+        {
+            const std::size_t id = raw_type.get_id();
+            if (id < m_plans.size() && m_plans[id])
+                return *m_plans[id];
+
+            if (id >= m_plans.size())
+                m_plans.resize(id + 1);
+
+            // the plan is stored before its fields are compiled, so a type can refer to itself
+            m_plans[id].reset(new type_plan{raw_type, {}, 0});
+            type_plan& plan = *m_plans[id];
+
+            for (const auto& prop : raw_type.get_properties())
+            {
+                const bool serialize = !prop.get_metadata("NO_SERIALIZE");
+                const type prop_type = prop.get_type();
+                const bool by_reference = !prop_type.is_pointer() && !prop_type.is_wrapper() && !prop.is_array();
+                plan.m_fields.push_back(field_plan{prop, prop.get_name(), make_value_plan(prop_type), serialize,
+                                                   prop.is_readonly(), by_reference});
+            }
+
+            plan.m_fingerprint = compute_fingerprint(plan);
+
+            return plan;
+        }
+
+    private:
+        std::mutex                                  m_mutex;
+        std::vector<std::unique_ptr<type_plan>>     m_plans;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type_plan_table& get_type_plan_table()
+{
+    static type_plan_table table;
+    return table;
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const field_plan* type_plan::find_field(string_view name, std::size_t& hint) const RTTR_NOEXCEPT
+{
+    const std::size_t count = m_fields.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t index = (hint + i < count) ? hint + i : hint + i - count;
+        if (m_fields[index].m_name == name)
+        {
+            hint = index + 1;
+            return &m_fields[index];
+        }
+    }
+
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant field_plan::get_value(const instance& obj) const
+{
+    if (m_by_reference)
+    {
+        variant value = m_prop.get_reference(obj);
+        if (value)
+            return value;
+    }
+
+    return m_prop.get_value(obj); // e.g. a getter function
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const type_plan& get_type_plan(const type& t)
+{
+    return get_type_plan_table().get_type_plan(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+value_plan get_value_plan(const type& t)
+{
+    return get_type_plan_table().get_value_plan(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant create_value(const type& t)
+{
+    for (const auto& ctor : t.get_constructors())
+    {
+        if (ctor.get_instanciated_type() == t && ctor.get_parameter_infos().empty())
+            return ctor.invoke();
+    }
+
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
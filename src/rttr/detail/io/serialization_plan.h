@@ -0,0 +1,182 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_SERIALIZATION_PLAN_H_
+#define RTTR_SERIALIZATION_PLAN_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+#include "rttr/string_view.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The kind of a serialized value; determines, how the value is read or written.
+ *
+ * \remark The values are stored in the binary format, new kinds have to be appended.
+ */
+enum class field_kind : uint8_t
+{
+    BOOL,
+    CHAR,
+    INT8,
+    INT16,
+    INT32,
+    INT64,
+    UINT8,
+    UINT16,
+    UINT32,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    STRING,
+    ENUM,
+    SEQUENTIAL,
+    ASSOCIATIVE,
+    OBJECT,
+    OTHER
+};
+
+struct type_plan;
+
+/*!
+ * Describes how a value of one type is serialized.
+ */
+struct value_plan
+{
+    //! The type of the value, when it is stored in a wrapper (e.g. `std::reference_wrapper<T>`), the wrapped type.
+    type                m_type;
+    field_kind          m_kind;
+    //! The plan of the raw type of an \ref field_kind::OBJECT "object", otherwise `nullptr`.
+    const type_plan*    m_nested;
+};
+
+/*!
+ * Describes how one property of a class is serialized.
+ */
+struct field_plan
+{
+    property            m_prop;
+    string_view         m_name;
+    value_plan          m_value;
+    //! `false` for properties with the metadata `"NO_SERIALIZE"`.
+    bool                m_serialize;
+    //! `true` for read only properties; their values are skipped, when a document is read.
+    bool                m_readonly;
+    //! `true`, when the value can be accessed by reference, i.e. it is neither a pointer nor a wrapper.
+    bool                m_by_reference;
+
+    /*!
+     * Returns the value of this field in \p obj: a `std::reference_wrapper` to it, when the property refers
+     * to a member object, so the value is neither copied nor has to be set afterwards; otherwise a copy.
+     */
+    variant get_value(const instance& obj) const;
+};
+
+/*!
+ * A serialization plan contains all public properties of a class type, resolved once to a list of fields.
+ *
+ * Every field knows already its kind and the plan of its nested object, so a serializer
+ * does not need to query the properties or the type of a value for every object again.
+ */
+struct type_plan
+{
+    type                    m_type;
+    std::vector<field_plan> m_fields;
+    //! A stable hash of the names and kinds of all serialized fields; equal fingerprints denote the same schema.
+    uint64_t                m_fingerprint;
+
+    /*!
+     * Returns the field with the name \p name or `nullptr`.
+     * The search starts at the position \p hint, i.e. the field after the previous found one.
+     */
+    const field_plan* find_field(string_view name, std::size_t& hint) const RTTR_NOEXCEPT;
+};
+
+/*!
+ * Computes the fingerprint of a schema field by field: the FNV-1a hash of the name, a zero byte and the kind
+ * of every serialized field. The hash does not depend on the compiler or the type ids, so it is stable across processes.
+ */
+class fingerprint_builder
+{
+    public:
+        void add_field(string_view name, field_kind kind) RTTR_NOEXCEPT
+        {
+            for (const char c : name)
+                add_byte(static_cast<uint8_t>(c));
+
+            add_byte(0);
+            add_byte(static_cast<uint8_t>(kind));
+        }
+
+        uint64_t get_fingerprint() const RTTR_NOEXCEPT { return m_hash; }
+
+    private:
+        void add_byte(uint8_t byte) RTTR_NOEXCEPT
+        {
+            m_hash ^= byte;
+            m_hash *= 1099511628211ull;
+        }
+
+        uint64_t m_hash = 14695981039346656037ull;
+};
+
+/*!
+ * Returns the serialization plan of the class type \p t.
+ *
+ * The plan is compiled on the first use and stored in a table indexed by the id of the type.
+ * This function is thread safe.
+ *
+ * \remark Properties, which are registered after the first use of a plan, are not part of it.
+ */
+RTTR_LOCAL const type_plan& get_type_plan(const type& t);
+
+/*!
+ * Returns the value plan of values of type \p t; its nested plan is compiled on demand.
+ */
+RTTR_LOCAL value_plan get_value_plan(const type& t);
+
+/*!
+ * Creates a value of type \p t with one of its registered default constructors,
+ * which returns the object by value (see \ref policy::ctor::as_object).
+ *
+ * \return The created value; an invalid variant, when there is no such constructor.
+ */
+RTTR_LOCAL variant create_value(const type& t);
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_SERIALIZATION_PLAN_H_
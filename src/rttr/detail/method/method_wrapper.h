@@ -33,6 +33,7 @@
 #include "rttr/detail/misc/function_traits.h"
 #include "rttr/detail/type/accessor_type.h"
 #include "rttr/detail/method/method_accessor.h"
+#include "rttr/detail/method/typed_method_invoke.h"
 #include "rttr/detail/default_arguments/default_arguments.h"
 #include "rttr/detail/default_arguments/invoke_with_defaults.h"
 #include "rttr/detail/parameter_info/parameter_infos.h"
@@ -119,6 +120,11 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<Param
             return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
         }
 
+        bool get_typed_invoker(const signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT
+        {
+            return typed_method_invoke<F>::assign(m_func_acc, items, count, access);
+        }
+
     private:
         F  m_func_acc;
         parameter_infos<Param_Args...> m_param_infos;
@@ -200,6 +206,11 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
                 return variant();
         }
 
+        bool get_typed_invoker(const signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT
+        {
+            return typed_method_invoke<F>::assign(m_func_acc, items, count, access);
+        }
+
     private:
         F                               m_func_acc;
         default_args<Default_Args...>   m_def_args;
@@ -268,6 +279,11 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<>, Me
             return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
         }
 
+        bool get_typed_invoker(const signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT
+        {
+            return typed_method_invoke<F>::assign(m_func_acc, items, count, access);
+        }
+
     private:
         F  m_func_acc;
 };
@@ -343,6 +359,11 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
                 return variant();
         }
 
+        bool get_typed_invoker(const signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT
+        {
+            return typed_method_invoke<F>::assign(m_func_acc, items, count, access);
+        }
+
     private:
         F                               m_func_acc;
         default_args<Default_Args...>   m_def_args;
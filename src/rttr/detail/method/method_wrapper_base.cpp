@@ -230,6 +230,13 @@ variant method_wrapper_base::invoke_variadic(const instance& object, std::vector
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool method_wrapper_base::get_typed_invoker(const signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 
 } // end namespace detail
 } // end namespace rttr
@@ -48,6 +48,7 @@ class instance;
 
 namespace detail
 {
+struct signature_item;
 
 /*!
  * Abstract class for a method.
@@ -86,6 +87,8 @@ class RTTR_API method_wrapper_base
                                argument& arg4, argument& arg5, argument& arg6) const;
 
         virtual variant invoke_variadic(const instance& object, std::vector<argument>& args) const;
+
+        virtual bool get_typed_invoker(const signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT;
     protected:
         void init() RTTR_NOEXCEPT;
     private:
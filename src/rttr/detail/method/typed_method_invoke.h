@@ -0,0 +1,163 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_METHOD_INVOKE_H_
+#define RTTR_TYPED_METHOD_INVOKE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/function_traits.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/type.h"
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * Describes one type of a function signature.
+ *
+ * \ref type::get<T>() ignores references and top level cv-qualifiers,
+ * so these are stored separately; two items are equal when they describe the same C++ type.
+ */
+struct signature_item
+{
+    type            m_type;
+    unsigned int    m_qualifiers;
+};
+
+RTTR_INLINE bool operator==(const signature_item& lhs, const signature_item& rhs) RTTR_NOEXCEPT
+{
+    return (lhs.m_type == rhs.m_type && lhs.m_qualifiers == rhs.m_qualifiers);
+}
+
+template<typename T>
+RTTR_INLINE signature_item make_signature_item() RTTR_NOEXCEPT
+{
+    using non_ref_type = remove_reference_t<T>;
+    return signature_item{type::get<T>(), (std::is_lvalue_reference<T>::value  ? 1u : 0u) |
+                                          (std::is_rvalue_reference<T>::value  ? 2u : 0u) |
+                                          (std::is_const<non_ref_type>::value  ? 4u : 0u) |
+                                          (std::is_volatile<non_ref_type>::value ? 8u : 0u)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The signature `R(Args...)` of a \ref typed_method_invoker.
+ *
+ * A member function `R (C::*)(Args...)` is invoked with the signature `R(C&, Args...)`.
+ */
+template<typename Signature>
+struct typed_invoke_signature;
+
+template<typename R, typename... Args>
+struct typed_invoke_signature<R(Args...)>
+{
+    using invoke_func = R (*)(const void* func, Args... args);
+
+    static std::array<signature_item, sizeof...(Args) + 1> get_items() RTTR_NOEXCEPT
+    {
+        return {{make_signature_item<R>(), make_signature_item<Args>()...}};
+    }
+};
+
+/*!
+ * The type erased state of a \ref typed_method_invoker.
+ *
+ * \p m_func points to the function object stored inside the method wrapper.
+ */
+template<typename Signature>
+struct typed_method_access
+{
+    const void*                                             m_func;
+    typename typed_invoke_signature<Signature>::invoke_func m_invoke;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename Method_Type, typename Arg_Types>
+struct typed_method_invoke_impl;
+
+template<typename F, typename... Args>
+struct typed_method_invoke_impl<F, std::true_type, std::tuple<Args...>>
+{
+    using return_type   = typename function_traits<F>::return_type;
+    using class_type    = typename function_traits<F>::class_type;
+    using signature     = return_type(class_type&, Args...);
+
+    static return_type invoke(const void* func, class_type& object, Args... args)
+    {
+        return (object.*(*static_cast<const F*>(func)))(std::forward<Args>(args)...);
+    }
+};
+
+template<typename F, typename... Args>
+struct typed_method_invoke_impl<F, std::false_type, std::tuple<Args...>>
+{
+    using return_type   = typename function_traits<F>::return_type;
+    using signature     = return_type(Args...);
+
+    static return_type invoke(const void* func, Args... args)
+    {
+        return (*static_cast<const F*>(func))(std::forward<Args>(args)...);
+    }
+};
+
+/*!
+ * Fills a \ref typed_method_access object for the function \p func, when the requested signature
+ * is exactly the signature of \p func.
+ */
+template<typename F>
+struct typed_method_invoke
+{
+    using impl = typed_method_invoke_impl<F, typename std::is_member_function_pointer<F>::type,
+                                          typename function_traits<F>::arg_types>;
+    using signature = typename impl::signature;
+
+    static bool assign(const F& func, const signature_item* items, std::size_t count, void* access) RTTR_NOEXCEPT
+    {
+        const auto own_items = typed_invoke_signature<signature>::get_items();
+        if (count != own_items.size() || !std::equal(own_items.begin(), own_items.end(), items))
+            return false;
+
+        *static_cast<typed_method_access<signature>*>(access) = typed_method_access<signature>{&func, &impl::invoke};
+        return true;
+    }
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_METHOD_INVOKE_H_
@@ -0,0 +1,145 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_APPEND_ONLY_VECTOR_H_
+#define RTTR_APPEND_ONLY_VECTOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <vector>
+#include <initializer_list>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The append_only_vector class is a contiguous array, which can be read without any locking,
+ *        while another thread appends new items.
+ *
+ * Appending items (\ref push_back) has to be synchronized by the caller.
+ * When the capacity is exhausted, the items are copied into a new buffer, which is then published.
+ * The old buffer is kept alive until the vector is destroyed, so a reader which still holds a pointer
+ * to it will not access freed memory. Because the capacity grows geometric, the retained buffers
+ * need at most the same amount of memory like the current one.
+ *
+ * Only trivially destructible item types are supported, the items are never modified after they were appended.
+ */
+template<typename T>
+class append_only_vector
+{
+    static_assert(std::is_trivially_destructible<T>::value, "The item type has to be trivially destructible.");
+
+public:
+    append_only_vector() : m_data(nullptr), m_size(0), m_capacity(0) {}
+
+    append_only_vector(std::initializer_list<T> items) : append_only_vector()
+    {
+        for (const auto& item : items)
+            push_back(item);
+    }
+
+    append_only_vector(const append_only_vector&) = delete;
+    append_only_vector& operator=(const append_only_vector&) = delete;
+
+    /*!
+     * \brief Appends the given \p item at the end.
+     *
+     * \remark This function is not thread safe, calls to it have to be serialized.
+     */
+    void push_back(const T& item)
+    {
+        const auto size = m_size.load(std::memory_order_relaxed);
+        if (size == m_capacity)
+            grow();
+
+        ::new (m_data.load(std::memory_order_relaxed) + size) T(item);
+        m_size.store(size + 1, std::memory_order_release);
+    }
+
+    /*!
+     * \brief Returns the number of items.
+     */
+    std::size_t size() const RTTR_NOEXCEPT { return m_size.load(std::memory_order_acquire); }
+
+    /*!
+     * \brief Returns true when no items are stored.
+     */
+    bool empty() const RTTR_NOEXCEPT { return (size() == 0); }
+
+    /*!
+     * \brief Returns a pointer to the underlying buffer and writes the number of items,
+     *        which can be safely accessed through it, into \p size.
+     *
+     * The size is read before the buffer, so the buffer contains always at least \p size items.
+     */
+    const T* data(std::size_t& size) const RTTR_NOEXCEPT
+    {
+        size = m_size.load(std::memory_order_acquire);
+        return m_data.load(std::memory_order_acquire);
+    }
+
+    const T& operator[](std::size_t index) const RTTR_NOEXCEPT { return m_data.load(std::memory_order_acquire)[index]; }
+
+private:
+    struct buffer_deleter
+    {
+        void operator()(T* ptr) const { ::operator delete(ptr); }
+    };
+
+    void grow()
+    {
+        const auto new_capacity = (m_capacity == 0) ? std::size_t(16) : m_capacity * 2;
+        std::unique_ptr<T, buffer_deleter> new_buffer(static_cast<T*>(::operator new(new_capacity * sizeof(T))));
+
+        const auto old_buffer = m_data.load(std::memory_order_relaxed);
+        const auto size = m_size.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < size; ++i)
+            ::new (new_buffer.get() + i) T(old_buffer[i]);
+
+        m_data.store(new_buffer.get(), std::memory_order_release);
+        m_buffer_list.push_back(std::move(new_buffer));
+        m_capacity = new_capacity;
+    }
+
+private:
+    std::atomic<T*>                                 m_data;
+    std::atomic<std::size_t>                        m_size;
+    std::size_t                                     m_capacity;
+    std::vector<std::unique_ptr<T, buffer_deleter>> m_buffer_list;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_APPEND_ONLY_VECTOR_H_
@@ -0,0 +1,219 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_CONCURRENT_STRING_MAP_H_
+#define RTTR_CONCURRENT_STRING_MAP_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/string_view.h"
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The concurrent_string_map class is an open-addressing hash table, which maps a string to a value.
+ *
+ * A lookup (\ref find) needs no locking and can run, while another thread modifies the map.
+ * All modifying functions (\ref insert, \ref erase) have to be synchronized by the caller.
+ *
+ * Every key/value pair is stored in its own immutable entry, the table contains only pointers to these entries.
+ * The key is stored as view, so the referenced string has to outlive its entry in the map.
+ * Erased entries and replaced tables are not freed before the map is destroyed,
+ * so a concurrent reader will never access freed memory.
+ */
+template<typename Value>
+class concurrent_string_map
+{
+    struct entry
+    {
+        std::size_t m_hash_value;
+        string_view m_key;
+        Value       m_value;
+    };
+
+    struct table
+    {
+        explicit table(std::size_t capacity)
+        :   m_mask(capacity - 1),
+            m_slots(new std::atomic<const entry*>[capacity])
+        {
+            for (std::size_t i = 0; i < capacity; ++i)
+                m_slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        std::size_t                                     m_mask;
+        std::unique_ptr<std::atomic<const entry*>[]>    m_slots;
+    };
+
+public:
+    concurrent_string_map()
+    :   m_table(nullptr),
+        m_used_slots(0),
+        m_size(0)
+    {
+        rehash(16);
+    }
+
+    concurrent_string_map(const concurrent_string_map&) = delete;
+    concurrent_string_map& operator=(const concurrent_string_map&) = delete;
+
+    /*!
+     * \brief Returns a pointer to the value, which is stored for the given \p key; otherwise a nullptr.
+     */
+    const Value* find(string_view key) const RTTR_NOEXCEPT
+    {
+        const auto hash_value = generate_hash(key.data(), key.size());
+        const table* tbl = m_table.load(std::memory_order_acquire);
+        for (std::size_t pos = hash_value & tbl->m_mask; ; pos = (pos + 1) & tbl->m_mask)
+        {
+            const entry* item = tbl->m_slots[pos].load(std::memory_order_acquire);
+            if (!item)
+                return nullptr;
+
+            if (item != get_erased_entry() && item->m_hash_value == hash_value && item->m_key == key)
+                return &item->m_value;
+        }
+    }
+
+    /*!
+     * \brief Inserts the given \p value with the given \p key.
+     *        When there is already a value for \p key, nothing will be done.
+     *
+     * \return True, when the value was inserted; otherwise false.
+     */
+    bool insert(string_view key, Value value)
+    {
+        if (find(key))
+            return false;
+
+        // a load factor of maximum 50% (including erased slots) keeps the probe sequences short
+        if ((m_used_slots + 1) * 2 > capacity())
+            rehash(m_size + 1);
+
+        const auto hash_value = generate_hash(key.data(), key.size());
+        m_entry_list.emplace_back(new entry{hash_value, key, std::move(value)});
+        insert_entry(*m_table.load(std::memory_order_relaxed), m_entry_list.back().get());
+        ++m_used_slots;
+        ++m_size;
+        return true;
+    }
+
+    /*!
+     * \brief Removes the value for the given \p key.
+     */
+    void erase(string_view key)
+    {
+        const auto hash_value = generate_hash(key.data(), key.size());
+        const table* tbl = m_table.load(std::memory_order_relaxed);
+        for (std::size_t pos = hash_value & tbl->m_mask; ; pos = (pos + 1) & tbl->m_mask)
+        {
+            auto& slot = tbl->m_slots[pos];
+            const entry* item = slot.load(std::memory_order_relaxed);
+            if (!item)
+                return;
+
+            if (item != get_erased_entry() && item->m_hash_value == hash_value && item->m_key == key)
+            {
+                // the slot cannot be cleared, otherwise the probe sequence of other keys could be interrupted
+                slot.store(get_erased_entry(), std::memory_order_release);
+                --m_size;
+                return;
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns the number of stored values.
+     */
+    std::size_t size() const RTTR_NOEXCEPT { return m_size; }
+
+private:
+    //! A marker for an erased slot; only the address is used, it is never dereferenced.
+    static const entry* get_erased_entry() RTTR_NOEXCEPT
+    {
+        static const typename std::aligned_storage<sizeof(entry), std::alignment_of<entry>::value>::type erased_entry = {};
+        return reinterpret_cast<const entry*>(&erased_entry);
+    }
+
+    std::size_t capacity() const RTTR_NOEXCEPT { return (m_table.load(std::memory_order_relaxed)->m_mask + 1); }
+
+    static void insert_entry(const table& tbl, const entry* item)
+    {
+        std::size_t pos = item->m_hash_value & tbl.m_mask;
+        while (tbl.m_slots[pos].load(std::memory_order_relaxed) != nullptr)
+            pos = (pos + 1) & tbl.m_mask;
+
+        tbl.m_slots[pos].store(item, std::memory_order_release);
+    }
+
+    void rehash(std::size_t min_size)
+    {
+        std::size_t new_capacity = 16;
+        while (new_capacity < min_size * 4)
+            new_capacity <<= 1;
+
+        std::unique_ptr<table> new_table(new table(new_capacity));
+        std::size_t used_slots = 0;
+        if (const table* old_table = m_table.load(std::memory_order_relaxed))
+        {
+            for (std::size_t i = 0; i <= old_table->m_mask; ++i)
+            {
+                const entry* item = old_table->m_slots[i].load(std::memory_order_relaxed);
+                if (item && item != get_erased_entry())
+                {
+                    insert_entry(*new_table, item);
+                    ++used_slots;
+                }
+            }
+        }
+
+        m_table.store(new_table.get(), std::memory_order_release);
+        m_table_list.push_back(std::move(new_table));
+        m_used_slots = used_slots;
+    }
+
+private:
+    std::atomic<const table*>               m_table;
+    std::size_t                             m_used_slots;
+    std::size_t                             m_size;
+    std::vector<std::unique_ptr<entry>>     m_entry_list;
+    std::vector<std::unique_ptr<table>>     m_table_list;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CONCURRENT_STRING_MAP_H_
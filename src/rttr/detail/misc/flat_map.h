@@ -36,7 +36,7 @@
 #include <utility>
 #include <functional>
 #include <algorithm>
-#include <ciso646> // _LIBCPP_VERSION
+#include <numeric>
 
 namespace rttr
 {
@@ -46,6 +46,11 @@ namespace detail
 /*!
  * \brief The flat_map class implements a simple map based on std::vector instead of a binary tree.
  *
+ * New items are appended at the end of the list and are not sorted immediately.
+ * Only when the number of these unsorted items exceeds the square root of the total size,
+ * they are merged into the sorted part of the list. A lookup performs a binary search in the sorted part
+ * and a linear search (by comparing the hash values) in the unsorted part.
+ * This way, inserting many items (e.g. during the registration of types) does not require a sort for every insertion.
  */
 template<typename Key, typename Value, template<class> class Hash = std::hash, typename Compare = std::equal_to<Key>>
 class flat_map
@@ -83,7 +88,7 @@ class flat_map
         using hash_type = std::size_t;
 
 
-        flat_map() {}
+        flat_map() : m_sorted_count(0) {}
 
     private:
         using has_type = Hash<Key>;
@@ -115,97 +120,96 @@ class flat_map
                 return;
 
             m_key_list.push_back(key_data_type{std::move(key), has_type()(key)});
-            std::stable_sort(m_key_list.begin(), m_key_list.end(), typename key_data_type::order());
+            m_value_list.push_back(std::move(value));
 
-            auto found_key = find_key_const(key);
-            if (found_key != m_key_list.cend())
-            {
-                const auto index = std::distance(m_key_list.cbegin(), found_key);
-                m_value_list.insert(m_value_list.begin() + index, std::move(value));
-            }
+            if (m_key_list.size() - m_sorted_count > get_max_unsorted_count())
+                sort();
         }
 
         template<typename T>
         const_iterator find(const T& key) const
         {
-            const auto hash_value = Hash<T>()(key);
-            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
-                                        hash_value,
-                                        typename key_data_type::order());
-            for (; itr != m_key_list.end(); ++itr)
-            {
-                auto& item = *itr;
-                if (item.m_hash_value != hash_value)
-                    break;
-
-                if (item.m_key == key)
-                    return (m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr));;
-            }
-            return m_value_list.cend();
+            const auto index = find_index(key, Hash<T>()(key), [](const Key& left, const T& right) { return (left == right); });
+            return (index != npos) ? (m_value_list.cbegin() + index) : m_value_list.cend();
         }
 
         iterator find(const Key& key)
         {
-            const auto itr = find_key_const(key);
-            if (itr != m_key_list.end())
-                return (m_value_list.begin() + std::distance(m_key_list.cbegin(), itr));
-            else
-                return (m_value_list.end());
+            const auto index = find_index(key, has_type()(key), Compare());
+            return (index != npos) ? (m_value_list.begin() + index) : m_value_list.end();
         }
 
         const_iterator find(const Key& key) const
         {
-            const auto itr = find_key_const(key);
-            if (itr != m_key_list.end())
-                return (m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr));
-            else
-                return (m_value_list.cend());
+            const auto index = find_index(key, has_type()(key), Compare());
+            return (index != npos) ? (m_value_list.cbegin() + index) : m_value_list.cend();
         }
-#ifdef _LIBCPP_VERSION
-#   if _LIBCPP_VERSION <= 3700
-#       define RTTR_NO_CXX11_CONST_EREASE_SUPPORT_IN_STL 1
-#   endif
-#elif (RTTR_COMPILER == RTTR_COMPILER_GNUC && RTTR_COMP_VER < 4900)
-#   define RTTR_NO_CXX11_CONST_EREASE_SUPPORT_IN_STL 1
-#endif
-
-// older versions of gcc stl, have no support for const_iterator in std::vector<T>::erase(const_iterator)
-#if RTTR_NO_CXX11_CONST_EREASE_SUPPORT_IN_STL
+
         void erase(const Key& key)
         {
-            iterator_key itr = find_key(key);
-            if (itr != m_key_list.end())
-            {
-                auto value_itr = m_value_list.begin() + std::distance(m_key_list.begin(), itr);
-                if (value_itr != m_value_list.end())
-                {
-                    m_key_list.erase(itr);
-                    m_value_list.erase(value_itr);
-                }
-            }
+            const auto index = find_index(key, has_type()(key), Compare());
+            if (index == npos)
+                return;
+
+            m_key_list.erase(m_key_list.begin() + index);
+            m_value_list.erase(m_value_list.begin() + index);
 
+            // removing an item does not change the order of the remaining items
+            if (index < m_sorted_count)
+                --m_sorted_count;
         }
-#else
-        void erase(const Key& key)
+
+        /*!
+         * \brief Merges all unsorted items into the sorted part of the list.
+         */
+        void sort()
         {
-            const_iterator_key itr = find_key_const(key);
-            if (itr != m_key_list.end())
+            if (m_sorted_count == m_key_list.size())
+                return;
+
+            std::vector<std::size_t> unsorted_index_list(m_key_list.size() - m_sorted_count);
+            std::iota(unsorted_index_list.begin(), unsorted_index_list.end(), m_sorted_count);
+            std::stable_sort(unsorted_index_list.begin(), unsorted_index_list.end(),
+                             [this](std::size_t left, std::size_t right)
+                             { return (m_key_list[left].m_hash_value < m_key_list[right].m_hash_value); });
+
+            std::vector<key_data_type> key_list;
+            std::vector<Value> value_list;
+            key_list.reserve(m_key_list.size());
+            value_list.reserve(m_value_list.size());
+
+            // merge both sorted ranges; for equal hash values the already sorted item comes first,
+            // that is the same order a stable sort of the whole list would create
+            std::size_t sorted_index = 0;
+            auto unsorted_itr = unsorted_index_list.cbegin();
+            while (sorted_index < m_sorted_count || unsorted_itr != unsorted_index_list.cend())
             {
-                auto value_itr = m_value_list.cbegin() + std::distance(m_key_list.cbegin(), itr);
-                if (value_itr != m_value_list.cend())
+                std::size_t index;
+                if (unsorted_itr == unsorted_index_list.cend() ||
+                    (sorted_index < m_sorted_count &&
+                     !(m_key_list[*unsorted_itr].m_hash_value < m_key_list[sorted_index].m_hash_value)))
                 {
-                    m_key_list.erase(itr);
-                    m_value_list.erase(value_itr);
+                    index = sorted_index++;
                 }
+                else
+                {
+                    index = *unsorted_itr++;
+                }
+
+                key_list.push_back(std::move(m_key_list[index]));
+                value_list.push_back(std::move(m_value_list[index]));
             }
 
+            m_key_list.swap(key_list);
+            m_value_list.swap(value_list);
+            m_sorted_count = m_key_list.size();
         }
-#endif
 
         void clear()
         {
             m_key_list.clear();
             m_value_list.clear();
+            m_sorted_count = 0;
         }
 
         const std::vector<Value>& value_data() const
@@ -214,46 +218,52 @@ class flat_map
         }
 
     private:
+        static const std::size_t npos = static_cast<std::size_t>(-1);
 
-        const_iterator_key find_key_const(const Key& key) const
+        /*!
+         * The linear search in the unsorted part and the merge of the unsorted items are balanced,
+         * when the number of unsorted items is limited to the square root of the total size.
+         */
+        std::size_t get_max_unsorted_count() const
         {
-            const auto hash_value = has_type()(key);
-            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
-                                        hash_value,
-                                        typename key_data_type::order());
-            for (; itr != m_key_list.end(); ++itr)
-            {
-                auto& item = *itr;
-                if (item.m_hash_value != hash_value)
-                    break;
+            std::size_t max_count = 16;
+            while (max_count * max_count < m_key_list.size())
+                max_count *= 2;
 
-                if (Compare()(item.m_key, key))
-                    return itr;
-            }
-            return m_key_list.end();
+            return max_count;
         }
 
-        iterator_key find_key(const Key& key)
+        template<typename T, typename Equal>
+        std::size_t find_index(const T& key, hash_type hash_value, Equal equal) const
         {
-            const auto hash_value = has_type()(key);
-            auto itr = std::lower_bound(m_key_list.begin(), m_key_list.end(),
+            const auto sorted_end = m_key_list.cbegin() + m_sorted_count;
+            auto itr = std::lower_bound(m_key_list.cbegin(), sorted_end,
                                         hash_value,
                                         typename key_data_type::order());
-            for (; itr != m_key_list.end(); ++itr)
+            for (; itr != sorted_end; ++itr)
             {
                 auto& item = *itr;
                 if (item.m_hash_value != hash_value)
                     break;
 
-                if (Compare()(item.m_key, key))
-                    return itr;
+                if (equal(item.m_key, key))
+                    return static_cast<std::size_t>(std::distance(m_key_list.cbegin(), itr));
             }
-            return m_key_list.end();
+
+            for (auto index = m_sorted_count; index < m_key_list.size(); ++index)
+            {
+                const auto& item = m_key_list[index];
+                if (item.m_hash_value == hash_value && equal(item.m_key, key))
+                    return index;
+            }
+
+            return npos;
         }
 
     private:
         std::vector<key_data_type>  m_key_list;
         std::vector<Value>          m_value_list;
+        std::size_t                 m_sorted_count;
 };
 
 } // end namespace detail
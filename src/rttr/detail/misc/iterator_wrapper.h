@@ -40,7 +40,14 @@ namespace rttr
 namespace detail
 {
 
-using iterator_data = std::aligned_storage<sizeof(double)>::type;
+/*!
+ * The storage of an iterator of \ref variant_sequential_view or \ref variant_associative_view.
+ *
+ * It has the size of \ref RTTR_ITERATOR_INLINE_SIZE bytes, by default this is big enough for the iterators
+ * of all standard containers (including `std::deque`) of the common standard library implementations.
+ * Iterators, which do not fit, are allocated on the heap.
+ */
+using iterator_data = std::aligned_storage<RTTR_ITERATOR_INLINE_SIZE>::type;
 
 template<typename T, bool Can_Place = (sizeof(T) <= sizeof(iterator_data)) &&
                                       (std::alignment_of<T>::value <= std::alignment_of<iterator_data>::value)>
@@ -38,6 +38,7 @@
 #include "rttr/array_mapper.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/detail/property/property_accessor.h"
+#include "rttr/detail/property/typed_property_access.h"
 
 #include <functional>
 
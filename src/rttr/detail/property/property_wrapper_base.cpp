@@ -132,5 +132,19 @@ variant property_wrapper_base::get_value(instance& object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant property_wrapper_base::get_reference(instance& object) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property_wrapper_base::get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
@@ -79,6 +79,11 @@ class RTTR_API property_wrapper_base
 
         virtual variant get_value(instance& object) const;
 
+        //! Returns a variant with a 'std::reference_wrapper' to the value, when it is stored in \p object, otherwise an invalid variant.
+        virtual variant get_reference(instance& object) const;
+
+        virtual bool get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT;
+
     protected:
         void init() RTTR_NOEXCEPT;
 
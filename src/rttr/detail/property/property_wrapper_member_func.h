@@ -83,6 +83,11 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_cop
                 return variant();
         }
 
+        bool get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT
+        {
+            return member_func_typed_access<Getter, Setter>::assign(m_getter, &m_setter, class_type, value_type, access);
+        }
+
     private:
         Getter  m_getter;
         Setter  m_setter;
@@ -133,6 +138,11 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_copy,
                 return variant();
         }
 
+        bool get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT
+        {
+            return member_func_typed_access<Getter, void>::assign(m_getter, nullptr, class_type, value_type, access);
+        }
+
     private:
         Getter  m_getter;
 };
@@ -28,6 +28,22 @@
 #ifndef RTTR_PROPERTY_WRAPPER_MEMBER_OBJECT_H_
 #define RTTR_PROPERTY_WRAPPER_MEMBER_OBJECT_H_
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// returns a variant with a 'std::reference_wrapper' to the member object; arrays are not supported
+
+template<typename A>
+RTTR_INLINE variant create_member_reference(A& value, std::false_type)
+{
+    return variant(std::ref(value));
+}
+
+template<typename A>
+RTTR_INLINE variant create_member_reference(A&, std::true_type)
+{
+    return variant();
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 // pointer to member - read write
@@ -73,6 +89,19 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
                 return variant();
         }
 
+        variant get_reference(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return create_member_reference(ptr->*m_acc, std::is_array<A>());
+            else
+                return variant();
+        }
+
+        bool get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT
+        {
+            return member_object_typed_access<C, A, false>::assign(m_acc, class_type, value_type, access);
+        }
+
     private:
         accessor m_acc;
 };
@@ -119,6 +148,19 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
                 return variant();
         }
 
+        variant get_reference(instance& object) const
+        {
+            if (C* ptr = object.try_convert<C>())
+                return create_member_reference(static_cast<const A&>(ptr->*m_acc), std::is_array<A>());
+            else
+                return variant();
+        }
+
+        bool get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT
+        {
+            return member_object_typed_access<C, A, true>::assign(m_acc, class_type, value_type, access);
+        }
+
     private:
         accessor m_acc;
 };
@@ -0,0 +1,182 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_PROPERTY_ACCESS_H_
+#define RTTR_TYPED_PROPERTY_ACCESS_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/function_traits.h"
+#include "rttr/type.h"
+
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The type erased state of a \ref typed_property_accessor.
+ *
+ * \p m_getter_data and \p m_setter_data point to the member pointer, respectively getter/setter function,
+ * stored inside the property wrapper; the function pointers know how to apply them to an object of type \p Class_Type.
+ * A read only property has no \p m_setter. \p m_reference uses \p m_getter_data as well; it is only available,
+ * when the value is stored in the object, i.e. for a member object pointer or a getter, which returns a reference.
+ */
+template<typename Class_Type, typename T>
+struct typed_property_access
+{
+    using getter_func       = T (*)(const void* data, const Class_Type& object);
+    using setter_func       = void (*)(const void* data, Class_Type& object, const T& value);
+    using reference_func    = const T& (*)(const void* data, const Class_Type& object);
+
+    const void*     m_getter_data;
+    const void*     m_setter_data;
+    getter_func     m_getter;
+    setter_func     m_setter;
+    reference_func  m_reference;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Fills the given \p access object, when \p class_type and \p value_type are the types
+ * \p Class_Type and \p T, the property wrapper was instantiated with.
+ */
+template<typename Class_Type, typename T>
+RTTR_INLINE bool assign_typed_property_access(const type& class_type, const type& value_type, void* access,
+                                              const typed_property_access<Class_Type, T>& src) RTTR_NOEXCEPT
+{
+    if (class_type != type::get<Class_Type>() || value_type != type::get<T>())
+        return false;
+
+    *static_cast<typed_property_access<Class_Type, T>*>(access) = src;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// pointer to member object
+
+template<typename C, typename A, bool Is_Readonly, typename Enable = void>
+struct member_object_typed_access
+{
+    static bool assign(const A(C::* const& acc), const type& class_type, const type& value_type, void* access) RTTR_NOEXCEPT
+    {
+        return false;
+    }
+};
+
+template<typename C, typename A, bool Is_Readonly>
+struct member_object_typed_access<C, A, Is_Readonly, enable_if_t<!std::is_array<A>::value>>
+{
+    using accessor      = A (C::*);
+    using value_type    = typename std::remove_cv<A>::type;
+    using access_type   = typed_property_access<C, value_type>;
+
+    static value_type get_value(const void* data, const C& object)
+    {
+        return (object.*(*static_cast<const accessor*>(data)));
+    }
+
+    static const value_type& get_reference(const void* data, const C& object)
+    {
+        return (object.*(*static_cast<const accessor*>(data)));
+    }
+
+    static void set_value(const void* data, C& object, const value_type& value)
+    {
+        (object.*(*static_cast<const accessor*>(data))) = value;
+    }
+
+    static typename access_type::setter_func get_setter(std::false_type) RTTR_NOEXCEPT { return &set_value; }
+    static typename access_type::setter_func get_setter(std::true_type) RTTR_NOEXCEPT { return nullptr; }
+
+    static bool assign(const accessor& acc, const type& class_type, const type& value_type, void* access) RTTR_NOEXCEPT
+    {
+        const access_type src = { &acc, &acc, &get_value, get_setter(std::integral_constant<bool, Is_Readonly>()), &get_reference };
+        return assign_typed_property_access(class_type, value_type, access, src);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// getter/setter - pointer to member function; a read only property uses 'void' as setter
+
+template<typename Getter, typename Setter, typename Enable = void>
+struct member_func_typed_access
+{
+    static bool assign(const Getter& getter, const Setter* setter, const type& class_type, const type& value_type, void* access) RTTR_NOEXCEPT
+    {
+        return false;
+    }
+};
+
+template<typename Getter, typename Setter>
+struct member_func_typed_access<Getter, Setter,
+                                enable_if_t<!std::is_array<remove_reference_t<typename function_traits<Getter>::return_type>>::value>>
+{
+    using class_type    = typename function_traits<Getter>::class_type;
+    using return_type   = typename function_traits<Getter>::return_type;
+    using value_type    = typename std::remove_cv<remove_reference_t<return_type>>::type;
+    using access_type   = typed_property_access<class_type, value_type>;
+
+    static value_type get_value(const void* data, const class_type& object)
+    {
+        // the getter is not necessarily a const member function
+        return (const_cast<class_type&>(object).*(*static_cast<const Getter*>(data)))();
+    }
+
+    static const value_type& get_reference(const void* data, const class_type& object)
+    {
+        return (const_cast<class_type&>(object).*(*static_cast<const Getter*>(data)))();
+    }
+
+    static typename access_type::reference_func get_reference_func(std::true_type) RTTR_NOEXCEPT { return &get_reference; }
+    static typename access_type::reference_func get_reference_func(std::false_type) RTTR_NOEXCEPT { return nullptr; }
+
+    static void set_value(const void* data, class_type& object, const value_type& value)
+    {
+        (object.*(*static_cast<const Setter*>(data)))(value);
+    }
+
+    static typename access_type::setter_func get_setter(std::false_type) RTTR_NOEXCEPT { return &set_value; }
+    static typename access_type::setter_func get_setter(std::true_type) RTTR_NOEXCEPT { return nullptr; }
+
+    static bool assign(const Getter& getter, const Setter* setter, const type& class_type, const type& value_type, void* access) RTTR_NOEXCEPT
+    {
+        const access_type src = { &getter, setter, &get_value, get_setter(std::is_void<Setter>()),
+                                  get_reference_func(std::is_reference<return_type>()) };
+        return assign_typed_property_access(class_type, value_type, access, src);
+    }
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_PROPERTY_ACCESS_H_
@@ -0,0 +1,125 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_CLASS_ITEM_INDEX_H_
+#define RTTR_CLASS_ITEM_INDEX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/string_view.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The class_item_index class is an open-addressing hash table, which maps the name
+ *        of a class item (property or method) to its position inside the item list of a \ref class_data.
+ *
+ * When several items share the same name (overloaded methods or shadowed properties),
+ * only the first occurrence in the list is stored; that is the same item a linear search would return.
+ * The index has to be rebuild, whenever the corresponding item list was modified.
+ */
+template<typename T>
+class class_item_index
+{
+    struct slot
+    {
+        std::size_t     m_hash_value;
+        std::uint32_t   m_index; // position in the item list plus one, zero marks an empty slot
+    };
+
+public:
+    void rebuild(const std::vector<T>& items)
+    {
+        std::size_t capacity = 8;
+        while (capacity < items.size() * 2)
+            capacity <<= 1;
+
+        m_slots.assign(capacity, slot{0, 0});
+        m_mask = capacity - 1;
+
+        std::uint32_t index = 0;
+        for (const auto& item : items)
+        {
+            ++index;
+            const auto name = item.get_name();
+            const auto hash_value = generate_hash(name.data(), name.size());
+            for (std::size_t pos = hash_value & m_mask; ; pos = (pos + 1) & m_mask)
+            {
+                auto& entry = m_slots[pos];
+                if (entry.m_index == 0)
+                {
+                    entry = slot{hash_value, index};
+                    break;
+                }
+
+                if (entry.m_hash_value == hash_value && items[entry.m_index - 1].get_name() == name)
+                    break; // keep the first item with this name
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns a pointer to the first item in \p items with the given name \p name;
+     *        otherwise a nullptr.
+     */
+    const T* find(string_view name, const std::vector<T>& items) const RTTR_NOEXCEPT
+    {
+        if (m_slots.empty())
+            return nullptr;
+
+        const auto hash_value = generate_hash(name.data(), name.size());
+        for (std::size_t pos = hash_value & m_mask; ; pos = (pos + 1) & m_mask)
+        {
+            const auto& entry = m_slots[pos];
+            if (entry.m_index == 0)
+                return nullptr;
+
+            if (entry.m_hash_value == hash_value)
+            {
+                const auto& item = items[entry.m_index - 1];
+                if (item.get_name() == name)
+                    return &item;
+            }
+        }
+    }
+
+private:
+    std::vector<slot>   m_slots;
+    std::size_t         m_mask = 0;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CLASS_ITEM_INDEX_H_
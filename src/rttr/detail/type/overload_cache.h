@@ -0,0 +1,140 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_OVERLOAD_CACHE_H_
+#define RTTR_OVERLOAD_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief The overload_cache class remembers for a call signature, i.e. a hash key of the name and the argument types,
+ *        the position of the matching item (method or constructor) inside the item list of a \ref class_data.
+ *        So a repeated call with the same argument types, does not need to search the whole list again.
+ *
+ * The cache is a direct mapped table with a fixed size, which will be allocated with the first insert.
+ * Every entry is stored in one 64 bit atomic value, which contains a part of the key hash,
+ * the number of arguments and the index; so it can be read and written from many threads without any lock.
+ * Because different signatures can share the same entry, a found item has to be checked again by the caller.
+ *
+ * The cache has to be cleared, whenever the corresponding item list was modified.
+ */
+class overload_cache
+{
+    static RTTR_CONSTEXPR_OR_CONST std::size_t slot_bits    = 6;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t cache_size   = std::size_t(1) << slot_bits;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t count_bits   = 8;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t index_bits   = 24;
+
+    struct entry_table
+    {
+        std::atomic<std::uint64_t> m_entries[cache_size];
+    };
+
+public:
+    overload_cache() RTTR_NOEXCEPT : m_table(nullptr) {}
+    overload_cache(const overload_cache&) = delete;
+    overload_cache& operator=(const overload_cache&) = delete;
+    ~overload_cache() { delete m_table.load(std::memory_order_relaxed); }
+
+    /*!
+     * \brief Returns true, when an entry for the given \p key and \p arg_count was found;
+     *        \p index contains then the cached value.
+     */
+    bool find(std::size_t key, std::size_t arg_count, std::size_t& index) const RTTR_NOEXCEPT
+    {
+        const auto table = m_table.load(std::memory_order_acquire);
+        if (!table || arg_count >= (std::size_t(1) << count_bits))
+            return false;
+
+        const auto entry = table->m_entries[key & (cache_size - 1)].load(std::memory_order_relaxed);
+        const auto index_mask = (std::uint64_t(1) << index_bits) - 1;
+        if ((entry & ~index_mask) != make_tag(key, arg_count) || (entry & index_mask) == 0)
+            return false;
+
+        index = static_cast<std::size_t>(entry & index_mask) - 1;
+        return true;
+    }
+
+    /*!
+     * \brief Stores the given \p index for the given \p key and \p arg_count.
+     *        An existing entry in the same slot will be overwritten.
+     */
+    void insert(std::size_t key, std::size_t arg_count, std::size_t index)
+    {
+        if (arg_count >= (std::size_t(1) << count_bits) || index + 1 >= (std::size_t(1) << index_bits))
+            return;
+
+        auto table = m_table.load(std::memory_order_acquire);
+        if (!table)
+        {
+            entry_table* new_table = new entry_table(); // zero initialized
+            if (m_table.compare_exchange_strong(table, new_table, std::memory_order_acq_rel))
+                table = new_table;
+            else
+                delete new_table; // another thread was faster, 'table' contains now its table
+        }
+
+        table->m_entries[key & (cache_size - 1)].store(make_tag(key, arg_count) | (index + 1), std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Removes all entries; the allocated table will be kept.
+     */
+    void clear() RTTR_NOEXCEPT
+    {
+        if (auto table = m_table.load(std::memory_order_acquire))
+        {
+            for (auto& entry : table->m_entries)
+                entry.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    static RTTR_INLINE std::uint64_t make_tag(std::size_t key, std::size_t arg_count) RTTR_NOEXCEPT
+    {
+        // the lower bits of the key select the slot, so the upper bits are stored for the comparison
+        const auto key_bits = static_cast<std::uint64_t>(key >> slot_bits) & ((std::uint64_t(1) << (64 - count_bits - index_bits)) - 1);
+        return ((key_bits << (count_bits + index_bits)) | (static_cast<std::uint64_t>(arg_count) << index_bits));
+    }
+
+private:
+    std::atomic<entry_table*> m_table;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_OVERLOAD_CACHE_H_
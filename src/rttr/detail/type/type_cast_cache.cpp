@@ -0,0 +1,151 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/detail/type/type_cast_cache.h"
+#include "rttr/detail/type/type_pair_cache.h"
+
+#include <atomic>
+
+namespace rttr
+{
+namespace detail
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct cache_data
+{
+    type_pair_cache<1024>       m_entries;
+    // the counters are shared by all threads, so they are only written, when the stats are enabled
+    std::atomic<bool>           m_stats_enabled;
+    std::atomic<std::uint64_t>  m_hit_count;
+    std::atomic<std::uint64_t>  m_miss_count;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static cache_data& get_cache_data() RTTR_NOEXCEPT
+{
+    // zero initialized, because of static storage duration
+    static cache_data data;
+    return data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE void increment(const cache_data& data, std::atomic<std::uint64_t>& counter) RTTR_NOEXCEPT
+{
+    if (data.m_stats_enabled.load(std::memory_order_relaxed))
+        counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool type_cast_cache::find(std::size_t src_id, std::size_t tgt_id, std::size_t& index) RTTR_NOEXCEPT
+{
+    auto& data = get_cache_data();
+    if (data.m_entries.find(src_id, tgt_id, index))
+    {
+        increment(data, data.m_hit_count);
+        return true;
+    }
+
+    increment(data, data.m_miss_count);
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_cast_cache::insert(std::size_t src_id, std::size_t tgt_id, std::size_t index) RTTR_NOEXCEPT
+{
+    get_cache_data().m_entries.insert(src_id, tgt_id, index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_cast_cache::clear() RTTR_NOEXCEPT
+{
+    get_cache_data().m_entries.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+cast_cache_stats type_cast_cache::get_stats() RTTR_NOEXCEPT
+{
+    auto& data = get_cache_data();
+    return {data.m_hit_count.load(std::memory_order_relaxed), data.m_miss_count.load(std::memory_order_relaxed)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_cast_cache::reset_stats() RTTR_NOEXCEPT
+{
+    auto& data = get_cache_data();
+    data.m_hit_count.store(0, std::memory_order_relaxed);
+    data.m_miss_count.store(0, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_cast_cache::set_stats_enabled(bool enabled) RTTR_NOEXCEPT
+{
+    get_cache_data().m_stats_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+cast_cache_stats get_cast_cache_stats() RTTR_NOEXCEPT
+{
+    return detail::type_cast_cache::get_stats();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void reset_cast_cache_stats() RTTR_NOEXCEPT
+{
+    detail::type_cast_cache::reset_stats();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void set_cast_cache_stats_enabled(bool enabled) RTTR_NOEXCEPT
+{
+    detail::type_cast_cache::set_stats_enabled(enabled);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,79 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPE_CAST_CACHE_H_
+#define RTTR_TYPE_CAST_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/rttr_cast.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The \ref type_cast_cache class remembers for a pair of (most derived type id, target type id)
+ * the position of the target type inside the base class list of the most derived type.
+ * So a repeated cast between the same two types, does not need to search this list again.
+ *
+ * The cache is a direct mapped table with a fixed size. Every entry is stored in one 64 bit atomic value,
+ * which contains both ids and the index, so it can be read and written without any lock.
+ * Type ids which need more than 24 bits or indices which need more than 16 bits will not be cached.
+ */
+class RTTR_LOCAL type_cast_cache
+{
+public:
+    /*!
+     * \brief Returns true, when an entry for the given type ids was found; \p index contains then the cached value.
+     */
+    static bool find(std::size_t src_id, std::size_t tgt_id, std::size_t& index) RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Stores the given \p index for the type ids \p src_id and \p tgt_id.
+     *        An existing entry in the same slot will be overwritten.
+     */
+    static void insert(std::size_t src_id, std::size_t tgt_id, std::size_t index) RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Removes all entries; this has to be done, when the base class list of a type was modified.
+     */
+    static void clear() RTTR_NOEXCEPT;
+
+    static cast_cache_stats get_stats() RTTR_NOEXCEPT;
+    static void reset_stats() RTTR_NOEXCEPT;
+    static void set_stats_enabled(bool enabled) RTTR_NOEXCEPT;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPE_CAST_CACHE_H_
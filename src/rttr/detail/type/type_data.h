@@ -36,6 +36,9 @@
 #include "rttr/detail/type/get_create_variant_func.h"
 #include "rttr/detail/type/type_register.h"
 #include "rttr/detail/type/type_name.h"
+#include "rttr/detail/type/class_item_index.h"
+#include "rttr/detail/type/overload_cache.h"
+#include "rttr/detail/misc/append_only_vector.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/destructor.h"
 #include "rttr/method.h"
@@ -46,6 +49,7 @@
 
 #include <type_traits>
 #include <bitset>
+#include <atomic>
 
 
 namespace rttr
@@ -75,13 +79,31 @@ struct class_data
 
     get_derived_info_func       m_derived_info_func;
     std::vector<type>           m_base_types;
-    std::vector<type>           m_derived_types;
+    append_only_vector<type>    m_derived_types;
     std::vector<rttr_cast_func> m_conversion_list;
     std::vector<property>       m_properties;
     std::vector<method>         m_methods;
     std::vector<constructor>    m_ctors;
     std::vector<type>           m_nested_types;
     destructor                  m_dtor;
+    class_item_index<property>  m_property_index;
+    class_item_index<method>    m_method_index;
+    //! remembers the method, which was found by type::invoke() for a name and a list of argument types
+    overload_cache              m_method_overload_cache;
+    //! remembers the constructor, which was found by type::create() for a list of argument types
+    overload_cache              m_ctor_overload_cache;
+    //! a unique bit position, which is assigned when this class is used as base class; zero means no base class
+    std::atomic<std::size_t>    m_base_type_bit{0};
+    //! contains a set bit for every \ref m_base_type_bit of all classes in \ref m_base_types
+    std::vector<std::uint64_t>  m_base_type_mask;
+
+    RTTR_FORCE_INLINE bool has_base_type(const class_data& base) const RTTR_NOEXCEPT
+    {
+        const auto base_type_bit = base.m_base_type_bit.load(std::memory_order_relaxed);
+        const auto index = base_type_bit / 64;
+        return (index < m_base_type_mask.size() &&
+                (m_base_type_mask[index] & (std::uint64_t(1) << (base_type_bit % 64))) != 0);
+    }
 };
 
 enum class type_trait_infos : std::size_t
@@ -122,7 +144,7 @@ struct type_data
     type_data* wrapped_type;
     type_data* array_raw_type;
 
-    std::string name;
+    string_view name; // the original name or a derived name from type_register_private::store_name()
     string_view type_name;
 
     std::size_t get_sizeof;
@@ -135,8 +157,8 @@ struct type_data
     impl::create_wrapper_func create_wrapper;
     class_data& (*get_class_data)();
 
-    uint16_t type_index;
-    static const uint16_t m_invalid_id = 0;
+    type::type_id type_index;
+    static const type::type_id m_invalid_id = 0;
     RTTR_FORCE_INLINE bool is_valid() const RTTR_NOEXCEPT { return (type_index != m_invalid_id); }
     RTTR_FORCE_INLINE bool type_trait_value(type_trait_infos type_trait) const RTTR_NOEXCEPT { return m_type_traits.test(static_cast<std::size_t>(type_trait)); }
 
@@ -280,7 +302,7 @@ type_data& get_type_data() RTTR_NOEXCEPT
     static auto instance = type_data{ raw_type_info<T>::get_type().m_type_data, wrapper_type_info<T>::get_type().m_type_data,
                                       array_raw_type<T>::get_type().m_type_data,
 
-                                      ::rttr::detail::get_type_name<T>().to_string(), ::rttr::detail::get_type_name<T>(),
+                                      ::rttr::detail::get_type_name<T>(), ::rttr::detail::get_type_name<T>(),
 
                                       get_size_of<T>::value(),
                                       pointer_count<T>::value,
@@ -313,7 +335,7 @@ static type_data& get_invalid_type_data_impl() RTTR_NOEXCEPT
 {
     static auto instance = type_data{ nullptr, nullptr,
                                       nullptr,
-                                      std::string(""), string_view(),
+                                      string_view(), string_view(),
                                       0, 0,
                                       &create_invalid_variant_policy::create_variant,
                                       &base_classes<void>::get_types,
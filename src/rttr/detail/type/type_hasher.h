@@ -0,0 +1,73 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPE_HASHER_H_
+#define RTTR_TYPE_HASHER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct RTTR_LOCAL type_hasher_base
+{
+    using hash_func = std::size_t (*)(const void* value);
+
+    type_hasher_base(hash_func hash_f)
+    :   hash(hash_f)
+    {
+    }
+
+    hash_func   hash;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Hash>
+struct type_hasher : type_hasher_base
+{
+    type_hasher() : type_hasher_base(compute_hash) {}
+
+    static std::size_t compute_hash(const void* value)
+    {
+        return Hash()(*static_cast<const T*>(value));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPE_HASHER_H_
@@ -0,0 +1,60 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPE_ID_LIMIT_H_
+#define RTTR_TYPE_ID_LIMIT_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+#include <limits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * \brief Returns the id of a new type, which is stored at position \p type_count inside the type data storage.
+ *
+ * Ids are neither reused nor wrapped around; when all values of \p Id are used already,
+ * the invalid id `0` is returned.
+ */
+template<typename Id>
+RTTR_INLINE Id get_next_type_id(std::size_t type_count) RTTR_NOEXCEPT
+{
+    if (type_count > static_cast<std::size_t>((std::numeric_limits<Id>::max)()))
+        return Id(0);
+
+    return static_cast<Id>(type_count);
+}
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPE_ID_LIMIT_H_
@@ -38,6 +38,7 @@
 #include "rttr/detail/misc/utility.h"
 #include "rttr/wrapper_mapper.h"
 #include "rttr/detail/type/type_comparator.h"
+#include "rttr/detail/type/type_hasher.h"
 #include "rttr/detail/type/type_data.h"
 #include "rttr/detail/type/type_name.h"
 
@@ -478,6 +479,15 @@ void type::register_less_than_comparator()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T, typename Hash>
+void type::register_hash()
+{
+    static detail::type_hasher<T, Hash> hasher;
+    detail::type_register::hasher(type::get<T>(), &hasher);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 
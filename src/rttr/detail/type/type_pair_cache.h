@@ -0,0 +1,131 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPE_PAIR_CACHE_H_
+#define RTTR_TYPE_PAIR_CACHE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The \ref type_pair_cache class stores for a pair of type ids (source, target) a small index value.
+ *
+ * The cache is a direct mapped table with \p Size entries. Every entry is stored in one 64 bit atomic value,
+ * which contains both ids and the index, so it can be read and written without any lock.
+ * Type ids which need more than 24 bits or indices which need more than 16 bits will not be cached.
+ *
+ * \remark An instance has to have static storage duration, because the entries rely on zero initialization.
+ */
+template<std::size_t Size>
+class type_pair_cache
+{
+    static_assert(Size != 0 && (Size & (Size - 1)) == 0, "The size of the cache has to be a power of two.");
+
+public:
+    RTTR_STATIC_CONSTEXPR std::size_t id_bits       = 24;
+    RTTR_STATIC_CONSTEXPR std::size_t index_bits    = 16;
+
+    /*!
+     * \brief The biggest index value, which can be stored in the cache.
+     */
+    RTTR_STATIC_CONSTEXPR std::size_t max_index     = (std::size_t(1) << index_bits) - 2;
+
+    /*!
+     * \brief Returns true, when an entry for the given type ids was found; \p index contains then the cached value.
+     */
+    bool find(std::size_t src_id, std::size_t tgt_id, std::size_t& index) const RTTR_NOEXCEPT
+    {
+        if (!can_be_cached(src_id, tgt_id, 0))
+            return false;
+
+        const auto entry = m_entries[get_slot(src_id, tgt_id)].load(std::memory_order_relaxed);
+        const auto index_mask = (std::uint64_t(1) << index_bits) - 1;
+        if ((entry & ~index_mask) == make_key(src_id, tgt_id) && (entry & index_mask) != 0)
+        {
+            index = static_cast<std::size_t>(entry & index_mask) - 1;
+            return true;
+        }
+
+        return false;
+    }
+
+    /*!
+     * \brief Stores the given \p index for the type ids \p src_id and \p tgt_id.
+     *        An existing entry in the same slot will be overwritten.
+     */
+    void insert(std::size_t src_id, std::size_t tgt_id, std::size_t index) RTTR_NOEXCEPT
+    {
+        if (!can_be_cached(src_id, tgt_id, index))
+            return;
+
+        m_entries[get_slot(src_id, tgt_id)].store(make_key(src_id, tgt_id) | (index + 1), std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Removes all entries.
+     */
+    void clear() RTTR_NOEXCEPT
+    {
+        for (auto& entry : m_entries)
+            entry.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static RTTR_INLINE bool can_be_cached(std::size_t src_id, std::size_t tgt_id, std::size_t index) RTTR_NOEXCEPT
+    {
+        return (src_id < (std::size_t(1) << id_bits) &&
+                tgt_id < (std::size_t(1) << id_bits) &&
+                index <= max_index);
+    }
+
+    static RTTR_INLINE std::uint64_t make_key(std::size_t src_id, std::size_t tgt_id) RTTR_NOEXCEPT
+    {
+        return ((static_cast<std::uint64_t>(src_id) << (id_bits + index_bits)) |
+                (static_cast<std::uint64_t>(tgt_id) << index_bits));
+    }
+
+    static RTTR_INLINE std::size_t get_slot(std::size_t src_id, std::size_t tgt_id) RTTR_NOEXCEPT
+    {
+        return ((src_id * 0x9E3779B1u) ^ tgt_id) & (Size - 1);
+    }
+
+private:
+    std::atomic<std::uint64_t> m_entries[Size];
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPE_PAIR_CACHE_H_
@@ -44,8 +44,12 @@
 
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_string_utils.h"
+#include "rttr/detail/type/type_cast_cache.h"
+#include "rttr/detail/type/type_id_limit.h"
 
+#include <cassert>
 #include <set>
+#include <deque>
 
 using namespace std;
 
@@ -62,6 +66,7 @@ static std::vector<type> convert_param_list(const array_range<parameter_info>& p
 
 void type_register::property(const type& t, unique_ptr<property_wrapper_base> prop)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
    type_register_private::property(t, move(prop));
 }
 
@@ -69,6 +74,7 @@ void type_register::property(const type& t, unique_ptr<property_wrapper_base> pr
 
 void type_register::method(const type& t, std::unique_ptr<method_wrapper_base> method)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::method(t, move(method));
 }
 
@@ -76,6 +82,7 @@ void type_register::method(const type& t, std::unique_ptr<method_wrapper_base> m
 
 void type_register::constructor(const type& t, std::unique_ptr<constructor_wrapper_base> ctor)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::constructor(t, move(ctor));
 }
 
@@ -83,6 +90,7 @@ void type_register::constructor(const type& t, std::unique_ptr<constructor_wrapp
 
 void type_register::destructor(const type& t, std::unique_ptr<destructor_wrapper_base> dtor)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::destructor(t, move(dtor));
 }
 
@@ -90,6 +98,7 @@ void type_register::destructor(const type& t, std::unique_ptr<destructor_wrapper
 
 void type_register::enumeration(const type& t, std::unique_ptr<enumeration_wrapper_base> enum_item)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::register_enumeration(t, std::move(enum_item));
 }
 
@@ -97,6 +106,7 @@ void type_register::enumeration(const type& t, std::unique_ptr<enumeration_wrapp
 
 void type_register::custom_name(type& t, string_view custom_name)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::register_custom_name(t, custom_name);
 }
 
@@ -104,6 +114,7 @@ void type_register::custom_name(type& t, string_view custom_name)
 
 void type_register::metadata(const type& t, std::vector< ::rttr::detail::metadata > data)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::register_metadata(t, move(data));
 }
 
@@ -111,6 +122,7 @@ void type_register::metadata(const type& t, std::vector< ::rttr::detail::metadat
 
 void type_register::converter(const type& t, std::unique_ptr<type_converter_base> converter)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
      type_register_private::converter(t, move(converter));
 }
 
@@ -118,6 +130,7 @@ void type_register::converter(const type& t, std::unique_ptr<type_converter_base
 
 void type_register::comparator(const type& t, type_comparator_base* comparator)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::comparator(t, comparator);
 }
 
@@ -125,6 +138,7 @@ void type_register::comparator(const type& t, type_comparator_base* comparator)
 
 void type_register::equal_comparator(const type& t, type_comparator_base* comparator)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::equal_comparator(t, comparator);
 }
 
@@ -132,13 +146,23 @@ void type_register::equal_comparator(const type& t, type_comparator_base* compar
 
 void type_register::less_than_comparator(const type& t, type_comparator_base* comparator)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     type_register_private::less_than_comparator(t, comparator);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register::hasher(const type& t, type_hasher_base* hasher)
+{
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
+    type_register_private::hasher(t, hasher);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register::register_base_class(const type& derived_type, const base_class_info& base_info)
 {
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     auto& class_data = derived_type.m_type_data->get_class_data();
     auto itr = std::find_if(class_data.m_base_types.begin(), class_data.m_base_types.end(),
     [base_info](const type& t)
@@ -181,12 +205,24 @@ void type_register::register_base_class(const type& derived_type, const base_cla
 
     auto r_type = base_info.m_base_type.get_raw_type();
     r_type.m_type_data->get_class_data().m_derived_types.push_back(type(derived_type.m_type_data));
+
+    type_register_private::update_base_type_mask(class_data);
+
+    // the position of the base classes has changed, the cached positions are not valid anymore
+    type_cast_cache::clear();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 type type_register::type_reg(type_data& info) RTTR_NOEXCEPT
 {
+    // the base classes and the template arguments are registered via function-local statics;
+    // this has to be done before the lock is acquired, otherwise we could deadlock with another thread,
+    // which is currently initializing one of these statics and waits for the lock
+    info.get_base_types();
+    info.get_class_data();
+
+    std::lock_guard<std::recursive_mutex> lock(type_register_private::get_registration_mutex());
     return type_register_private::register_type(info);
 }
 
@@ -198,6 +234,14 @@ type type_register::type_reg(type_data& info) RTTR_NOEXCEPT
 /////////////////////////////////////////////////////////////////////////////////////////
 // Here comes the implementation of the registration class 'type_register_private'
 
+std::recursive_mutex& type_register_private::get_registration_mutex()
+{
+    static std::recursive_mutex obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 std::vector<type_data*>& type_register_private::get_type_data_storage()
 {
     static std::vector<type_data*> obj = {&get_invalid_type_data()};
@@ -206,9 +250,9 @@ std::vector<type_data*>& type_register_private::get_type_data_storage()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::vector<type>& type_register_private::get_type_storage()
+append_only_vector<type>& type_register_private::get_type_storage()
 {
-    static std::vector<type> obj = {type(&get_invalid_type_data())};
+    static append_only_vector<type> obj = {type(&get_invalid_type_data())};
     return obj;
 }
 
@@ -222,9 +266,9 @@ flat_map<string_view, type>& type_register_private::get_orig_name_to_id()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_map<std::string, type, hash>& type_register_private::get_custom_name_to_id()
+concurrent_string_map<type>& type_register_private::get_custom_name_to_id()
 {
-    static flat_map<std::string, type, hash> obj;
+    static concurrent_string_map<type> obj;
     return obj;
 }
 
@@ -238,6 +282,15 @@ std::vector<type_register_private::data_container<type_converter_base>>& type_re
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+type_pair_cache<256>& type_register_private::get_type_converter_cache()
+{
+    // zero initialized, because of static storage duration
+    static type_pair_cache<256> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 std::vector<type_register_private::data_container<const type_comparator_base*>>& type_register_private::get_type_comparator_list()
 {
     static std::vector<data_container<const type_comparator_base*>> obj;
@@ -262,6 +315,14 @@ std::vector<type_register_private::data_container<const type_comparator_base*>>&
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::vector<type_register_private::data_container<const type_hasher_base*>>& type_register_private::get_type_hasher_list()
+{
+    static std::vector<data_container<const type_hasher_base*>> obj;
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 std::vector<type_register_private::data_container<enumeration_wrapper_base>>& type_register_private::get_enumeration_list()
 {
     static std::vector<data_container<enumeration_wrapper_base>> obj;
@@ -278,7 +339,7 @@ std::vector<type_register_private::data_container<std::vector<metadata>>>& type_
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool type_register_private::register_name(uint16_t& id, type_data& info)
+bool type_register_private::register_name(type::type_id& id, type_data& info)
 {
     using namespace detail;
 
@@ -290,16 +351,21 @@ bool type_register_private::register_name(uint16_t& id, type_data& info)
         return true;
     }
 
-    static type::type_id m_type_id_counter = 0;
-    ++m_type_id_counter;
+    // the id is the position inside the type data storage, so the lookup via id stays a single array access
+    const auto new_id = get_next_type_id<type::type_id>(get_type_data_storage().size());
+    if (new_id == type_data::m_invalid_id)
+    {
+        // all available ids are used; the type will be handled as invalid type
+        assert(false && "RTTR: all type ids are used, compile RTTR with 'USE_32BIT_TYPE_ID' to increase the number of possible types");
+        id = type_data::m_invalid_id;
+        return true;
+    }
 
     orig_name_to_id.insert(std::make_pair(info.type_name, type(&info)));
     info.name = derive_name(type(&info));
-    get_custom_name_to_id().insert(std::make_pair(info.name, type(&info)));
 
-    id = m_type_id_counter;
+    id = new_id;
     info.type_index = id;
-    get_type_storage().emplace_back(type(&info));
 
     return false;
 }
@@ -335,10 +401,9 @@ void type_register_private::register_base_class_info(type_data& info)
     {
         class_data.m_base_types.push_back(t.m_base_type);
         class_data.m_conversion_list.push_back(t.m_rttr_cast_func);
-
-        auto r_type = t.m_base_type.get_raw_type();
-        r_type.m_type_data->get_class_data().m_derived_types.push_back(type(&info));
     }
+
+    update_base_type_mask(class_data);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -346,11 +411,9 @@ void type_register_private::register_base_class_info(type_data& info)
 type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
 {
     auto& type_data_container = get_type_data_storage();
-    // register the base types
-    info.get_base_types();
 
     using namespace detail;
-    uint16_t id = 0;
+    type::type_id id = 0;
     const bool isAlreadyRegistered = register_name(id, info);
     if (isAlreadyRegistered)
         return type(type_data_container[id]);
@@ -362,7 +425,7 @@ type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
     // has to be done as last step
     register_base_class_info(info);
 
-    update_custom_name(derive_template_instance_name(info), type(&info));
+    info.name = derive_template_instance_name(info);
 
     // when a base class type has class items, but the derived one not,
     // we update the derived class item list
@@ -370,6 +433,13 @@ type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
     update_class_list(t, &detail::class_data::m_properties);
     update_class_list(t, &detail::class_data::m_methods);
 
+    // the type is completely initialized now, so it can be published to the lock-free lookup functions
+    for (const auto& base_type : info.get_class_data().m_base_types)
+        base_type.get_raw_type().m_type_data->get_class_data().m_derived_types.push_back(t);
+
+    get_custom_name_to_id().insert(info.name, t);
+    get_type_storage().push_back(t);
+
     return t;
 }
 
@@ -413,6 +483,21 @@ static void move_pointer_and_ref_to_type(std::string& type_name)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static bool is_normalized_orig_name(string_view name)
+{
+    // the check has to be kept in sync with 'move_pointer_and_ref_to_type'
+    for (std::size_t pos = 1; pos < name.size(); ++pos)
+    {
+        const auto c = name[pos];
+        if ((c == '*' || c == '&' || c == ')') && ::isspace(name[pos - 1]))
+            return false;
+    }
+
+    return (name.empty() || name.back() != ' ');
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static std::string normalize_orig_name(string_view name)
 {
     std::string normalized_name = name.to_string();
@@ -459,7 +544,7 @@ static std::string derive_name_impl(const std::string& src_name, const std::stri
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string type_register_private::derive_template_instance_name(type_data& info)
+string_view type_register_private::derive_template_instance_name(type_data& info)
 {
     auto& nested_types = info.get_class_data().m_nested_types;
     if (nested_types.empty()) // no template type
@@ -469,33 +554,34 @@ std::string type_register_private::derive_template_instance_name(type_data& info
     if (has_custom_name)
         return info.name;
 
-    const auto start_pos = info.name.find("<");
-    const auto end_pos = info.name.rfind(">");
+    const auto name = info.name.to_string();
+    const auto start_pos = name.find("<");
+    const auto end_pos = name.rfind(">");
 
     if (start_pos == std::string::npos || end_pos == std::string::npos)
         return info.name;
 
-    auto new_name = info.name.substr(0, start_pos);
-    const auto end_part = info.name.substr(end_pos);
+    auto new_name = name.substr(0, start_pos);
+    const auto end_part = name.substr(end_pos);
     auto index = nested_types.size();
     new_name += std::string("<");
     for (const auto& item : nested_types)
     {
         --index;
         const auto& custom_name = item.m_type_data->name;
-        new_name += custom_name;
+        new_name.append(custom_name.data(), custom_name.size());
         if (index > 0)
             new_name += ",";
     }
 
     new_name += end_part;
 
-    return new_name;
+    return (new_name == info.name) ? info.name : store_name(std::move(new_name));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-void type_register_private::update_custom_name(std::string new_name, const type& t)
+void type_register_private::update_custom_name(string_view new_name, const type& t)
 {
     auto& type_name = t.m_type_data->name;
 
@@ -504,35 +590,50 @@ void type_register_private::update_custom_name(std::string new_name, const type&
         auto& custom_name_to_id = get_custom_name_to_id();
         custom_name_to_id.erase(type_name);
 
-        type_name = std::move(new_name);
-        custom_name_to_id.insert(std::make_pair(type_name, t));
+        type_name = new_name;
+        custom_name_to_id.insert(type_name, t);
     }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string type_register_private::derive_name(const type& t)
+string_view type_register_private::store_name(std::string name)
 {
-    if (t.is_array() && t.get_raw_array_type().is_valid())
-    {
-        auto src_name_orig  = normalize_orig_name(t.get_full_name());
-        auto custom_name    = t.get_raw_array_type().get_name();
-        auto raw_name_orig  = normalize_orig_name( t.get_raw_array_type().get_full_name());
+    // a deque never moves its elements, so the returned views stay valid
+    static std::deque<std::string> name_storage;
+    name_storage.push_back(std::move(name));
+    return name_storage.back();
+}
 
-        return derive_name_impl(src_name_orig, raw_name_orig, custom_name.to_string());
-    }
-    else if (t != t.get_raw_type())
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view type_register_private::derive_name(const type& t)
+{
+    const auto src_name = t.get_full_name();
+    const auto raw_type = (t.is_array() && t.get_raw_array_type().is_valid()) ? t.get_raw_array_type() : t.get_raw_type();
+
+    std::string new_name;
+    if (t != raw_type)
     {
-        auto src_name_orig  = normalize_orig_name(t.get_full_name());
-        auto custom_name    = t.get_raw_type().get_name();
-        auto raw_name_orig  = normalize_orig_name( t.get_raw_type().get_full_name());
+        const auto raw_name = raw_type.get_full_name();
+        const auto custom_name = raw_type.get_name();
+
+        // fast path: when the raw type has no custom name, the derived name is the original name,
+        // which is stored as part of the function signature in the read-only data of the binary
+        if (custom_name == raw_name && is_normalized_orig_name(src_name) && is_normalized_orig_name(raw_name))
+            return src_name;
 
-        return derive_name_impl(src_name_orig, raw_name_orig, custom_name.to_string());
+        new_name = derive_name_impl(normalize_orig_name(src_name), normalize_orig_name(raw_name), custom_name.to_string());
     }
     else
     {
-        return normalize_orig_name(t.get_full_name());
+        if (is_normalized_orig_name(src_name))
+            return src_name;
+
+        new_name = normalize_orig_name(src_name);
     }
+
+    return (new_name == t.get_name()) ? t.get_name() : store_name(std::move(new_name));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -542,17 +643,18 @@ void type_register_private::register_custom_name(type& t, string_view custom_nam
     if (!t.is_valid())
         return;
 
-    update_custom_name(custom_name.to_string(), t);
+    if (custom_name != t.get_name())
+        update_custom_name(store_name(custom_name.to_string()), t);
 
-    // we have to make a copy of the list, because we also perform an insertion with 'update_custom_name'
-    auto tmp_type_list = get_custom_name_to_id().value_data();
+    std::size_t size = 0;
+    const auto data = get_type_storage().data(size);
+    const std::vector<type> tmp_type_list(data + 1, data + size);
     for (auto& tt : tmp_type_list)
     {
         if (tt == t || tt.get_raw_type() == tt)
             continue;
 
-        auto new_name = derive_name(tt);
-        update_custom_name(new_name, tt);
+        update_custom_name(derive_name(tt), tt);
     }
 
     for (auto& tt : tmp_type_list)
@@ -574,6 +676,7 @@ void type_register_private::constructor(const type& t, std::unique_ptr<construct
 
     auto& class_data = t.m_type_data->get_class_data();
     class_data.m_ctors.emplace_back(create_item<::rttr::constructor>(ctor.get()));
+    class_data.m_ctor_overload_cache.clear();
     constructor_list.push_back(std::move(ctor));
 }
 
@@ -708,6 +811,31 @@ static std::vector<type> convert_param_list(const array_range<parameter_info>& p
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void type_register_private::update_base_type_mask(class_data& data)
+{
+    static std::size_t base_type_bit_counter = 0;
+
+    data.m_base_type_mask.clear();
+    for (const auto& base_type : data.m_base_types)
+    {
+        auto& base_data = base_type.get_raw_type().m_type_data->get_class_data();
+        auto base_type_bit = base_data.m_base_type_bit.load(std::memory_order_relaxed);
+        if (base_type_bit == 0)
+        {
+            base_type_bit = ++base_type_bit_counter;
+            base_data.m_base_type_bit.store(base_type_bit, std::memory_order_relaxed);
+        }
+
+        const auto index = base_type_bit / 64;
+        if (index >= data.m_base_type_mask.size())
+            data.m_base_type_mask.resize(index + 1, 0);
+
+        data.m_base_type_mask[index] |= (std::uint64_t(1) << (base_type_bit % 64));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
 static array_range<T> get_items_for_type(const type& t,
                                          const std::vector<T>& vec)
@@ -763,6 +891,21 @@ method type_register_private::get_type_method(const type& t, string_view name,
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static void update_item_index(class_data& data, const std::vector<::rttr::property>& items)
+{
+    data.m_property_index.rebuild(items);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void update_item_index(class_data& data, const std::vector<::rttr::method>& items)
+{
+    data.m_method_index.rebuild(items);
+    data.m_method_overload_cache.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
 void type_register_private::update_class_list(const type& t, T item_ptr)
 {
@@ -786,6 +929,8 @@ void type_register_private::update_class_list(const type& t, T item_ptr)
     all_class_items.reserve(all_class_items.size() + item_vec.size());
     all_class_items.insert(all_class_items.end(), item_vec.begin(), item_vec.end());
 
+    update_item_index(t.m_type_data->get_class_data(), all_class_items);
+
     // update derived types
     for (const auto& derived_type : t.get_derived_classes())
         update_class_list<T>(derived_type, item_ptr);
@@ -881,6 +1026,9 @@ void type_register_private::converter(const type& t, std::unique_ptr<type_conver
     auto& container = get_type_converter_list();
     container.push_back({t.get_id(), std::move(converter)});
     std::stable_sort(container.begin(), container.end(), vec_value_type::order_by_id());
+
+    // the positions of the converters have changed and a missing converter might exist now
+    get_type_converter_cache().clear();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
@@ -903,8 +1051,28 @@ const type_converter_base* type_register_private::get_converter(const type& sour
 {
     const auto src_id = source_type.get_id();
     const auto target_id = target_type.get_id();
-    using vec_value_type = data_container<type_converter_base>;
     auto& container = get_type_converter_list();
+    auto& cache = get_type_converter_cache();
+    // the biggest index is used to remember, that there is no converter
+    const auto no_converter_index = cache.max_index;
+
+    std::size_t index;
+    if (cache.find(src_id, target_id, index))
+    {
+        if (index == no_converter_index)
+            return nullptr;
+
+        // a lookup, which runs concurrently to the registration of a converter, can store the index
+        // of the unsorted list, so the entry is used only, when it still belongs to these types
+        if (index < container.size())
+        {
+            const auto& item = container[index];
+            if (item.m_id == src_id && item.m_data->m_target_type.get_id() == target_id)
+                return item.m_data.get();
+        }
+    }
+
+    using vec_value_type = data_container<type_converter_base>;
     auto itr = std::lower_bound(container.cbegin(), container.cend(),
                                 src_id, vec_value_type::order_by_id());
     for (; itr != container.cend(); ++itr)
@@ -914,9 +1082,15 @@ const type_converter_base* type_register_private::get_converter(const type& sour
             break; // type not found
 
         if (item.m_data->m_target_type.get_id() == target_id)
+        {
+            index = static_cast<std::size_t>(itr - container.cbegin());
+            if (index < no_converter_index)
+                cache.insert(src_id, target_id, index);
             return item.m_data.get();
+        }
     }
 
+    cache.insert(src_id, target_id, no_converter_index);
     return nullptr;
 }
 
@@ -981,6 +1155,35 @@ void type_register_private::less_than_comparator(const type& t, const type_compa
 
 /////////////////////////////////////////////////////////////////////////////////////
 
+void type_register_private::hasher(const type& t, const type_hasher_base* hasher)
+{
+    if (!t.is_valid())
+        return;
+
+    using data_type = data_container<const type_hasher_base*>;
+    auto& container = get_type_hasher_list();
+    container.push_back({t.get_id(), hasher});
+    std::stable_sort(container.begin(), container.end(),
+                     data_type::order_by_id());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+const type_hasher_base* type_register_private::get_hasher(const type& t)
+{
+    using vec_value_type = data_container<const type_hasher_base*>;
+    const auto id = t.get_id();
+    auto& container = get_type_hasher_list();
+    auto itr = std::lower_bound(container.cbegin(), container.cend(), id,
+                                vec_value_type::order_by_id());
+    if (itr != container.cend() && itr->m_id == id)
+        return itr->m_data;
+    else
+        return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
 void type_register_private::register_comparator_impl(const type& t, const type_comparator_base* comparator,
                                                      std::vector<data_container<const type_comparator_base*>>& comparator_list)
 {
@@ -56,6 +56,7 @@ class property_wrapper_base;
 
 struct type_converter_base;
 struct type_comparator_base;
+struct type_hasher_base;
 struct base_class_info;
 struct derived_info;
 
@@ -103,6 +104,8 @@ public:
 
     static void less_than_comparator(const type& t, type_comparator_base* comparator);
 
+    static void hasher(const type& t, type_hasher_base* hasher);
+
     static void register_base_class(const type& derived_type, const base_class_info& base_info);
 
     /*!
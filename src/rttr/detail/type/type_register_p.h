@@ -31,6 +31,9 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/flat_multimap.h"
 #include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/misc/append_only_vector.h"
+#include "rttr/detail/misc/concurrent_string_map.h"
+#include "rttr/detail/type/type_pair_cache.h"
 #include "rttr/enumeration.h"
 #include "rttr/variant.h"
 #include "rttr/detail/metadata/metadata.h"
@@ -38,6 +41,7 @@
 #include "rttr/string_view.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -57,10 +61,14 @@ class method_wrapper_base;
 class enumeration_wrapper_base;
 
 struct type_data;
+struct class_data;
 
 /*!
  * This class contains all logic to register properties, methods etc.. for a specific type.
  * It is not part of the rttr API
+ *
+ * All modifications of the registry are serialized with the \ref get_registration_mutex() "registration mutex".
+ * The storage of the types and the name lookup can be read without locking, while another thread registers a new type.
  */
 class RTTR_LOCAL type_register_private
 {
@@ -73,16 +81,24 @@ public:
     static void property(const type& t, std::unique_ptr<property_wrapper_base> prop);
     static void method(const type& t, std::unique_ptr<method_wrapper_base> meth);
     static void register_custom_name(type& t, string_view custom_name);
+    /*!
+     * \brief Updates the bit mask of all base classes for the given class data \p data.
+     *        This mask is used for a fast check whether a class is derived from another one.
+     */
+    static void update_base_type_mask(class_data& data);
 
     /////////////////////////////////////////////////////////////////////////////////////
     static flat_multimap<string_view, ::rttr::property>& get_global_property_storage();
     static flat_multimap<string_view, ::rttr::method>& get_global_method_storage();
     /////////////////////////////////////////////////////////////////////////////////////
 
+    //! The mutex, which has to be locked for every modification of the registry.
+    static std::recursive_mutex& get_registration_mutex();
+
     static std::vector<type_data*>& get_type_data_storage();
-    static std::vector<type>& get_type_storage();
+    static append_only_vector<type>& get_type_storage();
     static flat_map<string_view, type>& get_orig_name_to_id();
-    static flat_map<std::string, type, hash>& get_custom_name_to_id();
+    static concurrent_string_map<type>& get_custom_name_to_id();
 
     /////////////////////////////////////////////////////////////////////////////////////
 
@@ -92,6 +108,7 @@ public:
     static void comparator(const type& t, const type_comparator_base* comparator);
     static void equal_comparator(const type& t, const type_comparator_base* comparator);
     static void less_than_comparator(const type& t, const type_comparator_base* comparator);
+    static void hasher(const type& t, const type_hasher_base* hasher);
 
     /////////////////////////////////////////////////////////////////////////////////////
 
@@ -99,6 +116,7 @@ public:
     static const type_comparator_base* get_comparator(const type& t);
     static const type_comparator_base* get_equal_comparator(const type& t);
     static const type_comparator_base* get_less_than_comparator(const type& t);
+    static const type_hasher_base* get_hasher(const type& t);
     static variant get_metadata(const type& t, const variant& key);
     static enumeration get_enumeration(const type& t);
 
@@ -148,10 +166,13 @@ private:
     static variant get_metadata(const variant& key, const std::vector<metadata>& data);
 
     static std::vector<data_container<type_converter_base>>& get_type_converter_list();
+    //! remembers for a pair of (source type id, target type id) the position in the type converter list
+    static type_pair_cache<256>& get_type_converter_cache();
     static std::vector<data_container<const type_comparator_base*>>& get_type_comparator_list();
 
     static std::vector<data_container<const type_comparator_base*>>& get_type_equal_comparator_list();
     static std::vector<data_container<const type_comparator_base*>>& get_type_less_comparator_list();
+    static std::vector<data_container<const type_hasher_base*>>& get_type_hasher_list();
 
     static std::vector<data_container<enumeration_wrapper_base>>& get_enumeration_list();
     static std::vector<data_container<std::vector<metadata>>>& get_metadata_type_list();
@@ -169,9 +190,14 @@ private:
     template<typename T>
     static void update_class_list(const type& t, T item_ptr);
 
-    static std::string derive_name(const type& t);
+    /*!
+     * \brief Returns the name of the given type \p t, where the name of the raw type is replaced with its custom name.
+     *
+     * The returned view points either to the original name or to the \ref store_name() "name storage".
+     */
+    static string_view derive_name(const type& t);
     //! Returns true, when the name was already registered
-    static bool register_name(uint16_t& id, type_data& info);
+    static bool register_name(type::type_id& id, type_data& info);
     static void register_base_class_info(type_data& info);
     /*!
      * \brief This will create the derived name of a template instance, with all the custom names of a template parameter.
@@ -179,12 +205,19 @@ private:
      *       `std::reference_wrapper<class std::string>`
      *
      */
-    static std::string derive_template_instance_name(type_data& info);
+    static string_view derive_template_instance_name(type_data& info);
+
+    /*!
+     * Updates the custom name for the given type \p t with \p new_name;
+     * the referenced string has to be valid as long as the type is registered.
+     */
+    static void update_custom_name(string_view new_name, const type& t);
 
     /*!
-     * Updates the custom name for the given type \p t with \p new_name
+     * Stores the given \p name, which could not be taken from the original type name;
+     * the returned view stays valid until the process ends.
      */
-    static void update_custom_name(std::string new_name, const type& t);
+    static string_view store_name(std::string name);
 
 };
 
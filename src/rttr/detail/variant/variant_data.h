@@ -28,6 +28,7 @@
 #ifndef RTTR_VARIANT_DATA_H_
 #define RTTR_VARIANT_DATA_H_
 
+#include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/misc_type_traits.h"
 #include <type_traits>
 
@@ -46,8 +47,11 @@ using variant_basic_types = type_list<bool,
 
 /*!
  * This is the data storage for the \ref variant class.
+ *
+ * It is big enough for all basic types, or \ref RTTR_VARIANT_INLINE_SIZE bytes, when this is bigger.
  */
-using variant_data = std::aligned_storage<max_sizeof_list<variant_basic_types>::value,
+using variant_data = std::aligned_storage<(max_sizeof_list<variant_basic_types>::value > RTTR_VARIANT_INLINE_SIZE ?
+                                           max_sizeof_list<variant_basic_types>::value : RTTR_VARIANT_INLINE_SIZE),
                                           max_alignof_list<variant_basic_types>::value>::type;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,96 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_DATA_ALLOCATION_H_
+#define RTTR_VARIANT_DATA_ALLOCATION_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/variant_memory_resource.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * Allocates memory for a variant value from the \ref variant_memory_resource of the calling thread.
+ * The used resource is stored in front of the returned memory.
+ */
+RTTR_API void* allocate_variant_data(std::size_t size, std::size_t alignment);
+
+/*!
+ * Returns the memory \p ptr, which was allocated with \ref allocate_variant_data(), to its resource.
+ */
+RTTR_API void deallocate_variant_data(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename... Args>
+RTTR_INLINE T* create_variant_heap_value(Args&&... args)
+{
+    void* ptr = allocate_variant_data(sizeof(T), std::alignment_of<T>::value);
+    try
+    {
+        return ::new (ptr) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        deallocate_variant_data(ptr, sizeof(T), std::alignment_of<T>::value);
+        throw;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE void destroy_variant_heap_value(T* value) RTTR_NOEXCEPT
+{
+    value->~T();
+    deallocate_variant_data(const_cast<void*>(static_cast<const void*>(value)), sizeof(T), std::alignment_of<T>::value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Wraps a raw array, so it can be created and destroyed like any other type with \ref create_variant_heap_value().
+ */
+template<typename T>
+struct variant_array_holder
+{
+    T m_array;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_DATA_ALLOCATION_H_
@@ -30,13 +30,16 @@
 
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/detail/variant/variant_data.h"
+#include "rttr/detail/variant/variant_data_allocation.h"
 #include "rttr/detail/misc/argument_wrapper.h"
 #include "rttr/detail/variant_array_view/variant_array_view_creator.h"
 #include "rttr/detail/variant_associative_view/variant_associative_view_creator.h"
 #include "rttr/detail/variant_sequential_view/variant_sequential_view_creator.h"
 #include "rttr/detail/variant/variant_data_converter.h"
+#include "rttr/detail/conversion/basic_conversion_table.h"
 #include "rttr/detail/comparison/compare_equal.h"
 #include "rttr/detail/comparison/compare_less.h"
+#include "rttr/detail/comparison/compute_hash.h"
 
 #include <cstdint>
 
@@ -71,8 +74,15 @@ struct variant_data_policy_arithmetic;
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * A type is placed inside \ref variant_data, when it fits into it and cannot throw while it is moved.
+ * Otherwise it is allocated on the heap, where moving the variant only moves the pointer;
+ * so moving a variant never throws and a container of variants moves its items instead of copying them.
+ */
 template<typename T, bool Can_Place = (sizeof(T) <= sizeof(variant_data)) &&
-                                      (std::alignment_of<T>::value <= std::alignment_of<variant_data>::value)>
+                                      (std::alignment_of<T>::value <= std::alignment_of<variant_data>::value) &&
+                                      (std::is_nothrow_move_constructible<T>::value ||
+                                       (std::is_array<T>::value && std::is_nothrow_copy_constructible<typename std::remove_all_extents<T>::type>::value))>
 using can_place_in_variant = std::integral_constant<bool, Can_Place>;
 
 /*!
@@ -124,14 +134,8 @@ using variant_policy = conditional_t<std::is_same<T, void_variant_type>::value,
  */
 enum class variant_policy_operation : uint8_t
 {
-    DESTROY,
-    CLONE,
-    SWAP,
     EXTRACT_WRAPPED_VALUE,
     CREATE_WRAPPED_VALUE,
-    GET_VALUE,
-    GET_TYPE,
-    GET_PTR,
     GET_RAW_TYPE,
     GET_RAW_PTR,
     GET_ADDRESS_CONTAINER,
@@ -141,17 +145,96 @@ enum class variant_policy_operation : uint8_t
     TO_ARRAY,
     CREATE_ASSOCIATIV_VIEW,
     CREATE_SEQUENTIAL_VIEW,
-    IS_VALID,
     IS_NULLPTR,
     CONVERT,
     COMPARE_EQUAL,
-    COMPARE_LESS
+    COMPARE_LESS,
+    HASH,
+    GET_WRAPPED_VALUE_PTR
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 using variant_policy_func = bool (*)(variant_policy_operation, const variant_data&, argument_wrapper);
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * This enum describes where the value of a variant is stored inside \ref variant_data.
+ */
+enum class variant_storage_kind : uint8_t
+{
+    NONE,           //!< the variant does not hold any data, e.g. an empty or `void` variant
+    INLINE_DATA,    //!< the value is placed directly inside \ref variant_data
+    HEAP_POINTER    //!< \ref variant_data holds a pointer to the value
+};
+
+/*!
+ * The operation table of a variant policy.
+ *
+ * Every policy type owns exactly one constant initialized instance of this table.
+ * A variant holds a pointer to it, so the frequently used operations are a direct call
+ * or even only a load. All other operations are delegated to the `invoke` function.
+ *
+ * \remark Do not compare the address of tables, when a library is loaded dynamically,
+ *         there can be more than one table for the same policy.
+ */
+struct variant_policy_table
+{
+    variant_policy_func     invoke;
+    void                    (*destroy)(variant_data& data);
+    void                    (*clone)(const variant_data& src_data, variant_data& dest);
+    void                    (*swap)(variant_data& src_data, variant_data& dest);
+    type                    (*get_type)();
+    variant_storage_kind    storage_kind;
+    bool                    is_valid;
+    //! `false` for move-only types, a copy of such a variant is an invalid variant
+    bool                    can_clone;
+    //! the \ref basic_conversion_index of the contained type
+    std::uint8_t            conversion_index;
+
+    RTTR_INLINE void* get_ptr(const variant_data& data) const
+    {
+        return (storage_kind == variant_storage_kind::INLINE_DATA ? const_cast<variant_data*>(&data) :
+               (storage_kind == variant_storage_kind::HEAP_POINTER ? *reinterpret_cast<void* const*>(&data) : nullptr));
+    }
+};
+
+/*!
+ * Holds the operation table for the given variant policy \p Policy.
+ *
+ * All members of the table are address constant expressions,
+ * so the table is initialized before any dynamic initialization takes place.
+ */
+template<typename Policy>
+struct variant_policy_table_holder
+{
+    static const variant_policy_table table;
+};
+
+template<typename Policy>
+const variant_policy_table variant_policy_table_holder<Policy>::table =
+{
+    &Policy::invoke,
+    &Policy::destroy_data,
+    &Policy::clone_data,
+    &Policy::swap_data,
+    &Policy::get_type,
+    Policy::storage_kind,
+    Policy::is_valid,
+    Policy::can_clone,
+    Policy::conversion_index
+};
+
+/*!
+ * Returns the operation table for the given variant policy \p Policy.
+ */
+template<typename Policy>
+static RTTR_INLINE const variant_policy_table* get_variant_policy_table() RTTR_NOEXCEPT
+{
+    return &variant_policy_table_holder<Policy>::table;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // some ugly workaround for MSVC < v. 1800
 
@@ -220,6 +303,51 @@ enable_if_t<!is_copyable<Tp>::value ||
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Returns `true` when the wrapper type \p T gives access to its wrapped object without a copy,
+ * i.e. its `wrapper_mapper<T>::get()` returns a pointer or a reference.
+ */
+template<typename T, typename Wrapped = wrapper_mapper_t<T>>
+using has_addressable_wrapped_value = std::integral_constant<bool, is_wrapper<T>::value &&
+                                                                   (std::is_pointer<Wrapped>::value ||
+                                                                    std::is_lvalue_reference<Wrapped>::value)>;
+
+template<typename T>
+RTTR_INLINE const void* get_wrapped_object_address(T&& wrapped_value, std::true_type)
+{
+    return std::addressof(wrapped_value);
+}
+
+template<typename T>
+RTTR_INLINE const void* get_wrapped_object_address(T&& wrapped_value, std::false_type)
+{
+    return wrapped_value;
+}
+
+/*!
+ * Returns the address of the object wrapped inside \p value, when the object is of type \p wrapped_type;
+ * otherwise `nullptr`.
+ */
+template<typename T>
+enable_if_t<has_addressable_wrapped_value<T>::value, const void*> get_wrapped_value_ptr(const T& value, const type& wrapped_type)
+{
+    using wrapped_t         = wrapper_mapper_t<T>;
+    using is_reference      = std::is_lvalue_reference<wrapped_t>;
+    using wrapped_object_t  = conditional_t<is_reference::value, remove_reference_t<wrapped_t>, remove_pointer_t<wrapped_t>>;
+    if (type::get<wrapped_object_t>() != wrapped_type)
+        return nullptr;
+
+    return get_wrapped_object_address(wrapper_mapper<T>::get(value), is_reference());
+}
+
+template<typename T>
+enable_if_t<!has_addressable_wrapped_value<T>::value, const void*> get_wrapped_value_ptr(const T& value, const type& wrapped_type)
+{
+    return nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 /*!
  * This class represents the base implementation for variant_data policy.
  *
@@ -230,25 +358,44 @@ enable_if_t<!is_copyable<Tp>::value ||
 template<typename T, typename Tp, typename Converter>
 struct variant_data_base_policy
 {
+    RTTR_STATIC_CONSTEXPR bool is_valid = true;
+    RTTR_STATIC_CONSTEXPR bool can_clone = is_copyable<T>::value || std::is_array<T>::value;
+    RTTR_STATIC_CONSTEXPR std::uint8_t conversion_index = basic_conversion_index<T>::value;
+
+    static void destroy_data(variant_data& data)
+    {
+        Tp::destroy(const_cast<T&>(Tp::get_value(data)));
+    }
+
+    static void clone_data(const variant_data& src_data, variant_data& dest)
+    {
+        clone_data_impl(src_data, dest, std::integral_constant<bool, can_clone>());
+    }
+
+    static RTTR_INLINE void clone_data_impl(const variant_data& src_data, variant_data& dest, std::true_type)
+    {
+        Tp::clone(Tp::get_value(src_data), dest);
+    }
+
+    static RTTR_INLINE void clone_data_impl(const variant_data& src_data, variant_data& dest, std::false_type)
+    {
+        // a move-only type is never cloned, the copy of the variant will use the empty policy instead
+    }
+
+    static void swap_data(variant_data& src_data, variant_data& dest)
+    {
+        Tp::swap(const_cast<T&>(Tp::get_value(src_data)), dest);
+    }
+
+    static type get_type()
+    {
+        return type::get<T>();
+    }
+
     static bool invoke(variant_policy_operation op, const variant_data& src_data, argument_wrapper arg)
     {
         switch (op)
         {
-            case variant_policy_operation::DESTROY:
-            {
-                Tp::destroy(const_cast<T&>(Tp::get_value(src_data)));
-                break;
-            }
-            case variant_policy_operation::CLONE:
-            {
-                Tp::clone(Tp::get_value(src_data), arg.get_value<variant_data>());
-                break;
-            }
-            case variant_policy_operation::SWAP:
-            {
-                Tp::swap(const_cast<T&>(Tp::get_value(src_data)), arg.get_value<variant_data>());
-                break;
-            }
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             {
                 arg.get_value<variant>() = get_wrapped_value(Tp::get_value(src_data));
@@ -263,21 +410,6 @@ struct variant_data_base_policy
                 wrapper_type.create_wrapped_value(Tp::get_value(src_data), var);
                 break;
             }
-            case variant_policy_operation::GET_VALUE:
-            {
-                arg.get_value<const void*>() = &Tp::get_value(src_data);
-                break;
-            }
-            case variant_policy_operation::GET_TYPE:
-            {
-                arg.get_value<type>() = type::get<T>();
-                break;
-            }
-            case variant_policy_operation::GET_PTR:
-            {
-                arg.get_value<void*>() = as_void_ptr(std::addressof(Tp::get_value(src_data)));
-                break;
-            }
             case variant_policy_operation::GET_RAW_TYPE:
             {
                 arg.get_value<type>() = type::get<typename raw_type<T>::type>();
@@ -329,10 +461,6 @@ struct variant_data_base_policy
             {
                 return Converter::convert_to(Tp::get_value(src_data), arg.get_value<argument>());
             }
-            case variant_policy_operation::IS_VALID:
-            {
-                return true;
-            }
             case variant_policy_operation::IS_NULLPTR:
             {
                 return is_nullptr(Tp::get_value(src_data));
@@ -405,6 +533,16 @@ struct variant_data_base_policy
                     return false;
                 }
             }
+            case variant_policy_operation::HASH:
+            {
+                return compute_hash(Tp::get_value(src_data), arg.get_value<std::size_t>());
+            }
+            case variant_policy_operation::GET_WRAPPED_VALUE_PTR:
+            {
+                const auto& param = arg.get_value<std::tuple<const type&, const void*&>>();
+                std::get<1>(param) = get_wrapped_value_ptr(Tp::get_value(src_data), std::get<0>(param));
+                return (std::get<1>(param) != nullptr);
+            }
         }
 
         return true;
@@ -423,6 +561,8 @@ struct variant_data_base_policy
 template<typename T, typename Converter>
 struct variant_data_policy_small : variant_data_base_policy<T, variant_data_policy_small<T>, Converter>
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::INLINE_DATA;
+
     static RTTR_INLINE const T& get_value(const variant_data& data)
     {
         return reinterpret_cast<const T&>(data);
@@ -440,7 +580,7 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
 
     static RTTR_INLINE void swap(T& value, variant_data& dest)
     {
-        new (&dest) T(value);
+        new (&dest) T(std::move_if_noexcept(value));
         destroy(value);
     }
 
@@ -449,6 +589,12 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
     {
         new (&dest) T(std::forward<U>(value));
     }
+
+    template<typename... Args>
+    static RTTR_INLINE void emplace(variant_data& dest, Args&&... args)
+    {
+        new (&dest) T(std::forward<Args>(args)...);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -457,10 +603,13 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
  * This policy is used for custom types that size does NOT fit into variant_data.
  *
  * Then the type will be allocated on the heap and a pointer to the data is stored in variant_data.
+ * The memory is provided by the current \ref variant_memory_resource.
  */
 template<typename T, typename Converter>
 struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy_big<T>, Converter>
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::HEAP_POINTER;
+
     static RTTR_INLINE const T& get_value(const variant_data& data)
     {
         return *reinterpret_cast<T* const &>(data);
@@ -468,12 +617,12 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
 
     static RTTR_INLINE void destroy(T& value)
     {
-        delete &value;
+        destroy_variant_heap_value(&value);
     }
 
     static RTTR_INLINE void clone(const T& value, variant_data& dest)
     {
-        reinterpret_cast<T*&>(dest) = new T(value);
+        reinterpret_cast<T*&>(dest) = create_variant_heap_value<T>(value);
     }
 
     static RTTR_INLINE void swap(T& value, variant_data& dest)
@@ -484,7 +633,13 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
     template<typename U>
     static RTTR_INLINE void create(U&& value, variant_data& dest)
     {
-        reinterpret_cast<T*&>(dest) = new T(std::forward<U>(value));
+        reinterpret_cast<T*&>(dest) = create_variant_heap_value<T>(std::forward<U>(value));
+    }
+
+    template<typename... Args>
+    static RTTR_INLINE void emplace(variant_data& dest, Args&&... args)
+    {
+        reinterpret_cast<T*&>(dest) = create_variant_heap_value<T>(std::forward<Args>(args)...);
     }
 };
 
@@ -506,6 +661,8 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
 template<typename T>
 struct variant_data_policy_array_small : variant_data_base_policy<T, variant_data_policy_array_small<T>>
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::INLINE_DATA;
+
     static RTTR_INLINE const T& get_value(const variant_data& data)
     {
         return reinterpret_cast<const T&>(data);
@@ -538,39 +695,42 @@ struct variant_data_policy_array_small : variant_data_base_policy<T, variant_dat
  * This policy is used for raw array types of arbitrary rank, which fit NOT into \p variant_data.
  *
  * A copy of the given array value will be allocated on the heap. The pointer to the array is stored in \p variant_data.
+ * The memory is provided by the current \ref variant_memory_resource.
  */
 template<typename T>
 struct variant_data_policy_array_big : variant_data_base_policy<T, variant_data_policy_array_big<T>>
 {
-    using array_dest_type = decltype(new T);
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::HEAP_POINTER;
+
+    using array_holder = variant_array_holder<remove_cv_t<T>>;
 
     static RTTR_INLINE const T& get_value(const variant_data& data)
     {
-        return reinterpret_cast<const T&>(*reinterpret_cast<const array_dest_type&>(data));
+        return *reinterpret_cast<T* const&>(data);
     }
 
     static RTTR_INLINE void destroy(T& value)
     {
-        delete [] &value;
+        // the array is the first and only member of its holder, so both have the same address
+        destroy_variant_heap_value(reinterpret_cast<array_holder*>(const_cast<remove_cv_t<T>*>(&value)));
     }
 
     static RTTR_INLINE void clone(const T& value, variant_data& dest)
     {
-        reinterpret_cast<array_dest_type&>(dest) = new T;
+        reinterpret_cast<T*&>(dest) = &create_variant_heap_value<array_holder>()->m_array;
 
         COPY_ARRAY_PRE_PROC(value, dest);
     }
 
     static RTTR_INLINE void swap(T& value, variant_data& dest)
     {
-        reinterpret_cast<array_dest_type&>(dest) = value;
+        reinterpret_cast<T*&>(dest) = &value;
     }
 
     template<typename U>
     static RTTR_INLINE void create(U&& value, variant_data& dest)
     {
-        using array_dest_type = decltype(new T);
-        reinterpret_cast<array_dest_type&>(dest) = new T;
+        reinterpret_cast<T*&>(dest) = &create_variant_heap_value<array_holder>()->m_array;
 
         COPY_ARRAY_PRE_PROC(value, dest);
     }
@@ -586,6 +746,8 @@ struct variant_data_policy_array_big : variant_data_base_policy<T, variant_data_
 template<typename T>
 struct variant_data_policy_arithmetic : variant_data_base_policy<T, variant_data_policy_arithmetic<T>, default_type_converter<T>>
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::INLINE_DATA;
+
     static RTTR_INLINE const T& get_value(const variant_data& data)
     {
         return reinterpret_cast<const T&>(data);
@@ -610,27 +772,38 @@ struct variant_data_policy_arithmetic : variant_data_base_policy<T, variant_data
     {
         reinterpret_cast<T&>(dest) = value;
     }
+
+    template<typename... Args>
+    static RTTR_INLINE void emplace(variant_data& dest, Args&&... args)
+    {
+        reinterpret_cast<T&>(dest) = T(std::forward<Args>(args)...);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+using variant_data_policy_string_base = conditional_t<can_place_in_variant<std::string>::value,
+                                                      variant_data_policy_small<std::string, default_type_converter<std::string>>,
+                                                      variant_data_policy_big<std::string, default_type_converter<std::string>>>;
+
 /*!
  * This policy will manage the type std::string.
  *
  * This type has build in converter for several other basic types, that why we have a specialization here for it.
+ * The string will be placed inside the variant, when it fits into \ref variant_data; otherwise it is allocated on the heap.
  */
-struct RTTR_API variant_data_policy_string : variant_data_policy_big<std::string, default_type_converter<std::string>>
+struct RTTR_API variant_data_policy_string : variant_data_policy_string_base
 {
     template<typename U>
     static RTTR_INLINE void create(U&& value, variant_data& dest)
     {
-        reinterpret_cast<std::string*&>(dest) = new std::string(std::forward<U>(value));
+        variant_data_policy_string_base::create(std::forward<U>(value), dest);
     }
 
     template<std::size_t N>
     static RTTR_INLINE void create(const char (&value)[N], variant_data& dest)
     {
-        reinterpret_cast<std::string*&>(dest) = new std::string(value, N - 1);
+        variant_data_policy_string_base::create(std::string(value, N - 1), dest);
     }
 };
 
@@ -643,33 +816,29 @@ struct RTTR_API variant_data_policy_string : variant_data_policy_big<std::string
  */
 struct RTTR_API variant_data_policy_empty
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::NONE;
+    RTTR_STATIC_CONSTEXPR bool is_valid = false;
+    RTTR_STATIC_CONSTEXPR bool can_clone = true;
+    RTTR_STATIC_CONSTEXPR std::uint8_t conversion_index = invalid_conversion_index;
+
+    static void destroy_data(variant_data&) {}
+    static void clone_data(const variant_data&, variant_data&) {}
+    static void swap_data(variant_data&, variant_data&) {}
+
+    static type get_type()
+    {
+        return get_invalid_type();
+    }
+
     static bool invoke(variant_policy_operation op, const variant_data& src_data, argument_wrapper arg)
     {
         switch (op)
         {
-            case variant_policy_operation::DESTROY:
-            case variant_policy_operation::CLONE:
-            case variant_policy_operation::SWAP:
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             case variant_policy_operation::CREATE_WRAPPED_VALUE:
             {
                 break;
             }
-            case variant_policy_operation::GET_VALUE:
-            {
-                arg.get_value<void*>() = nullptr;
-                break;
-            }
-            case variant_policy_operation::GET_TYPE:
-            {
-                arg.get_value<type>() = get_invalid_type();
-                break;
-            }
-            case variant_policy_operation::GET_PTR:
-            {
-                arg.get_value<void*>() = nullptr;
-                break;
-            }
             case variant_policy_operation::GET_RAW_TYPE:
             {
                 arg.get_value<type>() = get_invalid_type();
@@ -702,6 +871,10 @@ struct RTTR_API variant_data_policy_empty
             {
                 return false;
             }
+            case variant_policy_operation::GET_WRAPPED_VALUE_PTR:
+            {
+                return false;
+            }
             case variant_policy_operation::TO_ARRAY:
             {
                 break;
@@ -714,10 +887,6 @@ struct RTTR_API variant_data_policy_empty
             {
                 break;
             }
-            case variant_policy_operation::IS_VALID:
-            {
-                return false;
-            }
             case variant_policy_operation::IS_NULLPTR:
             {
                 return false;
@@ -739,6 +908,12 @@ struct RTTR_API variant_data_policy_empty
             {
                 return false;
             }
+            case variant_policy_operation::HASH:
+            {
+                // all invalid variants are equal
+                arg.get_value<std::size_t>() = 0;
+                return true;
+            }
         }
         return true;
     }
@@ -759,31 +934,28 @@ struct RTTR_API variant_data_policy_empty
  */
 struct RTTR_API variant_data_policy_void
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::NONE;
+    RTTR_STATIC_CONSTEXPR bool is_valid = true;
+    RTTR_STATIC_CONSTEXPR bool can_clone = true;
+    RTTR_STATIC_CONSTEXPR std::uint8_t conversion_index = invalid_conversion_index;
+
+    static void destroy_data(variant_data&) {}
+    static void clone_data(const variant_data&, variant_data&) {}
+    static void swap_data(variant_data&, variant_data&) {}
+
+    static type get_type()
+    {
+        return type::get<void>();
+    }
+
     static bool invoke(variant_policy_operation op, const variant_data& src_data, argument_wrapper arg)
     {
         switch (op)
         {
-            case variant_policy_operation::DESTROY:
-            case variant_policy_operation::CLONE:
-            case variant_policy_operation::SWAP:
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             {
                 break;
             }
-            case variant_policy_operation::GET_VALUE:
-            {
-                arg.get_value<void*>() = nullptr;
-                break;
-            }
-            case variant_policy_operation::GET_TYPE:
-            {
-                arg.get_value<type>() = type::get<void>();
-                break;
-            }
-            case variant_policy_operation::GET_PTR:
-            {
-                arg.get_value<void*>() = nullptr;
-            }
             case variant_policy_operation::GET_RAW_TYPE:
             {
                 arg.get_value<type>() = type::get<void>();
@@ -816,6 +988,10 @@ struct RTTR_API variant_data_policy_void
             {
                 return false;
             }
+            case variant_policy_operation::GET_WRAPPED_VALUE_PTR:
+            {
+                return false;
+            }
             case variant_policy_operation::TO_ARRAY:
             {
                 break;
@@ -836,10 +1012,6 @@ struct RTTR_API variant_data_policy_void
             {
                 return false;
             }
-            case variant_policy_operation::IS_VALID:
-            {
-                return true;
-            }
             case variant_policy_operation::CONVERT:
             {
                 return false;
@@ -857,6 +1029,11 @@ struct RTTR_API variant_data_policy_void
             {
                 return false;
             }
+            case variant_policy_operation::HASH:
+            {
+                arg.get_value<std::size_t>() = std::hash<type::type_id>()(type::get<void>().get_id());
+                return true;
+            }
         }
         return true;
     }
@@ -878,6 +1055,11 @@ struct RTTR_API variant_data_policy_void
  */
 struct RTTR_API variant_data_policy_nullptr_t
 {
+    RTTR_STATIC_CONSTEXPR variant_storage_kind storage_kind = variant_storage_kind::INLINE_DATA;
+    RTTR_STATIC_CONSTEXPR bool is_valid = true;
+    RTTR_STATIC_CONSTEXPR bool can_clone = true;
+    RTTR_STATIC_CONSTEXPR std::uint8_t conversion_index = invalid_conversion_index;
+
     static RTTR_INLINE std::nullptr_t& get_value(const variant_data& data)
     {
         return reinterpret_cast<std::nullptr_t&>(const_cast<variant_data&>(data));
@@ -901,25 +1083,36 @@ struct RTTR_API variant_data_policy_nullptr_t
         destroy(value);
     }
 
+    template<typename... Args>
+    static RTTR_INLINE void emplace(variant_data& dest, Args&&... args)
+    {
+        new (&dest) std::nullptr_t(std::forward<Args>(args)...);
+    }
+
+    static void destroy_data(variant_data& data)
+    {
+        destroy(get_value(data));
+    }
+
+    static void clone_data(const variant_data& src_data, variant_data& dest)
+    {
+        clone(get_value(src_data), dest);
+    }
+
+    static void swap_data(variant_data& src_data, variant_data& dest)
+    {
+        swap(get_value(src_data), dest);
+    }
+
+    static type get_type()
+    {
+        return type::get<std::nullptr_t>();
+    }
+
     static bool invoke(variant_policy_operation op, const variant_data& src_data, argument_wrapper arg)
     {
         switch (op)
         {
-            case variant_policy_operation::DESTROY:
-            {
-                destroy(get_value(src_data));
-                break;
-            }
-            case variant_policy_operation::CLONE:
-            {
-                clone(get_value(src_data), arg.get_value<variant_data>());
-                break;
-            }
-            case variant_policy_operation::SWAP:
-            {
-                swap(get_value(src_data), arg.get_value<variant_data>());
-                break;
-            }
             case variant_policy_operation::CREATE_WRAPPED_VALUE:
             {
                 return false;
@@ -928,20 +1121,6 @@ struct RTTR_API variant_data_policy_nullptr_t
             {
                 break;
             }
-            case variant_policy_operation::GET_VALUE:
-            {
-                arg.get_value<const void*>() = &get_value(src_data);
-                break;
-            }
-            case variant_policy_operation::GET_TYPE:
-            {
-                arg.get_value<type>() = type::get<std::nullptr_t>();
-                break;
-            }
-            case variant_policy_operation::GET_PTR:
-            {
-                arg.get_value<void*>() = as_void_ptr(std::addressof(get_value(src_data)));
-            }
             case variant_policy_operation::GET_RAW_TYPE:
             {
                 arg.get_value<type>() = type::get<std::nullptr_t>();
@@ -974,6 +1153,10 @@ struct RTTR_API variant_data_policy_nullptr_t
             {
                 return false;
             }
+            case variant_policy_operation::GET_WRAPPED_VALUE_PTR:
+            {
+                return false;
+            }
             case variant_policy_operation::TO_ARRAY:
             {
                 break;
@@ -986,10 +1169,6 @@ struct RTTR_API variant_data_policy_nullptr_t
             {
                 break;
             }
-            case variant_policy_operation::IS_VALID:
-            {
-                return true;
-            }
             case variant_policy_operation::IS_NULLPTR:
             {
                 return true;
@@ -1015,6 +1194,10 @@ struct RTTR_API variant_data_policy_nullptr_t
                 ok = true;
                 return (lhs.is_nullptr() && !rhs.is_nullptr());
             }
+            case variant_policy_operation::HASH:
+            {
+                return compute_hash(get_value(src_data), arg.get_value<std::size_t>());
+            }
         }
         return true;
     }
@@ -44,7 +44,7 @@ namespace rttr
 /////////////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE variant::variant()
-:   m_policy(&detail::variant_data_policy_empty::invoke)
+:   m_policy(detail::get_variant_policy_table<detail::variant_data_policy_empty>())
 {
 }
 
@@ -52,10 +52,11 @@ RTTR_INLINE variant::variant()
 
 template<typename T, typename Tp>
 RTTR_INLINE variant::variant(T&& val)
-:   m_policy(&detail::variant_policy<Tp>::invoke)
+:   m_policy(detail::get_variant_policy_table<detail::variant_policy<Tp>>())
 {
-    static_assert(std::is_copy_constructible<Tp>::value || std::is_array<Tp>::value,
-                  "The given value is not copy constructible, try to add a copy constructor to the class.");
+    static_assert(std::is_copy_constructible<Tp>::value || std::is_array<Tp>::value ||
+                  (std::is_move_constructible<Tp>::value && !std::is_lvalue_reference<T>::value),
+                  "The given value is neither copy constructible nor an rvalue of a move constructible type, try to add a copy constructor to the class.");
 
     detail::variant_policy<Tp>::create(std::forward<T>(val), m_data);
 }
@@ -64,7 +65,7 @@ RTTR_INLINE variant::variant(T&& val)
 
 RTTR_INLINE variant::~variant()
 {
-   m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
+   m_policy->destroy(m_data);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +79,40 @@ RTTR_INLINE variant& variant::operator=(T&& other)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+RTTR_INLINE const T* variant::try_get_value() const RTTR_NOEXCEPT
+{
+    using nonRef = detail::remove_cv_t<T>;
+    const type target_type = type::get<nonRef>();
+    if (m_policy->get_type() == target_type)
+        return reinterpret_cast<const nonRef*>(m_policy->get_ptr(m_data));
+
+    const void* wrapped_ptr = nullptr;
+    m_policy->invoke(detail::variant_policy_operation::GET_WRAPPED_VALUE_PTR, m_data, std::tie(target_type, wrapped_ptr));
+    return static_cast<const nonRef*>(wrapped_ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename... Args>
+RTTR_INLINE T& variant::emplace(Args&&... args)
+{
+    static_assert(std::is_same<T, detail::decay_except_array_t<T>>::value && !std::is_void<T>::value,
+                  "The given type cannot be placed inside a variant, remove any reference or cv qualifier.");
+    static_assert(!std::is_array<T>::value, "Arrays cannot be constructed in place, use the constructor instead.");
+    static_assert(!std::is_same<T, variant>::value, "A variant cannot be placed inside a variant.");
+
+    using policy = detail::variant_policy<T>;
+
+    clear();
+    policy::emplace(m_data, std::forward<Args>(args)...);
+    m_policy = detail::get_variant_policy_table<policy>();
+
+    return *reinterpret_cast<T*>(m_policy->get_ptr(m_data));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 RTTR_INLINE bool variant::operator==(const variant& other) const
 {
     auto ok = false;
@@ -133,10 +168,8 @@ RTTR_INLINE bool variant::operator>(const variant& other) const
 template<typename T>
 RTTR_INLINE const T& variant::get_value() const
 {
-    const void* value;
-    m_policy(detail::variant_policy_operation::GET_VALUE, m_data, value);
     using nonRef = detail::remove_cv_t<T>;
-    return *reinterpret_cast<const nonRef*>(value);
+    return *reinterpret_cast<const nonRef*>(m_policy->get_ptr(m_data));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -145,7 +178,7 @@ template<typename T>
 RTTR_INLINE const T& variant::get_wrapped_value() const
 {
     detail::data_address_container result{detail::get_invalid_type(), detail::get_invalid_type(), nullptr, nullptr};
-    m_policy(detail::variant_policy_operation::GET_ADDRESS_CONTAINER, m_data, result);
+    m_policy->invoke(detail::variant_policy_operation::GET_ADDRESS_CONTAINER, m_data, result);
     using nonRef = detail::remove_cv_t<T>;
     return *reinterpret_cast<const nonRef*>(result.m_data_address_wrapped_type);
 }
@@ -154,9 +187,7 @@ RTTR_INLINE const T& variant::get_wrapped_value() const
 
 RTTR_INLINE void* variant::get_ptr() const
 {
-    void* value;
-    m_policy(detail::variant_policy_operation::GET_PTR, m_data, value);
-    return value;
+    return m_policy->get_ptr(m_data);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -164,7 +195,7 @@ RTTR_INLINE void* variant::get_ptr() const
 RTTR_INLINE type variant::get_raw_type() const
 {
     type result = detail::get_invalid_type();
-    m_policy(detail::variant_policy_operation::GET_RAW_TYPE, m_data, result);
+    m_policy->invoke(detail::variant_policy_operation::GET_RAW_TYPE, m_data, result);
     return result;
 }
 
@@ -173,7 +204,7 @@ RTTR_INLINE type variant::get_raw_type() const
 RTTR_INLINE void* variant::get_raw_ptr() const
 {
     void* result;
-    m_policy(detail::variant_policy_operation::GET_RAW_PTR, m_data, result);
+    m_policy->invoke(detail::variant_policy_operation::GET_RAW_PTR, m_data, result);
     return result;
 }
 
@@ -182,7 +213,7 @@ RTTR_INLINE void* variant::get_raw_ptr() const
 RTTR_INLINE detail::data_address_container variant::get_data_address_container() const
 {
     detail::data_address_container result{detail::get_invalid_type(), detail::get_invalid_type(), nullptr, nullptr};
-    m_policy(detail::variant_policy_operation::GET_ADDRESS_CONTAINER, m_data, result);
+    m_policy->invoke(detail::variant_policy_operation::GET_ADDRESS_CONTAINER, m_data, result);
     return result;
 }
 
@@ -191,9 +222,7 @@ RTTR_INLINE detail::data_address_container variant::get_data_address_container()
 template<typename T>
 RTTR_INLINE bool variant::is_type() const
 {
-    type src_type = detail::get_invalid_type();
-    m_policy(detail::variant_policy_operation::GET_TYPE, m_data, src_type);
-    return (type::get<T>() == src_type);
+    return (type::get<T>() == m_policy->get_type());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -209,7 +238,7 @@ RTTR_INLINE bool variant::can_convert() const
 template<typename T>
 RTTR_INLINE bool variant::try_basic_type_conversion(T& to) const
 {
-    return m_policy(detail::variant_policy_operation::CONVERT, m_data, argument(to));
+    return m_policy->invoke(detail::variant_policy_operation::CONVERT, m_data, argument(to));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -257,7 +286,7 @@ RTTR_INLINE variant::try_pointer_conversion(T& to, const type& source_type, cons
 
 RTTR_INLINE bool variant::is_nullptr() const
 {
-    return m_policy(detail::variant_policy_operation::IS_NULLPTR, m_data, detail::argument_wrapper());
+    return m_policy->invoke(detail::variant_policy_operation::IS_NULLPTR, m_data, detail::argument_wrapper());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +313,16 @@ static RTTR_INLINE ptr_to_nullptr(T& to)
 template<typename T>
 RTTR_INLINE bool variant::convert(T& value) const
 {
+    // a conversion between two basic types is directly dispatched via the precomputed conversion table
+    const std::uint8_t source_index = m_policy->conversion_index;
+    const bool is_basic_conversion = (source_index != detail::invalid_conversion_index &&
+                                      detail::basic_conversion_index<T>::value != detail::invalid_conversion_index);
+    if (is_basic_conversion &&
+        detail::convert_basic_type(source_index, detail::basic_conversion_index<T>::value, get_ptr(), &value))
+    {
+        return true;
+    }
+
     bool ok = false;
 
     const type source_type = get_type();
@@ -305,7 +344,7 @@ RTTR_INLINE bool variant::convert(T& value) const
         value = const_cast<variant&>(*this).get_value<T>();
         ok = true;
     }
-    else if(try_basic_type_conversion(value))
+    else if (!is_basic_conversion && try_basic_type_conversion(value))
     {
         ok = true;
     }
@@ -392,6 +431,27 @@ RTTR_INLINE T variant::convert(bool* ok) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+RTTR_INLINE bool variant_equal_to::operator()(const variant& lhs, const variant& rhs) const
+{
+    return (lhs.get_type() == rhs.get_type() && lhs == rhs);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
+namespace std
+{
+    // consistent with 'rttr::variant_equal_to', but not with the 'operator==' of values of different types
+    template <>
+    struct hash<rttr::variant>
+    {
+    public:
+        size_t operator()(const rttr::variant& var) const
+        {
+            return var.get_hash();
+        }
+    };
+} // end namespace std
+
 #endif // RTTR_VARIANT_IMPL_H_
@@ -51,6 +51,7 @@ class RTTR_LOCAL variant_sequential_view_private
             m_get_is_empty_func(sequential_container_empty::is_empty),
             m_get_size_func(sequential_container_empty::get_size),
             m_set_size_func(sequential_container_empty::set_size),
+            m_get_data_address_func(sequential_container_empty::get_data_address),
             m_is_dynamic_func(sequential_container_empty::is_dynamic),
             m_get_rank_func(sequential_container_empty::get_rank),
             m_get_rank_type_func(sequential_container_empty::get_rank_type),
@@ -77,6 +78,7 @@ class RTTR_LOCAL variant_sequential_view_private
             m_get_is_empty_func(sequential_container_mapper_wrapper<RawType, ConstType>::is_empty),
             m_get_size_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_size),
             m_set_size_func(sequential_container_mapper_wrapper<RawType, ConstType>::set_size),
+            m_get_data_address_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_data_address),
             m_is_dynamic_func(sequential_container_mapper_wrapper<RawType, ConstType>::is_dynamic),
             m_get_rank_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_rank),
             m_get_rank_type_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_rank_type),
@@ -162,6 +164,11 @@ class RTTR_LOCAL variant_sequential_view_private
             return m_set_size_func(m_container, size);
         }
 
+        RTTR_FORCE_INLINE void* get_data_address() const RTTR_NOEXCEPT
+        {
+            return m_get_data_address_func(m_container);
+        }
+
         RTTR_FORCE_INLINE bool equal(const iterator_data& lhs_itr, const iterator_data& rhs_itr) const RTTR_NOEXCEPT
         {
             return m_equal_func(lhs_itr, rhs_itr);
@@ -210,6 +217,7 @@ class RTTR_LOCAL variant_sequential_view_private
         using get_is_empty_func = bool(*)(void* container);
         using get_size_func     = std::size_t(*)(void* container);
         using set_size_func     = bool(*)(void* container, std::size_t size);
+        using get_data_address_func = void*(*)(void* container);
         using get_rank_func     = std::size_t(*)(void);
         using get_rank_type_func= type(*)(std::size_t index);
         using begin_func        = void(*)(void* container, iterator_data& itr);
@@ -231,6 +239,7 @@ class RTTR_LOCAL variant_sequential_view_private
         get_is_empty_func       m_get_is_empty_func;
         get_size_func           m_get_size_func;
         set_size_func           m_set_size_func;
+        get_data_address_func   m_get_data_address_func;
         is_dynamic_func         m_is_dynamic_func;
         get_rank_func           m_get_rank_func;
         get_rank_type_func      m_get_rank_type_func;
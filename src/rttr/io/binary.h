@@ -0,0 +1,115 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_IO_BINARY_H_
+#define RTTR_IO_BINARY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <string>
+#include <iosfwd>
+
+namespace rttr
+{
+class instance;
+
+namespace io
+{
+
+/*!
+ * \brief Serializes the public properties of the given object \p obj into a compact binary format.
+ *
+ * The same properties as for \ref to_json() are written: integers as variable length integers,
+ * enumerations as their underlying value and strings with a length prefix.
+ * Sequential containers of arithmetic values, which are stored contiguously (e.g. `std::vector<float>`),
+ * are copied as one block of bytes. Such blocks are aligned to the size of their elements,
+ * so a \ref binary_document can access them in place.
+ *
+ * The names and kinds of the properties of every class are written only once per stream, as schema
+ * with a fingerprint; the objects itself contain only the values in the order of the schema.
+ * At most 256 objects and containers can be nested; e.g. objects, which refer to each other via pointers, cannot be written.
+ *
+ * \return The binary data; when \p obj is not valid or a property value could not be serialized, an empty string.
+ */
+RTTR_API std::string to_binary(instance obj);
+
+/*!
+ * \brief Serializes the given object \p obj in binary format into the output stream \p out.
+ *
+ * The data is written in chunks of \p chunk_size bytes.
+ *
+ * \return `true` when \p obj could be serialized and all chunks could be written, otherwise `false`.
+ */
+RTTR_API bool to_binary(instance obj, std::ostream& out, std::size_t chunk_size = 64 * 1024);
+
+/*!
+ * \brief Serializes the given object \p obj in binary format into the file descriptor \p fd.
+ *
+ * The data is written in chunks of \p chunk_size bytes with the system call `write()`.
+ *
+ * \return `true` when \p obj could be serialized and all chunks could be written, otherwise `false`.
+ */
+RTTR_API bool to_binary(instance obj, int fd, std::size_t chunk_size = 64 * 1024);
+
+/*!
+ * \brief Deserializes the binary data \p data, written by \ref to_binary(), into the given object \p obj.
+ *
+ * Objects, whose schema matches the properties of the target type, are read directly.
+ * Otherwise the data was written by another version of the type; then the values are assigned by property name:
+ * values of removed properties or of properties, whose type cannot be converted anymore, are skipped;
+ * new properties keep their current value.
+ *
+ * Nested objects are filled in place; the values of an object are skipped, when a pointer property is null.
+ *
+ * \return `true` when the data was read completely, otherwise `false`; e.g. when the data is truncated or malformed.
+ */
+RTTR_API bool from_binary(string_view data, instance obj);
+
+/*!
+ * \brief Deserializes the binary data read from the input stream \p in into the given object \p obj.
+ *
+ * The stream is read in chunks of \p chunk_size bytes, while the properties are set.
+ *
+ * \return `true` when the data was read completely, otherwise `false`.
+ */
+RTTR_API bool from_binary(std::istream& in, instance obj, std::size_t chunk_size = 64 * 1024);
+
+/*!
+ * \brief Deserializes the binary data read from the file descriptor \p fd into the given object \p obj.
+ *
+ * The file descriptor is read with the system call `read()` in chunks of \p chunk_size bytes, while the properties are set.
+ *
+ * \return `true` when the data was read completely, otherwise `false`.
+ */
+RTTR_API bool from_binary(int fd, instance obj, std::size_t chunk_size = 64 * 1024);
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_IO_BINARY_H_
@@ -0,0 +1,612 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/io/binary_document.h"
+
+#include "rttr/detail/io/binary_decoder.h"
+#include "rttr/instance.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The positions of the fields of an object or of the elements of a container inside a \ref io::binary_document.
+ */
+struct value_layout
+{
+    //! The schema of an object; `nullptr` for a null object and for containers.
+    const stream_schema*    m_schema;
+    //! The kind of the elements of a sequential container.
+    field_kind              m_element_kind;
+    //! The number of fields or elements.
+    uint64_t                m_size;
+    //! The positions of the values found so far; it starts with the position of the first value.
+    std::vector<uint64_t>   m_positions;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class binary_document_private
+{
+    public:
+        binary_document_private()
+        :   m_mapping(nullptr), m_mapping_size(0)
+        {
+        }
+
+        ~binary_document_private()
+        {
+            if (!m_mapping)
+                return;
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+            ::UnmapViewOfFile(m_mapping);
+#else
+            ::munmap(m_mapping, m_mapping_size);
+#endif
+        }
+
+        /*!
+         * Uses the data \p data, after its header was checked.
+         */
+        bool open(string_view data)
+        {
+            if (reinterpret_cast<std::uintptr_t>(data.data()) % sizeof(uint64_t) != 0)
+            {
+                // the arithmetic containers are aligned relative to the start of the data
+                m_copy.resize((data.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+                std::memcpy(m_copy.data(), data.data(), data.size());
+                data = string_view(reinterpret_cast<const char*>(m_copy.data()), data.size());
+            }
+
+            m_data = data;
+            memory_input_stream stream(m_data);
+            binary_decoder<memory_input_stream> decoder(stream, m_schemas);
+            return decoder.read_header();
+        }
+
+        bool map_file(const std::string& file_name)
+        {
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+            HANDLE file = ::CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return false;
+
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+            {
+                ::CloseHandle(file);
+                return false;
+            }
+
+            HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            ::CloseHandle(file);
+            if (!mapping)
+                return false;
+
+            // the view keeps the mapping alive
+            m_mapping = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(mapping);
+            if (!m_mapping)
+                return false;
+
+            m_mapping_size = static_cast<std::size_t>(size.QuadPart);
+#else
+            const int fd = ::open(file_name.c_str(), O_RDONLY);
+            if (fd < 0)
+                return false;
+
+            struct stat info;
+            if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+            {
+                ::close(fd);
+                return false;
+            }
+
+            // the pages are shared with every other process, which maps the same file
+            void* address = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (address == MAP_FAILED)
+                return false;
+
+            m_mapping = address;
+            m_mapping_size = static_cast<std::size_t>(info.st_size);
+#endif
+            return open(string_view(static_cast<const char*>(m_mapping), m_mapping_size));
+        }
+
+        string_view get_data() const { return m_data; }
+
+        schema_table& get_schemas() { return m_schemas; }
+
+        /*!
+         * Returns the layout of the object or container of kind \p kind at position \p position;
+         * `nullptr`, when the value is no object or container or it is malformed.
+         */
+        value_layout* get_layout(uint64_t position, field_kind kind)
+        {
+            if (is_scalar_kind(kind))
+                return nullptr;
+
+            auto itr = m_layouts.find(position);
+            if (itr != m_layouts.end())
+                return &itr->second;
+
+            memory_input_stream stream(m_data);
+            stream.seek(static_cast<std::size_t>(position));
+            binary_decoder<memory_input_stream> decoder(stream, m_schemas);
+
+            value_layout layout{nullptr, field_kind::OTHER, 0, {}};
+            if (kind == field_kind::OBJECT)
+            {
+                stream_schema* schema = nullptr;
+                if (!decoder.read_schema(schema))
+                    return nullptr;
+
+                layout.m_schema = schema;
+                layout.m_size = schema ? schema->m_schema.m_fields.size() : 0;
+            }
+            else if (!decoder.read_size(layout.m_size) ||
+                     (kind == field_kind::SEQUENTIAL && layout.m_size > 0 && !decoder.read_element_kind(layout.m_element_kind)))
+            {
+                return nullptr;
+            }
+
+            const std::size_t width = get_fixed_width(layout.m_element_kind);
+            if (width > 0 && (layout.m_size > (m_data.size() - stream.Tell()) / width))
+                return nullptr; // truncated
+
+            layout.m_positions.push_back(stream.Tell());
+            return &m_layouts.emplace(position, std::move(layout)).first->second;
+        }
+
+        /*!
+         * Returns the position of the value with index \p index of the object or sequential container \p layout;
+         * `0`, when the value cannot be found.
+         */
+        uint64_t get_position(value_layout& layout, std::size_t index)
+        {
+            if (index >= layout.m_size)
+                return 0;
+
+            if (!layout.m_schema)
+            {
+                const std::size_t width = get_fixed_width(layout.m_element_kind);
+                if (width > 0)
+                    return layout.m_positions.front() + index * width;
+            }
+
+            if (index < layout.m_positions.size())
+                return layout.m_positions[index];
+
+            memory_input_stream stream(m_data);
+            stream.seek(static_cast<std::size_t>(layout.m_positions.back()));
+            binary_decoder<memory_input_stream> decoder(stream, m_schemas);
+            while (layout.m_positions.size() <= index)
+            {
+                const std::size_t skipped = layout.m_positions.size() - 1;
+                const bool ok = layout.m_schema ? decoder.skip_value(layout.m_schema->m_schema.m_fields[skipped].m_kind, false)
+                                                : decoder.skip_value(layout.m_element_kind, true);
+                if (!ok)
+                    return 0;
+
+                layout.m_positions.push_back(stream.Tell());
+            }
+
+            return layout.m_positions[index];
+        }
+
+    private:
+        string_view                                     m_data;
+        //! An aligned copy of data, which was not aligned.
+        std::vector<uint64_t>                           m_copy;
+        void*                                           m_mapping;
+        std::size_t                                     m_mapping_size;
+        schema_table                                    m_schemas;
+        //! The layouts of the objects and containers accessed so far, indexed by their position.
+        std::unordered_map<uint64_t, value_layout>      m_layouts;
+};
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace io
+{
+namespace
+{
+
+using detail::field_kind;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the type of the arithmetic elements of kind \p kind, which have a fixed width.
+ */
+type get_element_type(field_kind kind)
+{
+    switch (kind)
+    {
+        case field_kind::CHAR:      return type::get<char>();
+        case field_kind::INT8:      return type::get<int8_t>();
+        case field_kind::INT16:     return type::get<int16_t>();
+        case field_kind::INT32:     return type::get<int32_t>();
+        case field_kind::INT64:     return type::get<int64_t>();
+        case field_kind::UINT8:     return type::get<uint8_t>();
+        case field_kind::UINT16:    return type::get<uint16_t>();
+        case field_kind::UINT32:    return type::get<uint32_t>();
+        case field_kind::UINT64:    return type::get<uint64_t>();
+        case field_kind::FLOAT:     return type::get<float>();
+        case field_kind::DOUBLE:    return type::get<double>();
+        default:                    return detail::get_invalid_type();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+variant create_array(const void* data, std::size_t size)
+{
+    return mapped_array<T>(static_cast<const T*>(data), size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant create_array(field_kind kind, const void* data, std::size_t size)
+{
+    switch (kind)
+    {
+        case field_kind::CHAR:      return create_array<char>(data, size);
+        case field_kind::INT8:      return create_array<int8_t>(data, size);
+        case field_kind::INT16:     return create_array<int16_t>(data, size);
+        case field_kind::INT32:     return create_array<int32_t>(data, size);
+        case field_kind::INT64:     return create_array<int64_t>(data, size);
+        case field_kind::UINT8:     return create_array<uint8_t>(data, size);
+        case field_kind::UINT16:    return create_array<uint16_t>(data, size);
+        case field_kind::UINT32:    return create_array<uint32_t>(data, size);
+        case field_kind::UINT64:    return create_array<uint64_t>(data, size);
+        case field_kind::FLOAT:     return create_array<float>(data, size);
+        case field_kind::DOUBLE:    return create_array<double>(data, size);
+        default:                    return variant();
+    }
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value::binary_value() RTTR_NOEXCEPT
+:   m_document(nullptr),
+    m_position(0),
+    m_kind(0),
+    m_fixed_width(false)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value::binary_value(detail::binary_document_private* document, uint64_t position, uint8_t kind, bool fixed_width) RTTR_NOEXCEPT
+:   m_document(document),
+    m_position(position),
+    m_kind(kind),
+    m_fixed_width(fixed_width)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_value::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_document != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_document != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_value::is_object() const
+{
+    if (!m_document)
+        return false;
+
+    const auto layout = m_document->get_layout(m_position, static_cast<field_kind>(m_kind));
+    return (layout && layout->m_schema);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_value::is_sequential_container() const RTTR_NOEXCEPT
+{
+    return (m_document && static_cast<field_kind>(m_kind) == field_kind::SEQUENTIAL);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_value::is_associative_container() const RTTR_NOEXCEPT
+{
+    return (m_document && static_cast<field_kind>(m_kind) == field_kind::ASSOCIATIVE);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t binary_value::get_size() const
+{
+    if (!m_document)
+        return 0;
+
+    const auto layout = m_document->get_layout(m_position, static_cast<field_kind>(m_kind));
+    return (layout ? static_cast<std::size_t>(layout->m_size) : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view binary_value::get_field_name(std::size_t index) const
+{
+    if (!m_document)
+        return string_view();
+
+    const auto layout = m_document->get_layout(m_position, static_cast<field_kind>(m_kind));
+    if (!layout || !layout->m_schema || index >= layout->m_schema->m_schema.m_fields.size())
+        return string_view();
+
+    return layout->m_schema->m_schema.m_fields[index].m_name;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value binary_value::get_field(string_view name) const
+{
+    if (!m_document)
+        return binary_value();
+
+    const auto layout = m_document->get_layout(m_position, static_cast<field_kind>(m_kind));
+    if (!layout || !layout->m_schema)
+        return binary_value();
+
+    const auto& fields = layout->m_schema->m_schema.m_fields;
+    for (std::size_t index = 0; index < fields.size(); ++index)
+    {
+        if (name == fields[index].m_name)
+            return get_field(index);
+    }
+
+    return binary_value();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value binary_value::get_field(std::size_t index) const
+{
+    if (!m_document)
+        return binary_value();
+
+    const auto layout = m_document->get_layout(m_position, static_cast<field_kind>(m_kind));
+    if (!layout || !layout->m_schema)
+        return binary_value();
+
+    const uint64_t position = m_document->get_position(*layout, index);
+    if (position == 0)
+        return binary_value();
+
+    const auto kind = layout->m_schema->m_schema.m_fields[index].m_kind;
+    return binary_value(m_document, position, static_cast<uint8_t>(kind), false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value binary_value::get_element(std::size_t index) const
+{
+    if (!is_sequential_container())
+        return binary_value();
+
+    const auto layout = m_document->get_layout(m_position, field_kind::SEQUENTIAL);
+    if (!layout)
+        return binary_value();
+
+    const uint64_t position = m_document->get_position(*layout, index);
+    if (position == 0)
+        return binary_value();
+
+    return binary_value(m_document, position, static_cast<uint8_t>(layout->m_element_kind), true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant binary_value::get_value() const
+{
+    if (!m_document)
+        return variant();
+
+    const auto kind = static_cast<field_kind>(m_kind);
+    const string_view data = m_document->get_data();
+    if (kind == field_kind::SEQUENTIAL)
+    {
+#if RTTR_ENDIAN == RTTR_ENDIAN_LITTLE
+        const auto layout = m_document->get_layout(m_position, kind);
+        if (layout && layout->m_size > 0)
+            return create_array(layout->m_element_kind, data.data() + layout->m_positions.front(),
+                                static_cast<std::size_t>(layout->m_size));
+#endif
+        return variant();
+    }
+
+    if (!detail::is_scalar_kind(kind))
+        return variant();
+
+    detail::memory_input_stream stream(data);
+    stream.seek(static_cast<std::size_t>(m_position));
+    detail::binary_decoder<detail::memory_input_stream> decoder(stream, m_document->get_schemas());
+
+    variant result;
+    if (kind == field_kind::STRING || kind == field_kind::OTHER)
+    {
+        uint64_t size = 0;
+        if (decoder.read_size(size))
+            result = string_view(data.data() + stream.Tell(), static_cast<std::size_t>(size));
+    }
+    else if (!decoder.decode_scalar(kind, m_fixed_width, result))
+    {
+        result = variant();
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const void* binary_value::get_array_data(const type& element_type, std::size_t& size) const
+{
+    size = 0;
+#if RTTR_ENDIAN == RTTR_ENDIAN_LITTLE
+    if (!is_sequential_container())
+        return nullptr;
+
+    const auto layout = m_document->get_layout(m_position, field_kind::SEQUENTIAL);
+    if (!layout || layout->m_size == 0 || get_element_type(layout->m_element_kind) != element_type)
+        return nullptr;
+
+    size = static_cast<std::size_t>(layout->m_size);
+    return (m_document->get_data().data() + layout->m_positions.front());
+#else
+    (void)element_type;
+    return nullptr;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_value::read(instance obj) const
+{
+    using decoder_t = detail::binary_decoder<detail::memory_input_stream>;
+    if (!is_object() || !decoder_t::get_object(obj).is_valid())
+        return false;
+
+    detail::memory_input_stream stream(m_document->get_data());
+    stream.seek(static_cast<std::size_t>(m_position));
+    decoder_t decoder(stream, m_document->get_schemas());
+    return decoder.read_object(obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_document::binary_document()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_document::binary_document(string_view data)
+:   m_document(new detail::binary_document_private)
+{
+    if (!m_document->open(data))
+        m_document.reset();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_document::binary_document(binary_document&& other) RTTR_NOEXCEPT
+:   m_document(std::move(other.m_document))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_document& binary_document::operator=(binary_document&& other) RTTR_NOEXCEPT
+{
+    m_document = std::move(other.m_document);
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_document::~binary_document()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_document binary_document::map_file(const std::string& file_name)
+{
+    binary_document result;
+    result.m_document.reset(new detail::binary_document_private);
+    if (!result.m_document->map_file(file_name))
+        result.m_document.reset();
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_document::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_document != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_value binary_document::get_root() const
+{
+    if (!m_document)
+        return binary_value();
+
+    return binary_value(m_document.get(), sizeof(detail::binary_magic) + 1, static_cast<uint8_t>(field_kind::OBJECT), false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
@@ -0,0 +1,358 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_IO_BINARY_DOCUMENT_H_
+#define RTTR_IO_BINARY_DOCUMENT_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+#include "rttr/type.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace rttr
+{
+class instance;
+
+namespace detail
+{
+class binary_document_private;
+}
+
+namespace io
+{
+
+/*!
+ * The class template \ref mapped_array describes a read-only reference to a contiguous block of arithmetic values
+ * inside the data of a \ref binary_document; the values are not copied.
+ *
+ * It is a sequential container, so a \ref variant, which holds a \ref mapped_array, can create a
+ * \ref variant_sequential_view "sequential view" to the values.
+ */
+template<typename T>
+class mapped_array
+{
+    public:
+        using value_type        = T;
+        using const_iterator    = const T*;
+
+        mapped_array() RTTR_NOEXCEPT : m_data(nullptr), m_size(0) { }
+        mapped_array(const T* data, std::size_t size) RTTR_NOEXCEPT : m_data(data), m_size(size) { }
+
+        const T* data() const RTTR_NOEXCEPT { return m_data; }
+        std::size_t size() const RTTR_NOEXCEPT { return m_size; }
+        bool empty() const RTTR_NOEXCEPT { return (m_size == 0); }
+
+        const_iterator begin() const RTTR_NOEXCEPT { return m_data; }
+        const_iterator end() const RTTR_NOEXCEPT { return m_data + m_size; }
+
+        const T& operator[](std::size_t index) const RTTR_NOEXCEPT { return m_data[index]; }
+
+    private:
+        const T*    m_data;
+        std::size_t m_size;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref binary_value class is a handle to one value inside a \ref binary_document:
+ * the root object, a field of an object or an element of a sequential container.
+ *
+ * A handle does not read the value; it only knows its position and its kind.
+ * Arithmetic values and strings are returned by \ref get_value() without any copy of the containing data;
+ * objects are read into real objects only, when \ref read() is called for them.
+ *
+ * The positions of the fields of an object and of the elements of a container, which are not arithmetic,
+ * are found on first access by skipping over the preceding values; the positions are cached in the document.
+ *
+ * \remark A handle is valid as long as its \ref binary_document is alive.
+ *         Handles of the same document must not be used concurrently from different threads.
+ */
+class RTTR_API binary_value
+{
+    public:
+        /*!
+         * Creates an invalid handle.
+         */
+        binary_value() RTTR_NOEXCEPT;
+
+        /*!
+         * Returns `true`, when this handle refers to a value.
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * Convenience function to check whether this handle refers to a value.
+         */
+        explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * Returns `true`, when the value is an object, which is not null.
+         */
+        bool is_object() const;
+
+        /*!
+         * Returns `true`, when the value is a sequential container.
+         */
+        bool is_sequential_container() const RTTR_NOEXCEPT;
+
+        /*!
+         * Returns `true`, when the value is an associative container.
+         */
+        bool is_associative_container() const RTTR_NOEXCEPT;
+
+        /*!
+         * Returns the number of fields of an object or the number of elements of a container; otherwise `0`.
+         */
+        std::size_t get_size() const;
+
+        /*!
+         * Returns the name of the field with index \p index of an object, as it was written;
+         * an empty string, when there is no such field.
+         */
+        string_view get_field_name(std::size_t index) const;
+
+        /*!
+         * Returns the field with the name \p name of an object;
+         * an invalid handle, when this value is not an object or has no such field.
+         */
+        binary_value get_field(string_view name) const;
+
+        /*!
+         * Returns the field with the index \p index of an object;
+         * an invalid handle, when this value is not an object or has no such field.
+         */
+        binary_value get_field(std::size_t index) const;
+
+        /*!
+         * Returns the element with the index \p index of a sequential container;
+         * an invalid handle, when this value is no sequential container or the index is out of range.
+         */
+        binary_value get_element(std::size_t index) const;
+
+        /*!
+         * Returns the value as \ref variant, which refers to the data of the document whenever possible:
+         *  - `bool`, characters, integers and floating point values are returned by value
+         *  - enumerations as their underlying value of type `int64_t`
+         *  - strings and other types, which were written as string, as \ref string_view to the data of the document
+         *  - sequential containers of arithmetic values (except `bool`) as \ref mapped_array "mapped_array<T>"
+         *    of the element type; the elements are not copied
+         *
+         * For objects, associative containers, empty containers and all other sequential containers
+         * an invalid \ref variant is returned.
+         *
+         * \remark On big endian platforms, arithmetic containers cannot be mapped and are not returned.
+         */
+        variant get_value() const;
+
+        /*!
+         * Returns the elements of a sequential container with elements of type \p T, without a copy of the elements.
+         * An empty array is returned, when this value is no such container.
+         */
+        template<typename T>
+        mapped_array<T> get_array() const;
+
+        /*!
+         * Reads the object into \p obj, exactly like \ref from_binary() does.
+         * Only the data of this object is read; other parts of the document remain untouched.
+         *
+         * \return `true`, when this value is an object and could be read, otherwise `false`.
+         */
+        bool read(instance obj) const;
+
+    private:
+        friend class binary_document;
+
+        binary_value(detail::binary_document_private* document, uint64_t position, uint8_t kind, bool fixed_width) RTTR_NOEXCEPT;
+
+        const void* get_array_data(const type& element_type, std::size_t& size) const;
+
+    private:
+        detail::binary_document_private*    m_document;
+        uint64_t                            m_position;
+        uint8_t                             m_kind;
+        bool                                m_fixed_width;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The \ref binary_document class provides access to binary data written by \ref to_binary(),
+ * without reading the data up front.
+ *
+ * The data can be referenced in memory or mapped from a file with \ref map_file().
+ * Creating a document only checks the header; all values are accessed through \ref binary_value handles,
+ * starting with \ref get_root(). Mapped files are shared between all processes, which map the same file;
+ * a page is only loaded, when one of its values is accessed.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *  io::binary_document doc = io::binary_document::map_file("scene.bin");
+ *  io::mapped_array<float> vertices = doc.get_root().get_field("vertices").get_array<float>(); // no copy
+ *  material mat;
+ *  doc.get_root().get_field("material").read(mat); // only this object is deserialized
+ * \endcode
+ *
+ * \remark A document and its handles must not be used concurrently from different threads.
+ */
+class RTTR_API binary_document
+{
+    public:
+        /*!
+         * Creates an invalid document.
+         */
+        binary_document();
+
+        /*!
+         * Creates a document for the binary data \p data; the data has to stay alive as long as the document.
+         *
+         * When \p data is not aligned to 8 bytes, the data is copied, so the arithmetic containers can be accessed in place.
+         */
+        explicit binary_document(string_view data);
+
+        binary_document(binary_document&& other) RTTR_NOEXCEPT;
+        binary_document& operator=(binary_document&& other) RTTR_NOEXCEPT;
+
+        ~binary_document();
+
+        /*!
+         * Maps the file with the name \p file_name read-only into memory and creates a document for its data.
+         *
+         * \return The document; an invalid document, when the file could not be mapped or does not contain binary data.
+         */
+        static binary_document map_file(const std::string& file_name);
+
+        /*!
+         * Returns `true`, when the document refers to data written by \ref to_binary().
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * Returns the root object of the document; an invalid handle, when the document is not valid.
+         */
+        binary_value get_root() const;
+
+    private:
+        binary_document(const binary_document&) = delete;
+        binary_document& operator=(const binary_document&) = delete;
+
+    private:
+        std::unique_ptr<detail::binary_document_private> m_document;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+mapped_array<T> binary_value::get_array() const
+{
+    std::size_t size = 0;
+    const void* data = get_array_data(type::get<T>(), size);
+    return mapped_array<T>(static_cast<const T*>(data), size);
+}
+
+} // end namespace io
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct sequential_container_mapper<io::mapped_array<T>>
+{
+    using container_t   = io::mapped_array<T>;
+    using value_t       = T;
+    using itr_t         = typename io::mapped_array<T>::const_iterator;
+    using const_itr_t   = typename io::mapped_array<T>::const_iterator;
+
+    static bool is_dynamic()
+    {
+        return false;
+    }
+
+    static const value_t& get_data(const itr_t& itr)
+    {
+        return *itr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    static itr_t begin(const container_t& container)
+    {
+        return container.begin();
+    }
+
+    static itr_t end(const container_t& container)
+    {
+        return container.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    static void clear(container_t&)
+    {
+    }
+
+    static bool is_empty(const container_t& container)
+    {
+        return container.empty();
+    }
+
+    static std::size_t get_size(const container_t& container)
+    {
+        return container.size();
+    }
+
+    static bool set_size(container_t&, std::size_t)
+    {
+        return false;
+    }
+
+    static itr_t erase(container_t& container, const itr_t&)
+    {
+        return end(container);
+    }
+
+    static itr_t insert(container_t& container, const value_t&, const itr_t&)
+    {
+        return end(container);
+    }
+
+    static const value_t& get_value(const container_t& container, std::size_t index)
+    {
+        return container[index];
+    }
+};
+
+} // end namespace rttr
+
+#endif // RTTR_IO_BINARY_DOCUMENT_H_
@@ -0,0 +1,91 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/io/binary.h"
+
+#include "rttr/detail/io/binary_decoder.h"
+#include "rttr/detail/io/chunked_stream.h"
+#include "rttr/instance.h"
+
+#include <istream>
+#include <new>
+
+namespace rttr
+{
+namespace io
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Stream>
+bool read_document(Stream& stream, const instance& obj)
+{
+    detail::schema_table schemas;
+    detail::binary_decoder<Stream> decoder(stream, schemas);
+    try
+    {
+        return decoder.read_document(obj);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false; // a size in the data is larger than the available memory
+    }
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_binary(string_view data, instance obj)
+{
+    detail::memory_input_stream stream(data);
+    return read_document(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_binary(std::istream& in, instance obj, std::size_t chunk_size)
+{
+    detail::chunked_input_stream stream(&detail::read_from_istream, &in, chunk_size);
+    return read_document(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_binary(int fd, instance obj, std::size_t chunk_size)
+{
+    detail::chunked_input_stream stream(&detail::read_from_fd, &fd, chunk_size);
+    return read_document(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
@@ -0,0 +1,412 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/io/binary.h"
+
+#include "rttr/detail/io/binary_format.h"
+#include "rttr/detail/io/chunked_stream.h"
+#include "rttr/detail/io/serialization_plan.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace rttr
+{
+namespace io
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+const T& read_value(const variant& var, bool is_wrapped)
+{
+    return (is_wrapped ? var.get_wrapped_value<T>() : var.get_value<T>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes objects in the binary format described in "binary_format.h" into a stream,
+ * which provides the member functions `Put(char)`, `write(const char*, std::size_t)` and `Tell()`.
+ */
+template<typename Stream>
+class binary_encoder
+{
+    public:
+        explicit binary_encoder(Stream& stream)
+        :   m_stream(stream)
+        {
+        }
+
+        /*!
+         * Writes the header and the object \p obj.
+         *
+         * \return `false`, when the value of a property could not be serialized.
+         */
+        bool write_document(const instance& obj)
+        {
+            m_stream.write(detail::binary_magic, sizeof(detail::binary_magic));
+            write_byte(detail::binary_version);
+            write_object(obj, detail::get_type_plan(obj.get_derived_type()));
+            return m_ok;
+        }
+
+    private:
+        void write_byte(uint8_t value)
+        {
+            m_stream.Put(static_cast<char>(value));
+        }
+
+        void write_varint(uint64_t value)
+        {
+            char buffer[detail::max_varint_size];
+            m_stream.write(buffer, detail::encode_varint(value, buffer));
+        }
+
+        //! Aligns the following block of arithmetic values of \p width bytes.
+        void write_padding(std::size_t width)
+        {
+            static const char zeros[8] = {};
+            m_stream.write(zeros, detail::get_padding(m_stream.Tell(), width));
+        }
+
+        template<typename T>
+        void write_fixed(T value)
+        {
+            char buffer[sizeof(T)];
+            std::memcpy(buffer, &value, sizeof(T));
+            detail::swap_to_little_endian(buffer, sizeof(T));
+            m_stream.write(buffer, sizeof(T));
+        }
+
+        /*!
+         * Writes an integer as varint; or with its fixed width, when it is an element of a sequential container.
+         */
+        template<typename T>
+        void write_integer(T value, bool fixed_width)
+        {
+            if (fixed_width)
+                write_fixed(value);
+            else if (std::is_signed<T>::value)
+                write_varint(detail::zigzag_encode(static_cast<int64_t>(value)));
+            else
+                write_varint(static_cast<uint64_t>(value));
+        }
+
+        void write_string(string_view text)
+        {
+            write_varint(text.size());
+            m_stream.write(text.data(), text.size());
+        }
+
+        void write_enum(const variant& var)
+        {
+            bool ok = false;
+            int64_t value = var.to_int64(&ok);
+            if (!ok)
+                value = static_cast<int64_t>(var.to_uint64(&ok));
+
+            m_ok &= ok;
+            write_varint(detail::zigzag_encode(value));
+        }
+
+        /*!
+         * Writes the value \p var, which holds a value of type `plan.m_type` directly or wrapped (\p is_wrapped).
+         */
+        void write_planned_value(const variant& var, bool is_wrapped, const detail::value_plan& plan, bool fixed_width)
+        {
+            using detail::field_kind;
+            switch (plan.m_kind)
+            {
+                case field_kind::BOOL:        write_byte(read_value<bool>(var, is_wrapped) ? 1 : 0); break;
+                case field_kind::CHAR:        write_byte(static_cast<uint8_t>(read_value<char>(var, is_wrapped))); break;
+                case field_kind::INT8:        write_byte(static_cast<uint8_t>(read_value<int8_t>(var, is_wrapped))); break;
+                case field_kind::INT16:       write_integer(read_value<int16_t>(var, is_wrapped), fixed_width); break;
+                case field_kind::INT32:       write_integer(read_value<int32_t>(var, is_wrapped), fixed_width); break;
+                case field_kind::INT64:       write_integer(read_value<int64_t>(var, is_wrapped), fixed_width); break;
+                case field_kind::UINT8:       write_byte(read_value<uint8_t>(var, is_wrapped)); break;
+                case field_kind::UINT16:      write_integer(read_value<uint16_t>(var, is_wrapped), fixed_width); break;
+                case field_kind::UINT32:      write_integer(read_value<uint32_t>(var, is_wrapped), fixed_width); break;
+                case field_kind::UINT64:      write_integer(read_value<uint64_t>(var, is_wrapped), fixed_width); break;
+                case field_kind::FLOAT:       write_fixed(read_value<float>(var, is_wrapped)); break;
+                case field_kind::DOUBLE:      write_fixed(read_value<double>(var, is_wrapped)); break;
+                case field_kind::STRING:      write_string(read_value<std::string>(var, is_wrapped)); break;
+                case field_kind::ENUM:        write_enum(is_wrapped ? var.extract_wrapped_value() : var); break;
+                case field_kind::SEQUENTIAL:
+                case field_kind::ASSOCIATIVE:
+                case field_kind::OBJECT:      write_compound(var, plan); break;
+                case field_kind::OTHER:       write_other(is_wrapped ? var.extract_wrapped_value() : var); break;
+            }
+        }
+
+        /*!
+         * Writes an object or container; it fails beyond \ref detail::binary_max_depth nested values,
+         * which the reader would reject, e.g. when objects refer to each other via pointers.
+         */
+        void write_compound(const variant& var, const detail::value_plan& plan)
+        {
+            if (m_depth == detail::binary_max_depth)
+            {
+                m_ok = false;
+                return;
+            }
+
+            ++m_depth;
+            if (plan.m_kind == detail::field_kind::SEQUENTIAL)
+                write_sequential_container(var.create_sequential_view());
+            else if (plan.m_kind == detail::field_kind::ASSOCIATIVE)
+                write_associative_container(var.create_associative_view());
+            else
+                write_object(var, *plan.m_nested);
+            --m_depth;
+        }
+
+        void write_other(const variant& var)
+        {
+            bool ok = false;
+            const auto text = var.to_string(&ok);
+            m_ok &= ok;
+            write_string(text);
+        }
+
+        void write_value(const variant& var, const detail::value_plan& plan, bool fixed_width)
+        {
+            const type held_type = var.get_type();
+            if (held_type == plan.m_type)
+            {
+                write_planned_value(var, false, plan, fixed_width);
+            }
+            else if (held_type.is_wrapper() && held_type.get_wrapped_type() == plan.m_type)
+            {
+                write_planned_value(var, true, plan, fixed_width);
+            }
+            else if (plan.m_kind == detail::field_kind::OTHER)
+            {
+                write_other(var);
+            }
+            else
+            {
+                // the reader expects exactly the type of the plan
+                variant value = var;
+                if (!value.convert(plan.m_type))
+                {
+                    m_ok = false;
+                    return;
+                }
+
+                write_planned_value(value, false, plan, fixed_width);
+            }
+        }
+
+        void write_sequential_container(const variant_sequential_view& view)
+        {
+            const std::size_t size = view.get_size();
+            write_varint(size);
+            if (size == 0)
+                return;
+
+            const auto plan = detail::get_value_plan(view.get_value_type());
+            write_byte(static_cast<uint8_t>(plan.m_kind));
+            const std::size_t width = detail::get_fixed_width(plan.m_kind);
+            write_padding(width);
+#if RTTR_ENDIAN == RTTR_ENDIAN_LITTLE
+            if (width > 0)
+            {
+                if (const void* data = view.get_data_address())
+                {
+                    m_stream.write(static_cast<const char*>(data), size * width);
+                    return;
+                }
+            }
+#endif
+
+            for (const auto& item : view)
+                write_value(item, plan, true);
+        }
+
+        void write_associative_container(const variant_associative_view& view)
+        {
+            const std::size_t size = view.get_size();
+            write_varint(size);
+            if (size == 0)
+                return;
+
+            const auto key_plan = detail::get_value_plan(view.get_key_type());
+            write_byte(static_cast<uint8_t>(key_plan.m_kind));
+            if (view.get_value_type().is_valid())
+            {
+                const auto value_plan = detail::get_value_plan(view.get_value_type());
+                write_byte(static_cast<uint8_t>(value_plan.m_kind));
+                for (const auto& item : view)
+                {
+                    write_value(item.first, key_plan, false);
+                    write_value(item.second, value_plan, false);
+                }
+            }
+            else
+            {
+                write_byte(detail::binary_no_kind);
+                for (const auto& item : view)
+                    write_value(item.first, key_plan, false);
+            }
+        }
+
+        /*!
+         * Writes the reference to the schema of \p plan; the schema itself, when it is used the first time.
+         */
+        void write_schema(const detail::type_plan& plan)
+        {
+            const auto itr = m_schemas.find(&plan);
+            if (itr != m_schemas.end())
+            {
+                write_varint(itr->second + 2);
+                return;
+            }
+
+            m_schemas.emplace(&plan, m_schemas.size());
+            write_varint(detail::binary_new_schema);
+            write_fixed(plan.m_fingerprint);
+
+            std::size_t count = 0;
+            for (const auto& field : plan.m_fields)
+                count += field.m_serialize ? 1 : 0;
+
+            if (count > detail::binary_max_schema_fields)
+                m_ok = false; // the reader would reject the schema
+
+            write_varint(count);
+            for (const auto& field : plan.m_fields)
+            {
+                if (!field.m_serialize)
+                    continue;
+
+                write_string(field.m_name);
+                write_byte(static_cast<uint8_t>(field.m_value.m_kind));
+            }
+        }
+
+        void write_object(const instance& obj_in, const detail::type_plan& static_plan)
+        {
+            const instance obj = obj_in.get_type().get_raw_type().is_wrapper() ? obj_in.get_wrapped_instance() : obj_in;
+            if (!obj.is_valid())
+            {
+                write_varint(detail::binary_null_object); // e.g. a null pointer
+                return;
+            }
+
+            const type derived_type = obj.get_derived_type();
+            const auto& plan = (derived_type == static_plan.m_type) ? static_plan : detail::get_type_plan(derived_type);
+
+            write_schema(plan);
+            for (const auto& field : plan.m_fields)
+            {
+                if (!field.m_serialize)
+                    continue;
+
+                const variant value = field.get_value(obj);
+                if (!value)
+                {
+                    // the fields have no names, so a missing value cannot be skipped
+                    m_ok = false;
+                    return;
+                }
+
+                write_value(value, field.m_value, false);
+            }
+        }
+
+    private:
+        Stream&         m_stream;
+        bool            m_ok = true;
+        //! The number of objects and containers, which enclose the current value.
+        std::size_t     m_depth = 0;
+        //! The index of every schema, which was written already.
+        std::unordered_map<const detail::type_plan*, std::size_t> m_schemas;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool write_chunked(const instance& obj, detail::chunked_output_stream::write_func func, void* sink, std::size_t chunk_size)
+{
+    if (!obj.is_valid())
+        return false;
+
+    detail::chunked_output_stream stream(func, sink, chunk_size);
+    binary_encoder<detail::chunked_output_stream> encoder(stream);
+    const bool ok = encoder.write_document(obj);
+    stream.Flush();
+
+    return (ok && stream.good());
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_binary(instance obj)
+{
+    std::string result;
+    if (!obj.is_valid())
+        return result;
+
+    detail::string_output_stream stream(result);
+    binary_encoder<detail::string_output_stream> encoder(stream);
+    if (!encoder.write_document(obj))
+        result.clear();
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool to_binary(instance obj, std::ostream& out, std::size_t chunk_size)
+{
+    return write_chunked(obj, &detail::write_to_ostream, &out, chunk_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool to_binary(instance obj, int fd, std::size_t chunk_size)
+{
+    return write_chunked(obj, &detail::write_to_fd, &fd, chunk_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
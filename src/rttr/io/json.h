@@ -0,0 +1,124 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_IO_JSON_H_
+#define RTTR_IO_JSON_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <string>
+#include <iosfwd>
+
+namespace rttr
+{
+class instance;
+
+namespace io
+{
+
+/*!
+ * The \ref json_write_options struct controls how an object is written as JSON.
+ */
+struct json_write_options
+{
+    //! When `true`, the output is indented with four spaces per nesting level; otherwise it is written compact.
+    bool        pretty      = true;
+    //! The size in bytes of the buffer, which is filled before it is handed over to the output stream or file descriptor.
+    std::size_t chunk_size  = 64 * 1024;
+};
+
+/*!
+ * \brief Serializes the public properties of the given object \p obj to a JSON encoded string.
+ *
+ * Properties with the metadata `"NO_SERIALIZE"` are skipped.
+ * Arithmetic types, enumerations and `std::string` are written as JSON values,
+ * sequential containers as JSON arrays, associative containers as array of `{"key": ..., "value": ...}` objects
+ * and all other types with registered properties as nested JSON objects.
+ * Floating point values, which are not finite, are written as `NaN`, `Infinity` and `-Infinity`;
+ * \ref from_json() accepts these values.
+ * At most 256 objects and containers can be nested; e.g. objects, which refer to each other via pointers, cannot be written.
+ *
+ * \return The JSON text; when \p obj is not valid or its values are nested too deep, an empty string.
+ */
+RTTR_API std::string to_json(instance obj, const json_write_options& options = json_write_options());
+
+/*!
+ * \brief Serializes the given object \p obj as JSON into the output stream \p out.
+ *
+ * The JSON text is never materialized as a whole; it is written in chunks of `options.chunk_size` bytes,
+ * so the memory usage is independent of the size of the object graph.
+ *
+ * \return `true` when \p obj was valid, its values were not nested too deep and all chunks could be written,
+ *         otherwise `false`.
+ */
+RTTR_API bool to_json(instance obj, std::ostream& out, const json_write_options& options = json_write_options());
+
+/*!
+ * \brief Serializes the given object \p obj as JSON into the file descriptor \p fd.
+ *
+ * Works like \ref to_json(instance, std::ostream&, const json_write_options&), but the chunks
+ * are written directly with the system call `write()`; e.g. into a file, pipe or socket.
+ *
+ * \return `true` when \p obj was valid, its values were not nested too deep and all chunks could be written,
+ *         otherwise `false`.
+ */
+RTTR_API bool to_json(instance obj, int fd, const json_write_options& options = json_write_options());
+
+/*!
+ * \brief Deserializes the JSON text \p json into the given object \p obj.
+ *
+ * The text is parsed with a streaming (SAX) parser; every value is assigned to its property
+ * as soon as it was read, no DOM is built. JSON members without a matching property are skipped.
+ *
+ * \return `true` when the text could be parsed and its root is a JSON object, otherwise `false`.
+ */
+RTTR_API bool from_json(string_view json, instance obj);
+
+/*!
+ * \brief Deserializes the JSON text read from the input stream \p in into the given object \p obj.
+ *
+ * The stream is read in chunks of \p chunk_size bytes, while the properties are set.
+ *
+ * \return `true` when the text could be parsed and its root is a JSON object, otherwise `false`.
+ */
+RTTR_API bool from_json(std::istream& in, instance obj, std::size_t chunk_size = 64 * 1024);
+
+/*!
+ * \brief Deserializes the JSON text read from the file descriptor \p fd into the given object \p obj.
+ *
+ * The file descriptor is read with the system call `read()` in chunks of \p chunk_size bytes, while the properties are set.
+ *
+ * \return `true` when the text could be parsed and its root is a JSON object, otherwise `false`.
+ */
+RTTR_API bool from_json(int fd, instance obj, std::size_t chunk_size = 64 * 1024);
+
+} // end namespace io
+} // end namespace rttr
+
+#endif // RTTR_IO_JSON_H_
@@ -0,0 +1,545 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/io/json.h"
+
+#include "rttr/detail/io/chunked_stream.h"
+#include "rttr/detail/io/serialization_plan.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+#include <rapidjson/reader.h>
+#include <rapidjson/memorystream.h>
+
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <limits>
+
+namespace rttr
+{
+namespace io
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The SAX handler for rapidjson's reader.
+ *
+ * Every opened JSON object or array, pushes a frame on a stack, which describes the target of the following tokens.
+ * Scalar values are assigned immediately to the current target, i.e. a property, a container element or
+ * the key or value of an associative container. The values of nested objects and containers are assigned,
+ * when the nesting is closed again.
+ */
+class json_sax_handler
+{
+    public:
+        json_sax_handler(const instance& obj)
+        :   m_root(get_object(obj))
+        {
+        }
+
+        bool Null()                     { return deliver(variant()); }
+        bool Bool(bool value)           { return deliver(value); }
+        bool Int(int value)             { return deliver(value); }
+        bool Int64(int64_t value)       { return deliver(value); }
+        bool Double(double value)       { return deliver(value); }
+
+        bool Uint(unsigned value)
+        {
+            if (value <= static_cast<unsigned>(std::numeric_limits<int>::max()))
+                return deliver(static_cast<int>(value));
+            else
+                return deliver(value);
+        }
+
+        bool Uint64(uint64_t value)
+        {
+            if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+                return deliver(static_cast<int64_t>(value));
+            else
+                return deliver(value);
+        }
+
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool)
+        {
+            return deliver(std::string(str, length));
+        }
+
+        bool String(const char* str, rapidjson::SizeType length, bool)
+        {
+            return deliver(std::string(str, length));
+        }
+
+        bool Key(const char* str, rapidjson::SizeType length, bool)
+        {
+            auto& top = m_stack.back();
+            const string_view name(str, length);
+            if (top.m_kind == frame_kind::OBJECT)
+            {
+                top.m_field = top.m_plan->find_field(name, top.m_hint);
+            }
+            else if (top.m_kind == frame_kind::KEY_VALUE)
+            {
+                if (name == string_view("key"))
+                    top.m_slot = slot::KEY;
+                else if (name == string_view("value"))
+                    top.m_slot = slot::VALUE;
+                else
+                    top.m_slot = slot::NONE;
+            }
+
+            return true;
+        }
+
+        bool StartObject()
+        {
+            if (m_stack.empty())
+            {
+                if (!m_root.is_valid())
+                    return false;
+
+                m_stack.emplace_back(m_root);
+                m_stack.back().m_plan = &detail::get_type_plan(m_root.get_derived_type());
+                return true;
+            }
+
+            auto& parent = m_stack.back();
+            if (parent.m_kind == frame_kind::SKIP)
+            {
+                ++parent.m_depth;
+                return true;
+            }
+
+            if (parent.m_kind == frame_kind::ASSOCIATIVE && parent.m_assoc.get_value_type().is_valid())
+            {
+                m_stack.emplace_back(parent.m_assoc.get_key_type(), parent.m_assoc.get_value_type());
+                return true;
+            }
+
+            bool write_back = true;
+            const detail::type_plan* plan = nullptr;
+            variant value = open_child(parent, write_back, plan);
+            if (!value)
+            {
+                push_skip();
+                return true;
+            }
+
+            m_stack.emplace_back(frame_kind::OBJECT, std::move(value), write_back);
+            auto& child = m_stack.back();
+            child.m_plan = get_plan(child.m_obj, plan);
+            if (!child.m_plan || child.m_plan->m_fields.empty())
+            {
+                m_stack.pop_back();
+                push_skip();
+            }
+
+            return true;
+        }
+
+        bool EndObject(rapidjson::SizeType)
+        {
+            return close_frame();
+        }
+
+        bool StartArray()
+        {
+            if (m_stack.empty())
+                return false; // the root has to be an object
+
+            auto& parent = m_stack.back();
+            if (parent.m_kind == frame_kind::SKIP)
+            {
+                ++parent.m_depth;
+                return true;
+            }
+
+            bool write_back = true;
+            const detail::type_plan* plan = nullptr;
+            variant value = open_child(parent, write_back, plan);
+
+            if (value.is_sequential_container())
+            {
+                m_stack.emplace_back(frame_kind::SEQUENTIAL, std::move(value), write_back);
+            }
+            else if (value.is_associative_container())
+            {
+                m_stack.emplace_back(frame_kind::ASSOCIATIVE, std::move(value), write_back);
+            }
+            else
+            {
+                push_skip();
+                return true;
+            }
+
+            auto& child = m_stack.back();
+            if (child.m_kind == frame_kind::SEQUENTIAL)
+            {
+                child.m_seq = child.m_value.create_sequential_view();
+                child.m_element = detail::get_value_plan(child.m_seq.get_value_type());
+            }
+            else
+            {
+                child.m_assoc = child.m_value.create_associative_view();
+                child.m_assoc.clear();
+            }
+
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType)
+        {
+            auto& top = m_stack.back();
+            if (top.m_kind == frame_kind::SEQUENTIAL && top.m_index < top.m_seq.get_size())
+                top.m_seq.set_size(top.m_index);
+
+            return close_frame();
+        }
+
+    private:
+        enum class frame_kind
+        {
+            OBJECT,
+            SEQUENTIAL,
+            ASSOCIATIVE,
+            KEY_VALUE,
+            SKIP
+        };
+
+        enum class slot
+        {
+            NONE,
+            KEY,
+            VALUE
+        };
+
+        static instance get_object(const instance& obj)
+        {
+            return (obj.get_type().get_raw_type().is_wrapper() ? obj.get_wrapped_instance() : obj);
+        }
+
+        /*!
+         * Returns the plan for the object \p obj; \p plan is the plan of its static type and will be used,
+         * when the object is not of a derived type.
+         */
+        static const detail::type_plan* get_plan(const instance& obj, const detail::type_plan* plan)
+        {
+            if (!obj.is_valid())
+                return nullptr;
+
+            const type derived_type = obj.get_derived_type();
+            if (plan && plan->m_type == derived_type)
+                return plan;
+
+            return &detail::get_type_plan(derived_type);
+        }
+
+        struct frame
+        {
+            explicit frame(const instance& root)
+            :   m_kind(frame_kind::OBJECT),
+                m_obj(root)
+            {
+            }
+
+            frame(const type& key_type, const type& value_type)
+            :   m_kind(frame_kind::KEY_VALUE),
+                m_key_type(key_type),
+                m_value_type(value_type)
+            {
+            }
+
+            // a frame is always constructed at its final location in the stack,
+            // so the instance can refer to the value of this frame
+            explicit frame(frame_kind kind, variant value = variant(), bool write_back = true)
+            :   m_kind(kind),
+                m_value(std::move(value)),
+                m_write_back(write_back),
+                m_obj(kind == frame_kind::OBJECT ? get_object(m_value) : instance())
+            {
+            }
+
+            frame_kind                  m_kind;
+            //! The value of a nested object or container, which is written back to the parent, when the frame is closed.
+            variant                     m_value;
+            bool                        m_write_back = true;
+
+            // OBJECT
+            const instance              m_obj;
+            const detail::type_plan*    m_plan = nullptr;
+            //! The field of the last read key, `nullptr` when the object has no such property.
+            const detail::field_plan*   m_field = nullptr;
+            //! The position in the plan, where the search for the next key starts.
+            std::size_t                 m_hint = 0;
+
+            // SEQUENTIAL and ASSOCIATIVE
+            variant_sequential_view     m_seq;
+            variant_associative_view    m_assoc;
+            std::size_t                 m_index = 0;
+            detail::value_plan          m_element = detail::value_plan{type::get<void>(), detail::field_kind::OTHER, nullptr};
+
+            // KEY_VALUE
+            slot                        m_slot = slot::NONE;
+            const type                  m_key_type = type::get<void>();
+            const type                  m_value_type = type::get<void>();
+            variant                     m_key;
+            variant                     m_mapped;
+
+            // SKIP
+            std::size_t                 m_depth = 0;
+        };
+
+        void push_skip()
+        {
+            m_stack.emplace_back(frame_kind::SKIP);
+        }
+
+        /*!
+         * Prepares the element at the current position of the sequential view \p parent.
+         */
+        bool prepare_element(frame& parent)
+        {
+            if (parent.m_index < parent.m_seq.get_size())
+                return true;
+
+            return parent.m_seq.set_size(parent.m_index + 1);
+        }
+
+        /*!
+         * Returns the value, which is the target of a nested object or array inside of \p parent.
+         * When \p write_back is set to `false`, the returned variant refers to the target in place.
+         * \p plan is set to the plan of the static type of the value, when it is known already.
+         */
+        variant open_child(frame& parent, bool& write_back, const detail::type_plan*& plan)
+        {
+            switch (parent.m_kind)
+            {
+                case frame_kind::OBJECT:
+                {
+                    const auto field = parent.m_field;
+                    if (!field || field->m_readonly)
+                        return variant();
+
+                    plan = field->m_value.m_nested;
+                    variant value = field->get_value(parent.m_obj);
+                    // a 'std::reference_wrapper<T>' to a member object is filled in place
+                    write_back = !(field->m_by_reference && value.get_type().is_wrapper());
+                    return value;
+                }
+                case frame_kind::SEQUENTIAL:
+                {
+                    if (!prepare_element(parent))
+                        return variant();
+
+                    // holds a 'std::reference_wrapper<T>' to the element
+                    write_back = false;
+                    plan = parent.m_element.m_nested;
+                    return parent.m_seq.get_value(parent.m_index);
+                }
+                case frame_kind::ASSOCIATIVE:
+                {
+                    return detail::create_value(parent.m_assoc.get_key_type());
+                }
+                case frame_kind::KEY_VALUE:
+                {
+                    if (parent.m_slot == slot::KEY)
+                        return detail::create_value(parent.m_key_type);
+                    else if (parent.m_slot == slot::VALUE)
+                        return detail::create_value(parent.m_value_type);
+
+                    return variant();
+                }
+                case frame_kind::SKIP:
+                {
+                    break;
+                }
+            }
+
+            return variant();
+        }
+
+        /*!
+         * Pops the top frame and assigns its value to the new top frame.
+         */
+        bool close_frame()
+        {
+            auto& top = m_stack.back();
+            if (top.m_kind == frame_kind::SKIP && top.m_depth > 0)
+            {
+                --top.m_depth;
+                return true;
+            }
+
+            if (m_stack.size() == 1)
+            {
+                m_stack.pop_back();
+                return true;
+            }
+
+            auto& parent = m_stack[m_stack.size() - 2];
+            if (top.m_kind == frame_kind::KEY_VALUE)
+            {
+                if (top.m_key && top.m_mapped)
+                    parent.m_assoc.insert(top.m_key, top.m_mapped);
+
+                m_stack.pop_back();
+                return true;
+            }
+
+            if (top.m_kind == frame_kind::SKIP)
+            {
+                m_stack.pop_back();
+                deliver(variant());
+                return true;
+            }
+
+            variant value = std::move(top.m_value);
+            const bool write_back = top.m_write_back;
+            m_stack.pop_back();
+
+            if (write_back)
+                deliver(std::move(value));
+            else
+                deliver(variant()); // the value was filled in place, so only the next target is selected
+
+            return true;
+        }
+
+        /*!
+         * Assigns the value \p value to the current target of the top frame.
+         * An invalid \p value only advances to the next target.
+         *
+         * \return `false`, when there is no target, i.e. the root of the document is not an object.
+         */
+        bool deliver(variant value)
+        {
+            if (m_stack.empty())
+                return false;
+
+            auto& top = m_stack.back();
+            switch (top.m_kind)
+            {
+                case frame_kind::OBJECT:
+                {
+                    if (top.m_field && value)
+                    {
+                        const auto& field = *top.m_field;
+                        if (value.get_type() == field.m_value.m_type || value.convert(field.m_prop.get_type()))
+                            field.m_prop.set_value(top.m_obj, value);
+                    }
+
+                    top.m_field = nullptr;
+                    break;
+                }
+                case frame_kind::SEQUENTIAL:
+                {
+                    if (prepare_element(top) && value &&
+                        (value.get_type() == top.m_element.m_type || value.convert(top.m_seq.get_value_type())))
+                        top.m_seq.set_value(top.m_index, value);
+
+                    ++top.m_index;
+                    break;
+                }
+                case frame_kind::ASSOCIATIVE:
+                {
+                    if (value && value.convert(top.m_assoc.get_key_type()))
+                        top.m_assoc.insert(value);
+                    break;
+                }
+                case frame_kind::KEY_VALUE:
+                {
+                    if (top.m_slot == slot::KEY && value.convert(top.m_key_type))
+                        top.m_key = std::move(value);
+                    else if (top.m_slot == slot::VALUE && value.convert(top.m_value_type))
+                        top.m_mapped = std::move(value);
+
+                    top.m_slot = slot::NONE;
+                    break;
+                }
+                case frame_kind::SKIP:
+                {
+                    break;
+                }
+            }
+
+            return true;
+        }
+
+    private:
+        instance            m_root;
+        std::deque<frame>   m_stack;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Stream>
+bool parse(Stream& stream, const instance& obj)
+{
+    // the handler keeps its own stack of frames, so the nesting depth is limited by memory only
+    json_sax_handler handler(obj);
+    rapidjson::Reader reader;
+    return !reader.Parse<rapidjson::kParseIterativeFlag | rapidjson::kParseNanAndInfFlag>(stream, handler).IsError();
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_json(string_view json, instance obj)
+{
+    rapidjson::MemoryStream stream(json.data(), json.size());
+    return parse(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_json(std::istream& in, instance obj, std::size_t chunk_size)
+{
+    detail::chunked_input_stream stream(&detail::read_from_istream, &in, chunk_size);
+    return parse(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_json(int fd, instance obj, std::size_t chunk_size)
+{
+    detail::chunked_input_stream stream(&detail::read_from_fd, &fd, chunk_size);
+    return parse(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
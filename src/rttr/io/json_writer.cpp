@@ -0,0 +1,380 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/io/json.h"
+
+#include "rttr/detail/io/chunked_stream.h"
+#include "rttr/detail/io/serialization_plan.h"
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/property.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+// floating point values, which are not finite, are written as 'NaN', 'Infinity' and '-Infinity';
+// otherwise rapidjson refuses them and leaves an incomplete member behind.
+// The flag is set as default flag, because the 'PrettyWriter' of rapidjson 1.1.0 does not compile with other flags.
+#define RAPIDJSON_WRITE_DEFAULT_FLAGS rapidjson::kWriteNanAndInfFlag
+
+#include <rapidjson/writer.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <ostream>
+
+namespace rttr
+{
+namespace io
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+//! The maximum number of objects and containers, which can enclose a value; the same limit as in the binary format.
+static const std::size_t max_depth = 256;
+
+/*!
+ * A rapidjson writer, which additionally tracks the nesting depth of the written values;
+ * objects, which refer to each other via pointers, would be written endlessly otherwise.
+ */
+template<typename Base>
+class depth_limited_writer : public Base
+{
+    public:
+        template<typename Stream>
+        explicit depth_limited_writer(Stream& stream)
+        :   Base(stream)
+        {
+        }
+
+        //! The number of objects and containers, which enclose the current value.
+        std::size_t m_depth = 0;
+        //! `false`, when a value was nested too deep and has been written as `null`.
+        bool        m_ok = true;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_object(const instance& obj, const detail::type_plan& plan, Writer& writer);
+
+template<typename Writer>
+bool write_variant(const variant& var, Writer& writer);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_string(string_view text, Writer& writer)
+{
+    writer.String(text.data(), static_cast<rapidjson::SizeType>(text.length()), true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_enum(const variant& var, Writer& writer)
+{
+    bool ok = false;
+    const auto name = var.to_string(&ok);
+    if (ok)
+    {
+        write_string(name, writer);
+    }
+    else
+    {
+        const auto value = var.to_uint64(&ok);
+        if (ok)
+            writer.Uint64(value);
+        else
+            writer.Null();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+const T& read_value(const variant& var, bool is_wrapped)
+{
+    return (is_wrapped ? var.get_wrapped_value<T>() : var.get_value<T>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_sequential_container(const variant_sequential_view& view, Writer& writer);
+
+template<typename Writer>
+void write_associative_container(const variant_associative_view& view, Writer& writer);
+
+/*!
+ * Writes an object or container; beyond \ref max_depth nested values, `null` is written instead.
+ */
+template<typename Writer>
+void write_compound(const variant& var, const detail::value_plan& plan, Writer& writer)
+{
+    if (writer.m_depth == max_depth)
+    {
+        writer.m_ok = false;
+        writer.Null();
+        return;
+    }
+
+    ++writer.m_depth;
+    if (plan.m_kind == detail::field_kind::SEQUENTIAL)
+        write_sequential_container(var.create_sequential_view(), writer);
+    else if (plan.m_kind == detail::field_kind::ASSOCIATIVE)
+        write_associative_container(var.create_associative_view(), writer);
+    else
+        write_object(var, *plan.m_nested, writer);
+    --writer.m_depth;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes the value \p var, which holds a value of type `plan.m_type` directly or wrapped (\p is_wrapped).
+ */
+template<typename Writer>
+void write_planned_value(const variant& var, bool is_wrapped, const detail::value_plan& plan, Writer& writer)
+{
+    using detail::field_kind;
+    switch (plan.m_kind)
+    {
+        case field_kind::BOOL:        writer.Bool(read_value<bool>(var, is_wrapped)); break;
+        case field_kind::CHAR:        writer.Int(read_value<char>(var, is_wrapped)); break;
+        case field_kind::INT8:        writer.Int(read_value<int8_t>(var, is_wrapped)); break;
+        case field_kind::INT16:       writer.Int(read_value<int16_t>(var, is_wrapped)); break;
+        case field_kind::INT32:       writer.Int(read_value<int32_t>(var, is_wrapped)); break;
+        case field_kind::INT64:       writer.Int64(read_value<int64_t>(var, is_wrapped)); break;
+        case field_kind::UINT8:       writer.Uint(read_value<uint8_t>(var, is_wrapped)); break;
+        case field_kind::UINT16:      writer.Uint(read_value<uint16_t>(var, is_wrapped)); break;
+        case field_kind::UINT32:      writer.Uint(read_value<uint32_t>(var, is_wrapped)); break;
+        case field_kind::UINT64:      writer.Uint64(read_value<uint64_t>(var, is_wrapped)); break;
+        case field_kind::FLOAT:       writer.Double(read_value<float>(var, is_wrapped)); break;
+        case field_kind::DOUBLE:      writer.Double(read_value<double>(var, is_wrapped)); break;
+        case field_kind::STRING:      write_string(read_value<std::string>(var, is_wrapped), writer); break;
+        case field_kind::ENUM:        write_enum(is_wrapped ? var.extract_wrapped_value() : var, writer); break;
+        case field_kind::SEQUENTIAL:
+        case field_kind::ASSOCIATIVE:
+        case field_kind::OBJECT:      write_compound(var, plan, writer); break;
+        case field_kind::OTHER:       write_variant(var, writer); break;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_value(const variant& var, const detail::value_plan& plan, Writer& writer)
+{
+    const type held_type = var.get_type();
+    if (held_type == plan.m_type)
+        write_planned_value(var, false, plan, writer);
+    else if (held_type.is_wrapper() && held_type.get_wrapped_type() == plan.m_type)
+        write_planned_value(var, true, plan, writer);
+    else
+        write_variant(var, writer); // e.g. the value of a derived type
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_sequential_container(const variant_sequential_view& view, Writer& writer)
+{
+    writer.StartArray();
+    if (!view.is_empty())
+    {
+        const auto plan = detail::get_value_plan(view.get_value_type());
+        for (const auto& item : view)
+            write_value(item, plan, writer);
+    }
+    writer.EndArray();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_associative_container(const variant_associative_view& view, Writer& writer)
+{
+    static const string_view key_name("key");
+    static const string_view value_name("value");
+
+    writer.StartArray();
+
+    if (view.get_value_type().is_valid())
+    {
+        for (const auto& item : view)
+        {
+            writer.StartObject();
+            writer.Key(key_name.data(), static_cast<rapidjson::SizeType>(key_name.length()), false);
+            write_variant(item.first, writer);
+            writer.Key(value_name.data(), static_cast<rapidjson::SizeType>(value_name.length()), false);
+            write_variant(item.second, writer);
+            writer.EndObject();
+        }
+    }
+    else
+    {
+        for (const auto& item : view)
+            write_variant(item.first, writer);
+    }
+
+    writer.EndArray();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes a value of an unknown type; the plan of the type will be retrieved first.
+ */
+template<typename Writer>
+bool write_variant(const variant& var, Writer& writer)
+{
+    const type value_type = var.get_type();
+    const bool is_wrapper = value_type.is_wrapper();
+    const auto plan = detail::get_value_plan(value_type);
+
+    if (plan.m_kind != detail::field_kind::OTHER)
+    {
+        write_planned_value(var, is_wrapper, plan, writer);
+        return true;
+    }
+
+    bool ok = false;
+    const auto text = var.to_string(&ok);
+    write_string(text, writer);
+    return ok;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Writer>
+void write_object(const instance& obj_in, const detail::type_plan& static_plan, Writer& writer)
+{
+    const instance obj = obj_in.get_type().get_raw_type().is_wrapper() ? obj_in.get_wrapped_instance() : obj_in;
+    if (!obj.is_valid())
+    {
+        writer.Null(); // e.g. a null pointer
+        return;
+    }
+
+    const type derived_type = obj.get_derived_type();
+    const auto& plan = (derived_type == static_plan.m_type) ? static_plan : detail::get_type_plan(derived_type);
+
+    writer.StartObject();
+    for (const auto& field : plan.m_fields)
+    {
+        if (!field.m_serialize)
+            continue;
+
+        const variant value = field.get_value(obj);
+        if (!value)
+            continue; // cannot serialize, because we cannot retrieve the value
+
+        writer.Key(field.m_name.data(), static_cast<rapidjson::SizeType>(field.m_name.length()), false);
+        write_value(value, field.m_value, writer);
+    }
+    writer.EndObject();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes the object \p obj into \p stream.
+ *
+ * \return `false`, when a value was nested too deep.
+ */
+template<typename Stream>
+bool write_document(const instance& obj, Stream& stream, const json_write_options& options)
+{
+    const auto& plan = detail::get_type_plan(obj.get_derived_type());
+    if (options.pretty)
+    {
+        depth_limited_writer<rapidjson::PrettyWriter<Stream>> writer(stream);
+        writer.SetIndent(' ', 4);
+        write_object(obj, plan, writer);
+        return writer.m_ok;
+    }
+    else
+    {
+        depth_limited_writer<rapidjson::Writer<Stream>> writer(stream);
+        write_object(obj, plan, writer);
+        return writer.m_ok;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool write_chunked(const instance& obj, detail::chunked_output_stream::write_func func, void* sink,
+                   const json_write_options& options)
+{
+    if (!obj.is_valid())
+        return false;
+
+    detail::chunked_output_stream stream(func, sink, options.chunk_size);
+    const bool ok = write_document(obj, stream, options);
+    stream.Flush();
+
+    return (ok && stream.good());
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_json(instance obj, const json_write_options& options)
+{
+    if (!obj.is_valid())
+        return std::string();
+
+    rapidjson::StringBuffer buffer;
+    if (!write_document(obj, buffer, options))
+        return std::string();
+
+    return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool to_json(instance obj, std::ostream& out, const json_write_options& options)
+{
+    return write_chunked(obj, &detail::write_to_ostream, &out, options);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool to_json(instance obj, int fd, const json_write_options& options)
+{
+    return write_chunked(obj, &detail::write_to_fd, &fd, options);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace io
+} // end namespace rttr
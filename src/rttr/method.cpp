@@ -191,6 +191,13 @@ variant method::invoke_variadic(instance object, std::vector<argument> args) con
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool method::get_typed_invoker(const detail::signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_typed_invoker(items, count, access);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool method::operator==(const method& other) const RTTR_NOEXCEPT
 {
     return (m_wrapper == other.m_wrapper);
@@ -47,9 +47,13 @@ class instance;
 class argument;
 class method;
 
+template<typename Signature>
+class typed_method_invoker;
+
 namespace detail
 {
     class method_wrapper_base;
+    struct signature_item;
 }
 
 /*!
@@ -322,6 +326,23 @@ class RTTR_API method
          */
         variant invoke_variadic(instance object, std::vector<argument> args) const;
 
+        /*!
+         * \brief Returns an invoker, which calls this method directly with the given \p Signature,
+         *        without packing the arguments into \ref argument objects or the return value into a \ref variant.
+         *
+         * \remark The signature has to match exactly the signature of the registered function;
+         *         a member function `R (C::*)(Args...)` has the signature `R(C&, Args...)`,
+         *         a static function `R (*)(Args...)` the signature `R(Args...)`.
+         *         When the signature does not match, an invalid invoker is returned.
+         *         See \ref typed_method_invoker for details.
+         *
+         * \remark The definition of this function is located in the header "rttr/typed_method_invoker.h".
+         *
+         * \return A typed invoker for this method.
+         */
+        template<typename Signature>
+        typed_method_invoker<Signature> get_invoker() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true if this method is the same like the \p other.
          *
@@ -339,6 +360,9 @@ class RTTR_API method
     private:
         method(const detail::method_wrapper_base* wrapper) RTTR_NOEXCEPT;
 
+        //! Fills \p access with a detail::typed_method_access object, when the given signature matches.
+        bool get_typed_invoker(const detail::signature_item* items, std::size_t count, void* access) const RTTR_NOEXCEPT;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
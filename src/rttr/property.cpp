@@ -156,6 +156,20 @@ variant property::get_value(instance object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant property::get_reference(instance object) const
+{
+    return m_wrapper->get_reference(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property::get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_typed_access(class_type, value_type, access);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant property::get_metadata(const variant& key) const
 {
     return m_wrapper->get_metadata(key);
@@ -45,9 +45,13 @@ class instance;
 class argument;
 class property;
 
+template<typename Class_Type, typename T>
+class typed_property_accessor;
+
 namespace detail
 {
     class property_wrapper_base;
+    struct field_plan;
 }
 
 /*!
@@ -241,6 +245,21 @@ class RTTR_API property
          */
         variant get_value(instance object) const;
 
+        /*!
+         * \brief Returns an accessor, which reads and writes the value of this property
+         *        directly, without constructing a \ref variant or \ref argument.
+         *
+         * \remark `Class_Type` has to be the class which declares this property and `T` its value type.
+         *         When these types do not match or the property cannot be accessed this way,
+         *         an invalid accessor is returned. See \ref typed_property_accessor for details.
+         *
+         * \remark The definition of this function is located in the header "rttr/typed_property_accessor.h".
+         *
+         * \return A typed accessor for this property.
+         */
+        template<typename Class_Type, typename T>
+        typed_property_accessor<Class_Type, T> get_accessor() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns the meta data for the given key \p key.
          *
@@ -269,6 +288,14 @@ class RTTR_API property
         //! Constructs a property from a property_wrapper_base.
         property(const detail::property_wrapper_base* wrapper) RTTR_NOEXCEPT;
 
+        //! Fills \p access with a detail::typed_property_access object, when the given types match.
+        bool get_typed_access(const type& class_type, const type& value_type, void* access) const RTTR_NOEXCEPT;
+
+        //! Returns a variant with a `std::reference_wrapper` to the value of this property, when it is stored in \p object.
+        variant get_reference(instance object) const;
+
+        friend struct detail::field_plan;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
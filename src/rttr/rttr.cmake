@@ -50,16 +50,23 @@ set(HEADER_FILES access_levels.h
                  rttr_enable.h
                  type
                  type.h
+                 typed_method_invoker.h
+                 typed_property_accessor.h
                  variant.h
                  variant_array_view.h
                  variant_associative_view.h
+                 variant_memory_resource.h
                  variant_sequential_view.h
                  wrapper_mapper.h
+                 io/binary.h
+                 io/binary_document.h
+                 io/json.h
                  detail/array/array_accessor.h
                  detail/array/array_accessor_impl.h
                  detail/array/array_mapper_impl.h
                  detail/array/array_wrapper.h
                  detail/array/array_wrapper_base.h
+                 detail/base/config.h.in
                  detail/base/core_prerequisites.h
                  detail/base/version.h.in
                  detail/base/version.rc.in
@@ -72,11 +79,16 @@ set(HEADER_FILES access_levels.h
                  detail/comparison/compare_equal_impl.h
                  detail/comparison/compare_less.h
                  detail/comparison/compare_less_impl.h
+                 detail/comparison/compute_hash.h
+                 detail/comparison/compute_hash_impl.h
                  detail/constructor/constructor_invoker.h
                  detail/constructor/constructor_wrapper.h
                  detail/constructor/constructor_wrapper_defaults.h
                  detail/constructor/constructor_wrapper_base.h
                  detail/conversion/std_conversion_functions.h
+                 detail/conversion/basic_conversion_table.h
+                 detail/conversion/floating_point_to_chars.h
+                 detail/conversion/chars_to_number.h
                  detail/conversion/number_conversion.h
                  detail/default_arguments/default_arguments.h
                  detail/default_arguments/invoke_with_defaults.h
@@ -86,6 +98,11 @@ set(HEADER_FILES access_levels.h
                  detail/enumeration/enumeration_wrapper.h
                  detail/enumeration/enumeration_wrapper_base.h
                  detail/enumeration/enum_data.h
+                 detail/io/binary_decoder.h
+                 detail/io/binary_format.h
+                 detail/io/binary_schema.h
+                 detail/io/chunked_stream.h
+                 detail/io/serialization_plan.h
                  detail/filter/filter_item_funcs.h
                  detail/impl/argument_impl.h
                  detail/impl/array_range_impl.h
@@ -95,6 +112,8 @@ set(HEADER_FILES access_levels.h
                  detail/impl/rttr_cast_impl.h
                  detail/impl/sequential_mapper_impl.h
                  detail/impl/string_view_impl.h
+                 detail/impl/typed_method_invoker_impl.h
+                 detail/impl/typed_property_accessor_impl.h
                  detail/impl/wrapper_mapper_impl.h
                  detail/metadata/metadata.h
                  detail/metadata/metadata_handler.h
@@ -102,9 +121,12 @@ set(HEADER_FILES access_levels.h
                  detail/method/method_invoker.h
                  detail/method/method_wrapper.h
                  detail/method/method_wrapper_base.h
+                 detail/method/typed_method_invoke.h
+                 detail/misc/append_only_vector.h
                  detail/misc/argument_wrapper.h
                  detail/misc/argument_extractor.h
                  detail/misc/class_item_mapper.h
+                 detail/misc/concurrent_string_map.h
                  detail/misc/data_address_container.h
                  detail/misc/flat_map.h
                  detail/misc/flat_multimap.h
@@ -131,6 +153,7 @@ set(HEADER_FILES access_levels.h
                  detail/property/property_wrapper_member_func.h
                  detail/property/property_wrapper_member_object.h
                  detail/property/property_wrapper_object.h
+                 detail/property/typed_property_access.h
                  detail/registration/bind_types.h
                  detail/registration/bind_impl.h
                  detail/registration/register_base_class_from_accessor.h
@@ -138,10 +161,16 @@ set(HEADER_FILES access_levels.h
                  detail/registration/registration_executer.h
                  detail/type/accessor_type.h
                  detail/type/base_classes.h
+                 detail/type/class_item_index.h
+                 detail/type/overload_cache.h
                  detail/type/get_create_variant_func.h
                  detail/type/get_derived_info_func.h
                  detail/type/type_converter.h
+                 detail/type/type_cast_cache.h
+                 detail/type/type_pair_cache.h
                  detail/type/type_comparator.h
+                 detail/type/type_hasher.h
+                 detail/type/type_id_limit.h
                  detail/type/type_data.h
                  detail/type/type_register.h
                  detail/type/type_impl.h
@@ -150,6 +179,7 @@ set(HEADER_FILES access_levels.h
                  detail/type/type_string_utils.h
                  detail/variant/variant_compare.h
                  detail/variant/variant_data.h
+                 detail/variant/variant_data_allocation.h
                  detail/variant/variant_data_converter.h
                  detail/variant/variant_data_policy.h
                  detail/variant/variant_impl.h
@@ -176,19 +206,33 @@ set(SOURCE_FILES constructor.cpp
                  variant.cpp
                  variant_array_view.cpp
                  variant_associative_view.cpp
+                 variant_memory_resource.cpp
                  variant_sequential_view.cpp
+                 io/binary_document.cpp
+                 io/binary_reader.cpp
+                 io/binary_writer.cpp
+                 io/json_reader.cpp
+                 io/json_writer.cpp
                  detail/comparison/compare_equal.cpp
                  detail/comparison/compare_less.cpp
+                 detail/comparison/compute_hash.cpp
                  detail/misc/standard_types.cpp
                  detail/conversion/std_conversion_functions.cpp
+                 detail/conversion/basic_conversion_table.cpp
+                 detail/conversion/floating_point_to_chars.cpp
+                 detail/conversion/chars_to_number.cpp
                  detail/constructor/constructor_wrapper_base.cpp
                  detail/destructor/destructor_wrapper_base.cpp
                  detail/enumeration/enumeration_helper.cpp
                  detail/enumeration/enumeration_wrapper_base.cpp
+                 detail/io/binary_schema.cpp
+                 detail/io/chunked_stream.cpp
+                 detail/io/serialization_plan.cpp
                  detail/method/method_wrapper_base.cpp
                  detail/parameter_info/parameter_info_wrapper_base.cpp
                  detail/property/property_wrapper_base.cpp
                  detail/registration/registration_executer.cpp
+                 detail/type/type_cast_cache.cpp
                  detail/type/type_register.cpp
                  detail/variant/variant_compare.cpp
                  )
@@ -28,6 +28,10 @@
 #ifndef RTTR_RTTR_CAST_H_
 #define RTTR_RTTR_CAST_H_
 
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstdint>
+
 namespace rttr
 {
 
@@ -46,6 +50,41 @@ namespace rttr
 template<typename Target_Type, typename Source_Type>
 Target_Type rttr_cast(Source_Type object) RTTR_NOEXCEPT;
 
+/*!
+ * \brief The \ref cast_cache_stats struct contains the statistics of the internal cast cache.
+ *
+ * For every pair of (most derived type, target type) the result of the search in the base class list
+ * is cached, so a repeated \ref rttr_cast between the same types can skip this search.
+ */
+struct cast_cache_stats
+{
+    std::uint64_t hit_count;    //!< The number of casts, which were resolved by the cache.
+    std::uint64_t miss_count;   //!< The number of casts, which had to search the base class list.
+};
+
+/*!
+ * \brief Returns the current statistics of the cast cache, which is used by \ref rttr_cast.
+ *
+ * \remark The casts are only counted, while the statistics are enabled via \ref set_cast_cache_stats_enabled().
+ *         The counters are incremented atomically, but they are shared by all threads;
+ *         so the counting slows down concurrent casts.
+ *
+ * \return The number of cache hits and misses counted since program start or the last call to \ref reset_cast_cache_stats().
+ */
+RTTR_API cast_cache_stats get_cast_cache_stats() RTTR_NOEXCEPT;
+
+/*!
+ * \brief Resets the hit and miss counters of the cast cache to zero.
+ */
+RTTR_API void reset_cast_cache_stats() RTTR_NOEXCEPT;
+
+/*!
+ * \brief Enables or disables the counting of the cache hits and misses of \ref rttr_cast; it is disabled by default.
+ *
+ * \see get_cast_cache_stats()
+ */
+RTTR_API void set_cast_cache_stats_enabled(bool enabled) RTTR_NOEXCEPT;
+
 }
 
 #include "rttr/detail/impl/rttr_cast_impl.h"
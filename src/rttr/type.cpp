@@ -43,6 +43,7 @@
 #include "rttr/detail/parameter_info/parameter_infos_compare.h"
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/type/type_cast_cache.h"
 
 #include <algorithm>
 #include <unordered_map>
@@ -72,6 +73,18 @@ static array_range<T> get_items_for_type(const type& t,
                           detail::default_predicate<T>([t](const T& item) { return (item.get_declaring_type() == t); }) );
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::size_t get_call_key(string_view name, const std::vector<argument>& args) RTTR_NOEXCEPT
+{
+    const auto magic_prime = static_cast<std::size_t>(0x01000193);
+    auto hash_value = detail::generate_hash(name.data(), name.size());
+    for (const auto& arg : args)
+        hash_value = (hash_value ^ arg.get_type().get_id()) * magic_prime;
+
+    return hash_value;
+}
+
 } // end anonymous namespace
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -86,15 +99,7 @@ bool type::is_derived_from(const type& other) const RTTR_NOEXCEPT
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->get_class_data().m_base_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return src_raw_type->get_class_data().has_base_type(tgt_raw_type->get_class_data());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -107,15 +112,7 @@ bool type::is_base_of(const type& other) const RTTR_NOEXCEPT
     if (src_raw_type == tgt_raw_type)
         return true;
 
-    for (auto& t : src_raw_type->get_class_data().m_derived_types)
-    {
-        if (t.m_type_data == tgt_raw_type)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return tgt_raw_type->get_class_data().has_base_type(src_raw_type->get_class_data());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -133,14 +130,23 @@ void* type::apply_offset(void* ptr, const type& source_type, const type& target_
         return info.m_ptr;
 
     auto& class_list = info.m_type.m_type_data->raw_type_data->get_class_data();
-    int i = 0;
+    if (!class_list.has_base_type(tgt_raw_type->get_class_data()))
+        return nullptr;
+
+    const std::size_t src_id = info.m_type.m_type_data->raw_type_data->type_index;
+    const std::size_t tgt_id = tgt_raw_type->type_index;
+    std::size_t index = 0;
+    if (detail::type_cast_cache::find(src_id, tgt_id, index))
+        return class_list.m_conversion_list[index](info.m_ptr);
+
     for (auto& t : class_list.m_base_types)
     {
         if (t.m_type_data == tgt_raw_type)
         {
-            return class_list.m_conversion_list[i](info.m_ptr);
+            detail::type_cast_cache::insert(src_id, tgt_id, index);
+            return class_list.m_conversion_list[index](info.m_ptr);
         }
-        ++i;
+        ++index;
     }
 
     return nullptr;
@@ -170,16 +176,18 @@ array_range<type> type::get_base_classes() const RTTR_NOEXCEPT
 
 array_range<type> type::get_derived_classes() const RTTR_NOEXCEPT
 {
-    return array_range<type>(m_type_data->get_class_data().m_derived_types.data(),
-                             m_type_data->get_class_data().m_derived_types.size());
+    std::size_t size = 0;
+    const auto data = m_type_data->get_class_data().m_derived_types.data(size);
+    return array_range<type>(data, size);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 array_range<type> type::get_types() RTTR_NOEXCEPT
 {
-    auto& type_list = detail::type_register_private::get_type_storage();
-    return array_range<type>(&type_list[1], type_list.size() - 1);
+    std::size_t size = 0;
+    const auto data = detail::type_register_private::get_type_storage().data(size);
+    return array_range<type>(data + 1, size - 1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -201,11 +209,25 @@ variant type::get_metadata(const variant& key) const
 
 variant type::create(vector<argument> args) const
 {
-    auto& ctors = m_type_data->get_class_data().m_ctors;
-    for (const auto& ctor : ctors)
+    auto& class_data = m_type_data->get_class_data();
+    auto& ctors = class_data.m_ctors;
+    const auto key = get_call_key(string_view(), args);
+    std::size_t index = 0;
+    if (class_data.m_ctor_overload_cache.find(key, args.size(), index) && index < ctors.size())
+    {
+        const auto& ctor = ctors[index];
+        if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args))
+            return ctor.invoke_variadic(std::move(args));
+    }
+
+    for (index = 0; index < ctors.size(); ++index)
     {
+        const auto& ctor = ctors[index];
         if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args))
+        {
+            class_data.m_ctor_overload_cache.insert(key, args.size(), index);
             return ctor.invoke_variadic(std::move(args));
+        }
     }
 
     return variant();
@@ -222,13 +244,8 @@ bool type::destroy(variant& obj) const RTTR_NOEXCEPT
 
 property type::get_property(string_view name) const RTTR_NOEXCEPT
 {
-    const auto& vec = get_raw_type().m_type_data->get_class_data().m_properties;
-    auto ret = std::find_if(vec.cbegin(), vec.cend(),
-                            [name](const property& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.cend())
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    if (auto ret = class_data.m_property_index.find(name, class_data.m_properties))
         return *ret;
 
     return detail::create_invalid_item<property>();
@@ -298,14 +315,8 @@ array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXC
 
 method type::get_method(string_view name) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    const auto& vec = raw_t.m_type_data->get_class_data().m_methods;
-    auto ret = std::find_if(vec.cbegin(), vec.cend(),
-                            [name](const method& item)
-                            {
-                                return (item.get_name() == name);
-                            });
-    if (ret != vec.cend())
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    if (auto ret = class_data.m_method_index.find(name, class_data.m_methods))
         return *ret;
 
     return detail::create_invalid_item<method>();
@@ -430,12 +441,28 @@ enumeration type::get_enumeration() const RTTR_NOEXCEPT
 
 variant type::invoke(string_view name, instance obj, std::vector<argument> args) const
 {
-    const auto raw_t = get_raw_type();
-    for (const auto& meth : raw_t.m_type_data->get_class_data().m_methods)
+    auto& class_data = get_raw_type().m_type_data->get_class_data();
+    auto& methods = class_data.m_methods;
+    const auto key = get_call_key(name, args);
+    std::size_t index = 0;
+    // a cached entry can belong to another call signature with the same key, so it has to be checked again
+    if (class_data.m_method_overload_cache.find(key, args.size(), index) && index < methods.size())
+    {
+        const auto& meth = methods[index];
+        if ( meth.get_name() == name &&
+             detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+        {
+            return meth.invoke_variadic(obj, args);
+        }
+    }
+
+    for (index = 0; index < methods.size(); ++index)
     {
+        const auto& meth = methods[index];
         if ( meth.get_name() == name &&
              detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
         {
+            class_data.m_method_overload_cache.insert(key, args.size(), index);
             return meth.invoke_variadic(obj, args);
         }
     }
@@ -470,9 +497,7 @@ variant type::invoke(string_view name, std::vector<argument> args)
 
 type type::get_by_name(string_view name) RTTR_NOEXCEPT
 {
-    auto& custom_name_to_id = detail::type_register_private::get_custom_name_to_id();
-    auto ret = custom_name_to_id.find(name);
-    if (ret != custom_name_to_id.end())
+    if (auto ret = detail::type_register_private::get_custom_name_to_id().find(name))
         return (*ret);
 
     return detail::get_invalid_type();
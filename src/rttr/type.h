@@ -37,6 +37,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
 #include <cstdint>
 
 namespace rttr
@@ -167,7 +168,11 @@ struct variant_data_base_policy;
 class RTTR_API type
 {
     public:
+#if RTTR_USE_32BIT_TYPE_ID
+        typedef uint32_t type_id;
+#else
         typedef uint16_t type_id;
+#endif
 
         /*!
          * \brief Assigns a type to another one.
@@ -232,6 +237,9 @@ class RTTR_API type
          * \note This id is unique at process runtime,
          *       but the id can be changed every time the process is executed.
          *
+         * \remark By default the id is a 16 bit value, which limits the number of types to 65535.
+         *         When RTTR is build with the CMake option `USE_32BIT_TYPE_ID`, a 32 bit value is used.
+         *
          * \return The type id.
          */
         RTTR_INLINE type_id get_id() const RTTR_NOEXCEPT;
@@ -1059,6 +1067,39 @@ class RTTR_API type
         template<typename T>
         static void register_less_than_comparator();
 
+        /*!
+         * \brief Register a hash function for template type \p T.
+         *        By default `std::hash<T>` is used, another function object can be given with \p Hash.
+         *
+         * The registered hash function will be used in \ref variant::get_hash(),
+         * so variants, which contain a value of type \p T, can be used as keys of unordered containers.
+         * The hash function has to be consistent with the equal operator of \p T.
+         *
+         * See following example code:
+         *  \code{.cpp}
+         *  struct my_id
+         *  {
+         *     bool operator==(const my_id& rhs) const { return (id == rhs.id); }
+         *     int id;
+         *  };
+         *
+         *  struct my_id_hash
+         *  {
+         *      std::size_t operator()(const my_id& value) const { return std::hash<int>()(value.id); }
+         *  };
+         *
+         *   type::register_equal_comparator<my_id>();
+         *   type::register_hash<my_id, my_id_hash>();
+         *
+         *   std::unordered_map<variant, std::string, std::hash<variant>, variant_equal_to> names;
+         *   names[my_id{23}] = "foo";
+         *  \endcode
+         *
+         * \see variant::get_hash()
+         */
+        template<typename T, typename Hash = std::hash<T>>
+        static void register_hash();
+
     private:
 
         /*!
@@ -0,0 +1,126 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_METHOD_INVOKER_H_
+#define RTTR_TYPED_METHOD_INVOKER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/method/typed_method_invoke.h"
+#include "rttr/method.h"
+
+namespace rttr
+{
+
+/*!
+ * The \ref typed_method_invoker class calls a \ref method directly with a signature known at compile time.
+ *
+ * A \ref method::invoke() call has to pack every argument into an \ref argument object,
+ * check the type of every argument and return the result as \ref variant.
+ * When the signature of a method is known at compile time, a \ref typed_method_invoker can be retrieved once
+ * via \ref method::get_invoker(), which calls the registered function without any of these steps.
+ *
+ * The signature will be checked only once, when the invoker is created. When it does not match, an invalid invoker is returned.
+ * It has to match exactly the signature of the registered function, including references and cv-qualifiers:
+ * a member function `R (C::*)(Args...)` has the signature `R(C&, Args...)`,
+ * a static function `R (*)(Args...)` the signature `R(Args...)`.
+ *
+ * \remark The registered policy of the method is not used; the return value is always returned as it is.
+ *         Default arguments are not used as well, all arguments have to be provided.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref typed_method_invoker object is lightweight and can be copied by value.
+ * It refers to the underlying method data, so it is valid as long as the method is registered.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+\code{.cpp}
+  using namespace rttr;
+  struct MyStruct { int add(int a, int b) { return a + b; } };
+  //...
+  method meth = type::get<MyStruct>().get_method("add");
+  auto add = meth.get_invoker<int(MyStruct&, int, int)>();
+  if (add)
+  {
+     MyStruct obj;
+     std::cout << add(obj, 23, 42); // prints 65
+  }
+\endcode
+ *
+ * \see method
+ */
+template<typename Signature>
+class typed_method_invoker;
+
+template<typename R, typename... Args>
+class typed_method_invoker<R(Args...)>
+{
+    public:
+        /*!
+         * \brief Constructs an invalid invoker.
+         */
+        typed_method_invoker() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this invoker is valid, otherwise false.
+         *
+         * \return True if this invoker is valid, otherwise false.
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this invoker is valid or not.
+         *
+         * \return True if this invoker is valid, otherwise false.
+         */
+        explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Invokes the method with the given arguments \p args.
+         *
+         * \remark The invoker has to be \ref is_valid() "valid"; this is not checked.
+         *
+         * \return The return value of the method.
+         */
+        R operator()(Args... args) const;
+
+    private:
+        typed_method_invoker(const detail::typed_method_access<R(Args...)>& access) RTTR_NOEXCEPT;
+
+        friend class method;
+
+    private:
+        detail::typed_method_access<R(Args...)> m_access;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/typed_method_invoker_impl.h"
+
+#endif // RTTR_TYPED_METHOD_INVOKER_H_
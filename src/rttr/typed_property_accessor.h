@@ -0,0 +1,167 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_TYPED_PROPERTY_ACCESSOR_H_
+#define RTTR_TYPED_PROPERTY_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/property/typed_property_access.h"
+#include "rttr/property.h"
+
+#include <type_traits>
+
+namespace rttr
+{
+
+/*!
+ * The \ref typed_property_accessor class gives read/write access to a \ref property
+ * without going through \ref variant and \ref argument.
+ *
+ * A \ref property::get_value() call will always construct a \ref variant for the returned value,
+ * and \ref property::set_value() has to check the type of the forwarded \ref argument on every call.
+ * When the class type and the value type of a property are known at compile time,
+ * a \ref typed_property_accessor can be retrieved once via \ref property::get_accessor(),
+ * which reads and writes the value directly through the registered member object pointer or getter/setter functions.
+ *
+ * The types will be checked only once, when the accessor is created. When they do not match, an invalid accessor is returned.
+ * `Class_Type` has to be the class which was used to register the property; `T` the value type of the property
+ * without any reference or cv-qualifier.
+ *
+ * \remark At the moment only properties of a class, which were registered with a member object pointer or
+ *         getter/setter member functions and the default policy, can be accessed via a typed accessor.
+ *         Properties of array type are not supported.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref typed_property_accessor object is lightweight and can be copied by value.
+ * It refers to the underlying property data, so it is valid as long as the property is registered.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+\code{.cpp}
+  using namespace rttr;
+  struct MyStruct { std::string name; };
+  //...
+  property prop = type::get<MyStruct>().get_property("name");
+  auto accessor = prop.get_accessor<MyStruct, std::string>();
+  if (accessor)
+  {
+     MyStruct obj;
+     accessor.set_value(obj, "Hello World");
+     std::cout << accessor.get_value(obj); // prints "Hello World"
+  }
+\endcode
+ *
+ * \see property
+ */
+template<typename Class_Type, typename T>
+class typed_property_accessor
+{
+    static_assert(std::is_same<T, typename std::remove_cv<detail::remove_reference_t<T>>::type>::value,
+                  "Please provide the value type of the property without reference or cv-qualifier.");
+    static_assert(!std::is_array<T>::value, "Properties of array type are not supported.");
+
+    public:
+        /*!
+         * \brief Constructs an invalid accessor.
+         */
+        typed_property_accessor() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this accessor is valid, otherwise false.
+         *
+         * \return True if this accessor is valid, otherwise false.
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this accessor is valid or not.
+         *
+         * \return True if this accessor is valid, otherwise false.
+         */
+        explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if the property of this accessor is read only, otherwise false.
+         *
+         * \remark An invalid accessor is always read only.
+         *
+         * \return True if this is a read only property, otherwise false.
+         */
+        bool is_readonly() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the current property value of the given \p object.
+         *
+         * \remark The accessor has to be \ref is_valid() "valid"; this is not checked.
+         *
+         * \return The property value.
+         */
+        T get_value(const Class_Type& object) const;
+
+        /*!
+         * \brief Returns true if the property value can be accessed by reference via \ref get_reference(), otherwise false.
+         *
+         * This is the case for properties registered with a member object pointer
+         * or with a getter function, which returns a reference.
+         *
+         * \return True if the property value can be accessed by reference, otherwise false.
+         */
+        bool has_reference() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns a reference to the current property value of the given \p object; the value is not copied.
+         *
+         * \remark The accessor has to provide a reference (see \ref has_reference()); this is not checked.
+         *
+         * \return The property value.
+         */
+        const T& get_reference(const Class_Type& object) const;
+
+        /*!
+         * \brief Set the property of the given \p object to the given \p value.
+         *
+         * \return True if the property value could be set, otherwise false.
+         */
+        bool set_value(Class_Type& object, const T& value) const;
+
+    private:
+        typed_property_accessor(const detail::typed_property_access<Class_Type, T>& access) RTTR_NOEXCEPT;
+
+        friend class property;
+
+    private:
+        detail::typed_property_access<Class_Type, T> m_access;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/typed_property_accessor_impl.h"
+
+#endif // RTTR_TYPED_PROPERTY_ACCESSOR_H_
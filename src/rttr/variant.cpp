@@ -44,18 +44,18 @@ namespace rttr
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant::variant(const variant& other)
-:   m_policy(other.m_policy)
+:   m_policy(other.m_policy->can_clone ? other.m_policy : detail::get_variant_policy_table<detail::variant_data_policy_empty>())
 {
-    m_policy(detail::variant_policy_operation::CLONE, other.m_data, m_data);
+    m_policy->clone(other.m_data, m_data);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant::variant(variant&& other)
+variant::variant(variant&& other) RTTR_NOEXCEPT
 :   m_policy(other.m_policy)
 {
-    other.m_policy(detail::variant_policy_operation::SWAP, other.m_data, m_data);
-    other.m_policy = &detail::variant_data_policy_empty::invoke;
+    other.m_policy->swap(other.m_data, m_data);
+    other.m_policy = detail::get_variant_policy_table<detail::variant_data_policy_empty>();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -74,22 +74,22 @@ void variant::swap(variant& other)
     if (is_this_valid && is_other_valid)
     {
         detail::variant_data tmp_data;
-        detail::variant_policy_func tmp_policy_func = other.m_policy;
-        other.m_policy(detail::variant_policy_operation::SWAP, other.m_data, tmp_data);
+        const detail::variant_policy_table* tmp_policy = other.m_policy;
+        other.m_policy->swap(other.m_data, tmp_data);
 
-        m_policy(detail::variant_policy_operation::SWAP, m_data, other.m_data);
+        m_policy->swap(m_data, other.m_data);
         other.m_policy = m_policy;
 
-        tmp_policy_func(detail::variant_policy_operation::SWAP, tmp_data, m_data);
-        m_policy = tmp_policy_func;
+        tmp_policy->swap(tmp_data, m_data);
+        m_policy = tmp_policy;
     }
     else
     {
         detail::variant_data& full_data = is_this_valid ? m_data : other.m_data;
         detail::variant_data& empty_data = is_this_valid ? other.m_data : m_data;
-        detail::variant_policy_func full_policy_func = is_this_valid ? m_policy : other.m_policy;
+        const detail::variant_policy_table* full_policy = is_this_valid ? m_policy : other.m_policy;
 
-        full_policy_func(detail::variant_policy_operation::SWAP, full_data, empty_data);
+        full_policy->swap(full_data, empty_data);
 
         std::swap(m_policy, other.m_policy);
     }
@@ -102,21 +102,21 @@ variant& variant::operator=(const variant& other)
     if (this == &other)
         return *this;
 
-    m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
-    other.m_policy(detail::variant_policy_operation::CLONE, other.m_data, m_data);
-    m_policy = other.m_policy;
+    m_policy->destroy(m_data);
+    m_policy = (other.m_policy->can_clone ? other.m_policy : detail::get_variant_policy_table<detail::variant_data_policy_empty>());
+    m_policy->clone(other.m_data, m_data);
 
     return *this;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant& variant::operator=(variant&& other)
+variant& variant::operator=(variant&& other) RTTR_NOEXCEPT
 {
-    m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
-    other.m_policy(detail::variant_policy_operation::SWAP, other.m_data, m_data);
+    m_policy->destroy(m_data);
+    other.m_policy->swap(other.m_data, m_data);
     m_policy = other.m_policy;
-    other.m_policy = &detail::variant_data_policy_empty::invoke;
+    other.m_policy = detail::get_variant_policy_table<detail::variant_data_policy_empty>();
 
     return *this;
 }
@@ -126,66 +126,77 @@ variant& variant::operator=(variant&& other)
 bool variant::compare_equal(const variant& other, bool& ok) const
 {
     ok = false;
-    return m_policy(detail::variant_policy_operation::COMPARE_EQUAL, m_data, std::tie(*this, other, ok));
+    return m_policy->invoke(detail::variant_policy_operation::COMPARE_EQUAL, m_data, std::tie(*this, other, ok));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant::compare_less(const variant& other, bool& ok) const
 {
-    return m_policy(detail::variant_policy_operation::COMPARE_LESS, m_data,  std::tie(*this, other, ok));
+    return m_policy->invoke(detail::variant_policy_operation::COMPARE_LESS, m_data,  std::tie(*this, other, ok));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant::get_hash(bool* ok) const
+{
+    std::size_t result = 0;
+    const bool could_hash = m_policy->invoke(detail::variant_policy_operation::HASH, m_data, result);
+    if (ok)
+        *ok = could_hash;
+
+    // equal values have at least the same type
+    return (could_hash ? result : std::hash<type>()(get_type()));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 void variant::clear()
 {
-    m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
-    m_policy = &detail::variant_data_policy_empty::invoke;
+    m_policy->destroy(m_data);
+    m_policy = detail::get_variant_policy_table<detail::variant_data_policy_empty>();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant::is_valid() const
 {
-    return m_policy(detail::variant_policy_operation::IS_VALID, m_data, detail::argument_wrapper());
+    return m_policy->is_valid;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant::operator bool() const
 {
-    return m_policy(detail::variant_policy_operation::IS_VALID, m_data, detail::argument_wrapper());
+    return m_policy->is_valid;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant::is_array() const
 {
-    return m_policy(detail::variant_policy_operation::IS_ARRAY, m_data, detail::argument_wrapper());
+    return m_policy->invoke(detail::variant_policy_operation::IS_ARRAY, m_data, detail::argument_wrapper());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant::is_associative_container() const
 {
-    return m_policy(detail::variant_policy_operation::IS_ASSOCIATIVE_CONTAINER, m_data, detail::argument_wrapper());
+    return m_policy->invoke(detail::variant_policy_operation::IS_ASSOCIATIVE_CONTAINER, m_data, detail::argument_wrapper());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant::is_sequential_container() const
 {
-    return m_policy(detail::variant_policy_operation::IS_SEQUENTIAL_CONTAINER, m_data, detail::argument_wrapper());
+    return m_policy->invoke(detail::variant_policy_operation::IS_SEQUENTIAL_CONTAINER, m_data, detail::argument_wrapper());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 type variant::get_type() const
 {
-    type src_type = detail::get_invalid_type();
-    m_policy(detail::variant_policy_operation::GET_TYPE, m_data, src_type);
-    return src_type;
+    return m_policy->get_type();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -193,7 +204,7 @@ type variant::get_type() const
 variant variant::extract_wrapped_value() const
 {
     variant var;
-    m_policy(detail::variant_policy_operation::EXTRACT_WRAPPED_VALUE, m_data, var);
+    m_policy->invoke(detail::variant_policy_operation::EXTRACT_WRAPPED_VALUE, m_data, var);
     return var;
 }
 
@@ -202,7 +213,7 @@ variant variant::extract_wrapped_value() const
 variant variant::create_wrapped_value(const type& wrapped_type) const
 {
     variant var;
-    m_policy(detail::variant_policy_operation::CREATE_WRAPPED_VALUE, m_data, std::tie(var, wrapped_type));
+    m_policy->invoke(detail::variant_policy_operation::CREATE_WRAPPED_VALUE, m_data, std::tie(var, wrapped_type));
     return var;
 }
 
@@ -213,7 +224,7 @@ RTTR_BEGIN_DISABLE_DEPRECATED_WARNING
 variant_array_view variant::create_array_view() const
 {
     variant_array_view result;
-    m_policy(detail::variant_policy_operation::TO_ARRAY, m_data, result.m_array_wrapper);
+    m_policy->invoke(detail::variant_policy_operation::TO_ARRAY, m_data, result.m_array_wrapper);
     return result;
 }
 
@@ -224,7 +235,7 @@ RTTR_END_DISABLE_DEPRECATED_WARNING
 variant_associative_view variant::create_associative_view() const
 {
     variant_associative_view result;
-    m_policy(detail::variant_policy_operation::CREATE_ASSOCIATIV_VIEW, m_data, result.m_view);
+    m_policy->invoke(detail::variant_policy_operation::CREATE_ASSOCIATIV_VIEW, m_data, result.m_view);
     return result;
 }
 
@@ -233,7 +244,7 @@ variant_associative_view variant::create_associative_view() const
 variant_sequential_view variant::create_sequential_view() const
 {
     variant_sequential_view result;
-    m_policy(detail::variant_policy_operation::CREATE_SEQUENTIAL_VIEW, m_data, result.m_view);
+    m_policy->invoke(detail::variant_policy_operation::CREATE_SEQUENTIAL_VIEW, m_data, result.m_view);
     return result;
 }
 
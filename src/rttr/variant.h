@@ -66,7 +66,7 @@ namespace detail
     using decay_variant_t = enable_if_t<!std::is_same<Decayed, variant>::value &&
                                         !std::is_same<Decayed, variant_array_view>::value, Decayed>;
 
-    using variant_policy_func = bool (*)(variant_policy_operation, const variant_data&, argument_wrapper);
+    struct variant_policy_table;
 }
 
 /*!
@@ -76,6 +76,8 @@ namespace detail
  * (using containers you can hold multiple types e.g. `std::vector<int>`). Remark that the content is copied
  * into the variant class. Even raw arrays (e.g. `int[10]`) are copied. However, the internal implementation of variant
  * has an optimization for storing small types, which avoid heap allocation.
+ * The size of this inline storage can be increased with the CMake option `VARIANT_INLINE_SIZE` (default: 8 bytes);
+ * e.g. with a size of 32 bytes, also `std::string` and small structs are stored without a heap allocation.
  *
  * The main purpose of this class is to be the return value for \ref property::get_value() "property" and
  * \ref method::invoke() "method" invokes or as container for storing meta data.
@@ -204,19 +206,26 @@ class RTTR_API variant
         /*!
          * \brief Constructs a new variant with the new value \p val.
          *        The value will be copied or moved into the variant.
+         *
+         * \remark A move-only type, like `std::unique_ptr<T>`, has to be moved into the variant.
+         *         Copying such a variant will not copy the value, the copy is an invalid variant.
+         *
+         * \see emplace()
          */
         template<typename T, typename Tp = detail::decay_variant_t<T>>
         variant(T&& val);
 
         /*!
          * \brief Constructs a new variant object from the given variant \p other.
+         *
+         * \remark When \p other contains a move-only type, the constructed variant is invalid.
          */
         variant(const variant& other);
 
         /*!
          * \brief Constructs a new variant via move constructor.
          */
-        variant(variant&& other);
+        variant(variant&& other) RTTR_NOEXCEPT;
 
         /*!
          * \brief Destroys the variant and the contained object.
@@ -236,7 +245,7 @@ class RTTR_API variant
          *
          * \return A reference to the variant with the new data.
          */
-        variant& operator=(variant&& other);
+        variant& operator=(variant&& other) RTTR_NOEXCEPT;
 
         /*!
          * \brief Assigns the value of the \a other variant to this variant.
@@ -341,6 +350,33 @@ class RTTR_API variant
          */
         RTTR_INLINE bool operator>(const variant& other) const;
 
+        /*!
+         * \brief Returns a hash value of the containing value, so variants can be used as keys of
+         *        unordered containers, e.g. `std::unordered_map<variant, int, std::hash<variant>, variant_equal_to>`.
+         *
+         * Hash values are available for arithmetic types, enumerations, `std::string`, \ref string_view,
+         * pointers, arrays, `std::pair`, sequential and associative containers of those types
+         * and all types which were registered with \ref type::register_hash<T>().
+         *
+         * Two variants of the same type, which are equal, have the same hash value.
+         * Arithmetic values and enumerations of different types have the same hash value, when they have the same numeric value,
+         * e.g. `variant(12)` and `variant(12.0)`.
+         *
+         * \attention The hash value is not consistent with \ref variant::operator==(const variant&) const "operator==" for values
+         *            of different types: it compares them after a conversion, e.g. `variant(12) == variant(std::string("12"))`,
+         *            and floating point values are only almost equal, e.g. `variant(1.0000000000001) == variant(1)`;
+         *            but these values have different hash values. So use \ref variant_equal_to as key equality of unordered containers,
+         *            e.g. `std::unordered_set<variant, std::hash<variant>, variant_equal_to>`, or use keys of only one type.
+         *
+         * \remark When no hash value can be computed for the containing type, the hash value of its \ref get_type() "type" is returned
+         *         and \p ok is set to `false`. So all values of this type have the same hash value.
+         *
+         * \see type::register_hash<T>(), variant_equal_to, \ref variant::operator==(const variant&) const "operator=="
+         *
+         * \return The hash value of the containing value.
+         */
+        std::size_t get_hash(bool* ok = nullptr) const;
+
         /*!
          * \brief When the variant contains a value, then this function will clear the content.
          *
@@ -353,6 +389,27 @@ class RTTR_API variant
          */
         void swap(variant& other);
 
+        /*!
+         * \brief Destroys the current content of the variant and constructs a new value of type \p T
+         *        directly inside the variant from the given arguments \p args.
+         *
+         * No temporary object of type \p T is created, which makes this the cheapest way
+         * to place a big or a move-only type inside a variant.
+         *
+         * \code{.cpp}
+         *  variant var;
+         *  auto& ptr = var.emplace<std::unique_ptr<int>>(new int(42));
+         *  var.is_type<std::unique_ptr<int>>();   // returns 'true'
+         *  variant copy = var;                     // copy.is_valid() == false; a 'std::unique_ptr' cannot be copied
+         * \endcode
+         *
+         * \remark When the constructor of \p T throws an exception, the variant is invalid afterwards.
+         *
+         * \return A reference to the new constructed value.
+         */
+        template<typename T, typename... Args>
+        T& emplace(Args&&... args);
+
         /*!
          * \brief Returns `true` if the containing variant data is of the given template type `T`.
          *
@@ -449,6 +506,31 @@ class RTTR_API variant
         template<typename T>
         const T& get_value() const;
 
+        /*!
+         * \brief Returns a pointer to the containing value, when it is of type \p T; otherwise `nullptr`.
+         *
+         * When the variant contains a wrapper type, like `std::shared_ptr<T>` or `std::reference_wrapper<T>`,
+         * a pointer to the wrapped object is returned. Neither the value nor the wrapped object is copied.
+         *
+         * \code{.cpp}
+         *  variant var = std::make_shared<custom_type>();
+         *  if (const custom_type* obj = var.try_get_value<custom_type>())     // no copy of 'custom_type'
+         *      obj->do_something();
+         *
+         *  var = 42;
+         *  var.try_get_value<int>();                                           // returns a pointer to the 'int'
+         *  var.try_get_value<double>();                                        // returns 'nullptr', no conversion is done
+         * \endcode
+         *
+         * \remark Make sure you don't clean this variant, when you still hold the returned pointer.
+         *
+         * \see get_value(), get_wrapped_value()
+         *
+         * \return A pointer to the stored or wrapped value or `nullptr`.
+         */
+        template<typename T>
+        const T* try_get_value() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a reference to the contained wrapped value as type \p T.
          *
@@ -1068,8 +1150,30 @@ class RTTR_API variant
         friend struct detail::variant_data_policy_nullptr_t;
         friend RTTR_API bool detail::variant_compare_less(const variant&, const type&, const variant&, const type&, bool& ok);
 
-        detail::variant_data            m_data;
-        detail::variant_policy_func     m_policy;
+        detail::variant_data                  m_data;
+        const detail::variant_policy_table*   m_policy;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief The \ref variant_equal_to function object compares two variants, which contain the same type, for equality.
+ *
+ * Variants of different types are never equal; so the comparison is consistent with \ref variant::get_hash()
+ * and can be used as key equality of unordered containers:
+ *
+ * \code{.cpp}
+ *   std::unordered_map<variant, int, std::hash<variant>, variant_equal_to> map;
+ *   map[variant(12)] = 1;
+ *   map[variant(std::string("12"))] = 2; // a second key, although 'variant(12) == variant(std::string("12"))'
+ * \endcode
+ */
+struct variant_equal_to
+{
+    /*!
+     * \brief Returns `true`, when \p lhs and \p rhs contain the same type and their values are equal, otherwise `false`.
+     */
+    RTTR_INLINE bool operator()(const variant& lhs, const variant& rhs) const;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -230,18 +230,17 @@ variant_associative_view::const_iterator::const_iterator(const const_iterator &o
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant_associative_view::const_iterator& variant_associative_view::const_iterator::operator=(const_iterator other)
+variant_associative_view::const_iterator& variant_associative_view::const_iterator::operator=(const const_iterator& other)
 {
-    swap(other);
-    return *this;
-}
+    if (this == &other)
+        return *this;
 
-/////////////////////////////////////////////////////////////////////////////////////////
+    // the iterator might be placed inline, so it cannot be swapped byte wise
+    m_view->destroy(m_itr);
+    m_view = other.m_view;
+    m_view->copy(m_itr, other.m_itr);
 
-void variant_associative_view::const_iterator::swap(const_iterator& other)
-{
-    std::swap(m_itr, other.m_itr);
-    std::swap(m_view, other.m_view);
+    return *this;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -319,7 +319,7 @@ class RTTR_API variant_associative_view
                  /*!
                  * \brief Assigns \p other to `this`.
                  */
-                const_iterator& operator=(const_iterator other);
+                const_iterator& operator=(const const_iterator& other);
 
                 /*!
                  * Returns the underlying key and value stored in a `std::pair<key, value>`.
@@ -413,7 +413,6 @@ class RTTR_API variant_associative_view
 
             private:
                 const_iterator(const detail::variant_associative_view_private* view) RTTR_NOEXCEPT;
-                void swap(const_iterator& other);
 
                 friend class variant_associative_view;
 
@@ -0,0 +1,185 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "rttr/variant_memory_resource.h"
+#include "rttr/detail/variant/variant_data_allocation.h"
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+namespace rttr
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class new_delete_resource : public variant_memory_resource
+{
+    public:
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            return ::operator new(size);
+        }
+
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT
+        {
+            ::operator delete(ptr);
+        }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static new_delete_resource& get_new_delete_resource() RTTR_NOEXCEPT
+{
+    // the resource will never be destroyed, because variants with static storage duration
+    // can still return their memory during program termination
+    static std::aligned_storage<sizeof(new_delete_resource), std::alignment_of<new_delete_resource>::value>::type storage;
+    static new_delete_resource* resource = ::new (&storage) new_delete_resource();
+    return *resource;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::atomic<variant_memory_resource*>& get_default_resource() RTTR_NOEXCEPT
+{
+    static std::atomic<variant_memory_resource*> resource(&get_new_delete_resource());
+    return resource;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static variant_memory_resource*& get_thread_resource() RTTR_NOEXCEPT
+{
+    static RTTR_THREAD_LOCAL variant_memory_resource* resource = nullptr;
+    return resource;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The pointer to the resource is stored directly in front of the value;
+ * the header is a multiple of the alignment, so the value is aligned like the allocated memory.
+ */
+static RTTR_INLINE std::size_t get_header_size(std::size_t alignment) RTTR_NOEXCEPT
+{
+    return (alignment > sizeof(variant_memory_resource*) ? alignment : sizeof(variant_memory_resource*));
+}
+
+static RTTR_INLINE std::size_t get_allocation_alignment(std::size_t alignment) RTTR_NOEXCEPT
+{
+    return (alignment > std::alignment_of<variant_memory_resource*>::value ? alignment : std::alignment_of<variant_memory_resource*>::value);
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource::~variant_memory_resource()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* get_new_delete_variant_memory_resource() RTTR_NOEXCEPT
+{
+    return &get_new_delete_resource();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* get_default_variant_memory_resource() RTTR_NOEXCEPT
+{
+    return get_default_resource().load(std::memory_order_acquire);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* set_default_variant_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT
+{
+    if (!resource)
+        resource = &get_new_delete_resource();
+
+    return get_default_resource().exchange(resource, std::memory_order_acq_rel);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* get_variant_memory_resource() RTTR_NOEXCEPT
+{
+    if (auto resource = get_thread_resource())
+        return resource;
+
+    return get_default_variant_memory_resource();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_memory_resource* set_variant_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT
+{
+    auto& thread_resource = get_thread_resource();
+    auto previous = thread_resource;
+    thread_resource = resource;
+    return previous;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* allocate_variant_data(std::size_t size, std::size_t alignment)
+{
+    auto resource = get_variant_memory_resource();
+    const auto header_size = get_header_size(alignment);
+    auto memory = static_cast<char*>(resource->allocate(header_size + size, get_allocation_alignment(alignment)));
+
+    auto value = memory + header_size;
+    *reinterpret_cast<variant_memory_resource**>(value - sizeof(variant_memory_resource*)) = resource;
+    return value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void deallocate_variant_data(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT
+{
+    const auto header_size = get_header_size(alignment);
+    auto value = static_cast<char*>(ptr);
+    auto resource = *reinterpret_cast<variant_memory_resource**>(value - sizeof(variant_memory_resource*));
+    resource->deallocate(value - header_size, header_size + size, get_allocation_alignment(alignment));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
@@ -0,0 +1,166 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#ifndef RTTR_VARIANT_MEMORY_RESOURCE_H_
+#define RTTR_VARIANT_MEMORY_RESOURCE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref variant_memory_resource class is the interface for the memory, which is used by \ref variant
+ * for values which do not fit into its inline storage (e.g. big custom types or big raw arrays).
+ *
+ * By default, this memory is allocated with the global `operator new`.
+ * By deriving from this class and installing an instance with \ref set_variant_memory_resource(),
+ * \ref set_default_variant_memory_resource() or \ref scoped_variant_memory_resource,
+ * the memory can be provided by e.g. a per thread arena or a pool with several size classes.
+ *
+ * Every heap allocated value of a variant remembers the resource, which provided its memory;
+ * so the value will be always returned to this resource, even when the variant is destroyed in another thread
+ * or after the resource was replaced.
+ *
+ * \remark A resource has to outlive all variants, which stores values allocated from it.
+ *         When variants can be destroyed in another thread than they were created, the resource has to be thread safe.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+\code{.cpp}
+  struct my_arena : rttr::variant_memory_resource
+  {
+      void* allocate(std::size_t size, std::size_t alignment) { ... }
+      void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT { ... }
+  };
+
+  void handle_request()
+  {
+      my_arena arena;
+      rttr::scoped_variant_memory_resource scope(&arena);
+      // all variants created in this thread, will use the memory of 'arena'
+  }
+\endcode
+ */
+class RTTR_API variant_memory_resource
+{
+    public:
+        virtual ~variant_memory_resource();
+
+        /*!
+         * \brief Allocates memory with at least \p size bytes, aligned to \p alignment.
+         *
+         * When no memory could be allocated, an exception has to be thrown.
+         *
+         * \return A pointer to the allocated memory.
+         */
+        virtual void* allocate(std::size_t size, std::size_t alignment) = 0;
+
+        /*!
+         * \brief Returns the memory \p ptr to this resource. \p size and \p alignment have the same values
+         *        as for the call to \ref allocate(), which returned \p ptr.
+         */
+        virtual void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT = 0;
+};
+
+/*!
+ * \brief Returns a memory resource, which uses the global `operator new` and `operator delete`.
+ *
+ * \return The new/delete memory resource.
+ */
+RTTR_API variant_memory_resource* get_new_delete_variant_memory_resource() RTTR_NOEXCEPT;
+
+/*!
+ * \brief Returns the process wide memory resource for variants; this is used by all threads,
+ *        which have not set an own resource with \ref set_variant_memory_resource().
+ *
+ * \return The process wide memory resource.
+ */
+RTTR_API variant_memory_resource* get_default_variant_memory_resource() RTTR_NOEXCEPT;
+
+/*!
+ * \brief Sets the process wide memory resource for variants to \p resource.
+ *        When \p resource is a `nullptr`, the \ref get_new_delete_variant_memory_resource() "new/delete resource" will be used.
+ *
+ * \return The previous process wide memory resource.
+ */
+RTTR_API variant_memory_resource* set_default_variant_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT;
+
+/*!
+ * \brief Returns the memory resource, which is used by variants created in the calling thread.
+ *
+ * \return The resource of the calling thread, or the process wide resource, when the thread has not set one.
+ */
+RTTR_API variant_memory_resource* get_variant_memory_resource() RTTR_NOEXCEPT;
+
+/*!
+ * \brief Sets the memory resource for variants created in the calling thread.
+ *        When \p resource is a `nullptr`, the \ref get_default_variant_memory_resource() "process wide resource" will be used.
+ *
+ * \return The previous resource of the calling thread; or a `nullptr` when the thread had not set one.
+ */
+RTTR_API variant_memory_resource* set_variant_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT;
+
+/*!
+ * The \ref scoped_variant_memory_resource class sets the memory resource of the calling thread for its lifetime.
+ * The destructor restores the previous resource.
+ *
+ * \see variant_memory_resource
+ */
+class scoped_variant_memory_resource
+{
+    public:
+        /*!
+         * \brief Sets \p resource as memory resource of the calling thread.
+         */
+        explicit scoped_variant_memory_resource(variant_memory_resource* resource) RTTR_NOEXCEPT
+        :   m_previous(set_variant_memory_resource(resource))
+        {
+        }
+
+        /*!
+         * \brief Restores the previous memory resource of the calling thread.
+         */
+        ~scoped_variant_memory_resource()
+        {
+            set_variant_memory_resource(m_previous);
+        }
+
+        scoped_variant_memory_resource(const scoped_variant_memory_resource&) = delete;
+        scoped_variant_memory_resource& operator=(const scoped_variant_memory_resource&) = delete;
+
+    private:
+        variant_memory_resource* m_previous;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_MEMORY_RESOURCE_H_
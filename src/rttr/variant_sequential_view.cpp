@@ -143,6 +143,13 @@ bool variant_sequential_view::set_size(std::size_t size) const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+void* variant_sequential_view::get_data_address() const RTTR_NOEXCEPT
+{
+    return m_view.get_data_address();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant_sequential_view::const_iterator variant_sequential_view::insert(const const_iterator& pos, argument value)
 {
     const_iterator itr(&m_view);
@@ -233,18 +240,17 @@ variant_sequential_view::const_iterator::const_iterator(const const_iterator &ot
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant_sequential_view::const_iterator& variant_sequential_view::const_iterator::operator=(const_iterator other)
+variant_sequential_view::const_iterator& variant_sequential_view::const_iterator::operator=(const const_iterator& other)
 {
-    swap(other);
-    return *this;
-}
+    if (this == &other)
+        return *this;
 
-/////////////////////////////////////////////////////////////////////////////////////////
+    // the iterator might be placed inline, so it cannot be swapped byte wise
+    m_view->destroy(m_itr);
+    m_view = other.m_view;
+    m_view->copy(m_itr, other.m_itr);
 
-void variant_sequential_view::const_iterator::swap(const_iterator& other)
-{
-    std::swap(m_itr, other.m_itr);
-    std::swap(m_view, other.m_view);
+    return *this;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +224,22 @@ class RTTR_API variant_sequential_view
          */
         bool set_size(std::size_t size) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the address of the first element, when the elements of the container
+         *        are stored contiguously in memory and can be modified.
+         *
+         * This is the case for `std::vector<T>` (except `std::vector<bool>`), `std::array<T, N>` and raw arrays;
+         * the elements can then be read or written in one block, e.g. with `std::memcpy`.
+         *
+         * \return The address of the first element; `nullptr`, when the container is empty, const
+         *         or does not store its elements contiguously.
+         *
+         * \remark The returned address is invalidated, when the size of the container is changed.
+         *
+         * \see get_size(), get_value_type()
+         */
+        void* get_data_address() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Insert a value into the container.
          *
@@ -326,7 +342,7 @@ class RTTR_API variant_sequential_view
                  /*!
                  * \brief Assigns \p other to `this`.
                  */
-                const_iterator& operator=(const_iterator other);
+                const_iterator& operator=(const const_iterator& other);
 
                 /*!
                  * Returns the underlying value in a variant stored in a `std::reference_wrapper<T>`.
@@ -415,7 +431,6 @@ class RTTR_API variant_sequential_view
 
             private:
                 const_iterator(const detail::variant_sequential_view_private* view) RTTR_NOEXCEPT;
-                void swap(const_iterator& other);
 
                 friend class variant_sequential_view;
 
@@ -0,0 +1,393 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+#include <rttr/registration>
+#include <rttr/io/binary.h>
+#include <rttr/io/binary_document.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+namespace
+{
+
+enum class document_shape
+{
+    box = 1,
+    sphere = 7
+};
+
+struct document_material
+{
+    std::string             shader;
+    float                   roughness = 0.0f;
+    std::vector<uint16_t>   channels;
+};
+
+struct document_mesh
+{
+    std::string                     name;
+    std::vector<float>              vertices;
+    std::vector<int32_t>            indices;
+    document_material               material;
+    std::vector<document_material>  layers;
+    std::map<std::string, int>      counters;
+    int16_t                         level = 0;
+    bool                            visible = false;
+    document_shape                  shape = document_shape::box;
+    document_material*              optional = nullptr;
+    std::vector<bool>               flags;
+    std::vector<double>             empty;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+document_material create_material(const std::string& shader, float roughness)
+{
+    document_material m;
+    m.shader = shader;
+    m.roughness = roughness;
+    m.channels = { 1, 2, 65535 };
+    return m;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+document_mesh create_mesh()
+{
+    document_mesh m;
+    m.name = "mesh";
+    for (int i = 0; i < 300; ++i)
+    {
+        m.vertices.push_back(i * 0.5f);
+        m.indices.push_back(-i);
+    }
+    m.material = create_material("plastic", 0.5f);
+    m.layers = { create_material("dust", 0.25f), create_material("rust", 0.75f) };
+    m.counters = { { {"a", 1}, {"b", 2} } };
+    m.level = -3;
+    m.visible = true;
+    m.shape = document_shape::sphere;
+    m.flags = { true, false, true };
+    return m;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void check_equal(const document_material& a, const document_material& b)
+{
+    CHECK(a.shader == b.shader);
+    CHECK(a.roughness == b.roughness);
+    CHECK(a.channels == b.channels);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Copies \p data into an aligned buffer, like a mapped file.
+ */
+std::vector<uint64_t> create_buffer(const std::string& data)
+{
+    std::vector<uint64_t> buffer((data.size() + 7) / 8);
+    std::memcpy(buffer.data(), data.data(), data.size());
+    return buffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool is_inside(const void* ptr, string_view data)
+{
+    const char* address = static_cast<const char*>(ptr);
+    return (address >= data.data() && address < data.data() + data.size());
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<document_material>("document_material")
+        .constructor()(policy::ctor::as_object)
+        .property("shader", &document_material::shader)
+        .property("roughness", &document_material::roughness)
+        .property("channels", &document_material::channels)
+        ;
+
+    registration::class_<document_mesh>("document_mesh")
+        .property("name", &document_mesh::name)
+        .property("vertices", &document_mesh::vertices)
+        .property("indices", &document_mesh::indices)
+        .property("material", &document_mesh::material)
+        .property("layers", &document_mesh::layers)
+        .property("counters", &document_mesh::counters)
+        .property("level", &document_mesh::level)
+        .property("visible", &document_mesh::visible)
+        .property("shape", &document_mesh::shape)
+        .property("optional", &document_mesh::optional)
+        .property("flags", &document_mesh::flags)
+        .property("empty", &document_mesh::empty)
+        ;
+
+    registration::enumeration<document_shape>("document_shape")
+        (
+            value("box", document_shape::box),
+            value("sphere", document_shape::sphere)
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_document - invalid data", "[io]")
+{
+    CHECK(io::binary_document().is_valid() == false);
+    CHECK(io::binary_document().get_root().is_valid() == false);
+    CHECK(io::binary_document(string_view("JSON\x03\x01", 6)).is_valid() == false);
+    CHECK(io::binary_document(string_view("RTTB\x02\x01", 6)).is_valid() == false);
+    CHECK(io::binary_document::map_file("binary_document_test_missing.bin").is_valid() == false);
+
+    io::binary_value value;
+    CHECK(!value);
+    CHECK(value.get_size() == 0);
+    CHECK(value.get_field("name").is_valid() == false);
+    CHECK(value.get_value().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_document - access", "[io]")
+{
+    const document_mesh mesh = create_mesh();
+    const std::string data = io::to_binary(mesh);
+    const auto buffer = create_buffer(data);
+    const string_view bytes(reinterpret_cast<const char*>(buffer.data()), data.size());
+
+    io::binary_document doc(bytes);
+    REQUIRE(doc.is_valid() == true);
+
+    const io::binary_value root = doc.get_root();
+    REQUIRE(root.is_object() == true);
+    REQUIRE(root.get_size() == 12);
+    CHECK(root.get_field_name(0) == "name");
+    CHECK(root.get_field_name(11) == "empty");
+    CHECK(root.get_field_name(12) == "");
+    CHECK(root.get_field("unknown").is_valid() == false);
+    CHECK(root.get_field(12).is_valid() == false);
+
+    SECTION("scalars")
+    {
+        const variant level = root.get_field("level").get_value();
+        REQUIRE(level.is_type<int16_t>() == true);
+        CHECK(level.get_value<int16_t>() == -3);
+
+        CHECK(root.get_field("visible").get_value() == true);
+        CHECK(root.get_field("shape").get_value() == int64_t(7));
+    }
+
+    SECTION("strings refer to the data")
+    {
+        const variant name = root.get_field("name").get_value();
+        REQUIRE(name.is_type<string_view>() == true);
+        const string_view text = name.get_value<string_view>();
+        CHECK(text == "mesh");
+        CHECK(is_inside(text.data(), bytes) == true);
+    }
+
+    SECTION("arithmetic containers refer to the data")
+    {
+        const io::binary_value vertices = root.get_field("vertices");
+        REQUIRE(vertices.is_sequential_container() == true);
+        CHECK(vertices.get_size() == 300);
+
+        const io::mapped_array<float> values = vertices.get_array<float>();
+        REQUIRE(values.size() == 300);
+        CHECK(is_inside(values.data(), bytes) == true);
+        CHECK(reinterpret_cast<std::uintptr_t>(values.data()) % sizeof(float) == 0);
+        CHECK(std::vector<float>(values.begin(), values.end()) == mesh.vertices);
+        CHECK(vertices.get_array<double>().empty() == true);
+
+        const io::mapped_array<int32_t> indices = root.get_field("indices").get_array<int32_t>();
+        CHECK(std::vector<int32_t>(indices.begin(), indices.end()) == mesh.indices);
+        CHECK(root.get_field("indices").get_element(299).get_value() == int32_t(-299));
+        CHECK(root.get_field("indices").get_element(300).is_valid() == false);
+    }
+
+    SECTION("sequential view of an arithmetic container")
+    {
+        variant var = root.get_field("vertices").get_value();
+        REQUIRE(var.is_type<io::mapped_array<float>>() == true);
+        REQUIRE(var.is_sequential_container() == true);
+
+        variant_sequential_view view = var.create_sequential_view();
+        REQUIRE(view.get_size() == 300);
+        CHECK(view.get_value_type() == type::get<float>());
+        CHECK(view.get_value(3).extract_wrapped_value() == 1.5f);
+        CHECK(view.set_value(3, 2.0f) == false);
+        CHECK(view.set_size(2) == false);
+        CHECK(view.get_size() == 300);
+    }
+
+    SECTION("objects are read on demand")
+    {
+        const io::binary_value material = root.get_field("material");
+        REQUIRE(material.is_object() == true);
+        CHECK(material.get_field("roughness").get_value() == 0.5f);
+        CHECK(material.get_field("channels").get_array<uint16_t>().size() == 3);
+
+        document_material m;
+        CHECK(material.read(m) == true);
+        check_equal(m, mesh.material);
+
+        const io::binary_value layers = root.get_field("layers");
+        REQUIRE(layers.get_size() == 2);
+        CHECK(layers.get_value().is_valid() == false);
+        CHECK(layers.get_element(1).read(m) == true);
+        check_equal(m, mesh.layers[1]);
+        CHECK(layers.get_element(0).read(m) == true);
+        check_equal(m, mesh.layers[0]);
+        CHECK(layers.get_element(0).read(instance()) == false);
+        CHECK(root.get_field("level").read(m) == false);
+    }
+
+    SECTION("the values of later fields are found first")
+    {
+        io::binary_document other(bytes);
+        document_material m;
+        // the schema of 'document_material' is defined in front of 'layers', in the field 'material'
+        CHECK(other.get_root().get_field("layers").get_element(1).read(m) == true);
+        check_equal(m, mesh.layers[1]);
+        CHECK(other.get_root().get_field("material").read(m) == true);
+        check_equal(m, mesh.material);
+    }
+
+    SECTION("other values")
+    {
+        const io::binary_value counters = root.get_field("counters");
+        CHECK(counters.is_associative_container() == true);
+        CHECK(counters.get_size() == 2);
+        CHECK(counters.get_value().is_valid() == false);
+
+        const io::binary_value optional = root.get_field("optional");
+        REQUIRE(optional.is_valid() == true);
+        CHECK(optional.is_object() == false);
+        CHECK(optional.get_size() == 0);
+
+        const io::binary_value flags = root.get_field("flags");
+        CHECK(flags.get_size() == 3);
+        CHECK(flags.get_value().is_valid() == false);
+        CHECK(flags.get_element(1).get_value() == false);
+        CHECK(flags.get_element(2).get_value() == true);
+
+        CHECK(root.get_field("empty").get_size() == 0);
+        CHECK(root.get_field("empty").get_value().is_valid() == false);
+        CHECK(root.get_field("empty").get_array<double>().empty() == true);
+    }
+
+    SECTION("read the whole document")
+    {
+        document_mesh m;
+        CHECK(root.read(m) == true);
+        CHECK(m.name == mesh.name);
+        CHECK(m.vertices == mesh.vertices);
+        CHECK(m.indices == mesh.indices);
+        CHECK(m.counters == mesh.counters);
+        CHECK(m.flags == mesh.flags);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary_document - data", "[io]")
+{
+    const document_mesh mesh = create_mesh();
+    const std::string data = io::to_binary(mesh);
+
+    SECTION("unaligned data is copied")
+    {
+        const std::string unaligned = " " + data;
+        io::binary_document doc(string_view(unaligned.data() + 1, data.size()));
+        REQUIRE(doc.is_valid() == true);
+
+        const io::mapped_array<float> values = doc.get_root().get_field("vertices").get_array<float>();
+        CHECK(reinterpret_cast<std::uintptr_t>(values.data()) % sizeof(float) == 0);
+        CHECK(std::vector<float>(values.begin(), values.end()) == mesh.vertices);
+    }
+
+    SECTION("mapped file")
+    {
+        const char* file_name = "binary_document_test.bin";
+        {
+            std::ofstream file(file_name, std::ios::binary);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+
+        {
+            io::binary_document doc = io::binary_document::map_file(file_name);
+            REQUIRE(doc.is_valid() == true);
+
+            const io::mapped_array<int32_t> indices = doc.get_root().get_field("indices").get_array<int32_t>();
+            CHECK(std::vector<int32_t>(indices.begin(), indices.end()) == mesh.indices);
+
+            io::binary_document moved = std::move(doc);
+            CHECK(doc.is_valid() == false);
+            document_material m;
+            CHECK(moved.get_root().get_field("layers").get_element(0).read(m) == true);
+            check_equal(m, mesh.layers[0]);
+        }
+
+        std::remove(file_name);
+    }
+
+    SECTION("truncated data")
+    {
+        const auto buffer = create_buffer(data);
+        for (std::size_t size = 6; size < data.size(); size += 11)
+        {
+            io::binary_document doc(string_view(reinterpret_cast<const char*>(buffer.data()), size));
+            REQUIRE(doc.is_valid() == true);
+
+            const io::binary_value root = doc.get_root();
+            for (std::size_t index = 0; index < root.get_size(); ++index)
+            {
+                const io::binary_value field = root.get_field(index);
+                field.get_value();
+                field.get_element(0).get_value();
+            }
+
+            document_mesh m;
+            CHECK(root.read(m) == false);
+        }
+    }
+}
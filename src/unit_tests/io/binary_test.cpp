@@ -0,0 +1,721 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "unit_tests/io/test_io_streams.h"
+
+#include <catch/catch.hpp>
+#include <rttr/registration>
+#include <rttr/io/binary.h>
+#include <rttr/io/json.h>
+
+#include <array>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+namespace
+{
+
+enum class binary_color : int16_t
+{
+    red = -1,
+    green = 200,
+    blue = 3
+};
+
+struct binary_point
+{
+    binary_point() {}
+    binary_point(float x_, float y_) : x(x_), y(y_) {}
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct binary_data
+{
+    virtual ~binary_data() {}
+
+    bool            flag = false;
+    char            letter = 'a';
+    int8_t          tiny = 0;
+    int16_t         small = 0;
+    int32_t         medium = 0;
+    int64_t         large = 0;
+    uint8_t         u_tiny = 0;
+    uint16_t        u_small = 0;
+    uint32_t        u_medium = 0;
+    uint64_t        u_large = 0;
+    float           ratio = 0.0f;
+    double          precise = 0.0;
+    std::string     name;
+    binary_color    color = binary_color::blue;
+    binary_point    origin;
+
+    std::vector<double>                 samples;
+    std::vector<int32_t>                indices;
+    std::vector<bool>                   mask;
+    std::deque<int16_t>                 history;
+    std::list<std::string>              tags;
+    std::array<uint8_t, 4>              rgba = {{0, 0, 0, 0}};
+    std::vector<binary_point>           points;
+    std::vector<std::vector<int>>       matrix;
+    std::map<std::string, binary_point> named_points;
+    std::map<binary_color, int>         color_counts;
+    std::set<int64_t>                   ids;
+    int                                 no_serialize = 100;
+
+    RTTR_ENABLE()
+};
+
+struct binary_derived_data : binary_data
+{
+    std::vector<float> weights;
+
+    RTTR_ENABLE(binary_data)
+};
+
+struct binary_node
+{
+    int value = 0;
+    binary_node* next = nullptr;
+};
+
+struct binary_owner
+{
+    binary_data* data = nullptr;
+};
+
+struct binary_nested
+{
+    std::vector<std::vector<int>> values;
+};
+
+struct binary_counted
+{
+    binary_counted() {}
+    binary_counted(const binary_counted& other) : value(other.value) { ++copy_count; }
+    binary_counted& operator=(const binary_counted& other) = default;
+
+    std::string value;
+    static int copy_count;
+};
+
+int binary_counted::copy_count = 0;
+
+struct binary_counted_owner
+{
+    binary_counted counted;
+};
+
+struct binary_vector_2d
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+// two versions of the same record
+struct binary_record_v1
+{
+    int32_t                 id = 0;
+    std::string             name;
+    double                  score = 0.0;
+    std::vector<int32_t>    values;
+    binary_point            origin;
+};
+
+struct binary_record_v2
+{
+    std::string             name;
+    int64_t                 id = 0;         // int32_t before
+    std::vector<int64_t>    values;         // std::vector<int32_t> before
+    std::string             origin = "-";   // binary_point before
+    float                   extra = 7.0f;   // new
+};
+
+struct binary_archive_v1
+{
+    std::vector<binary_record_v1>       records;
+    std::map<int, binary_record_v1>     index;
+};
+
+struct binary_archive_v2
+{
+    std::map<int, binary_record_v2>     index;
+    std::vector<binary_record_v2>       records;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_data create_data()
+{
+    binary_data d;
+    d.flag = true;
+    d.letter = 'z';
+    d.tiny = -128;
+    d.small = -32768;
+    d.medium = -123456789;
+    d.large = -9223372036854775807ll - 1;
+    d.u_tiny = 255;
+    d.u_small = 65535;
+    d.u_medium = 4294967295u;
+    d.u_large = 18446744073709551615ull;
+    d.ratio = 0.25f;
+    d.precise = -1.0 / 3.0;
+    d.name = std::string("binary \0 name", 13);
+    d.color = binary_color::red;
+    d.origin = binary_point(1.5f, -2.5f);
+    d.samples = { 0.5, -1.25, 1e300 };
+    for (int32_t i = 0; i < 1000; ++i)
+        d.indices.push_back(i * 1000 - 500000);
+    d.mask = { true, false, true };
+    d.history = { -1, 2, -3 };
+    d.tags = { "a", "", "ccc" };
+    d.rgba = {{ 10, 20, 30, 40 }};
+    d.points = { binary_point(1.0f, 2.0f), binary_point(3.0f, 4.0f) };
+    d.matrix = { {1, 2, 3}, {}, {4} };
+    d.named_points = { { {"first", binary_point(5.0f, 6.0f)}, {"second", binary_point(7.0f, 8.0f)} } };
+    d.color_counts = { { {binary_color::green, 2}, {binary_color::red, -7} } };
+    d.ids = { 3, -1, 2 };
+    d.no_serialize = 12345;
+    return d;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void check_equal(const binary_data& a, const binary_data& b)
+{
+    CHECK(a.flag == b.flag);
+    CHECK(a.letter == b.letter);
+    CHECK(a.tiny == b.tiny);
+    CHECK(a.small == b.small);
+    CHECK(a.medium == b.medium);
+    CHECK(a.large == b.large);
+    CHECK(a.u_tiny == b.u_tiny);
+    CHECK(a.u_small == b.u_small);
+    CHECK(a.u_medium == b.u_medium);
+    CHECK(a.u_large == b.u_large);
+    CHECK(a.ratio == b.ratio);
+    CHECK(a.precise == b.precise);
+    CHECK(a.name == b.name);
+    CHECK(a.color == b.color);
+    CHECK(a.origin.x == b.origin.x);
+    CHECK(a.origin.y == b.origin.y);
+    CHECK(a.samples == b.samples);
+    CHECK(a.indices == b.indices);
+    CHECK(a.mask == b.mask);
+    CHECK(a.history == b.history);
+    CHECK(a.tags == b.tags);
+    CHECK(a.rgba == b.rgba);
+    REQUIRE(a.points.size() == b.points.size());
+    for (std::size_t i = 0; i < a.points.size(); ++i)
+    {
+        CHECK(a.points[i].x == b.points[i].x);
+        CHECK(a.points[i].y == b.points[i].y);
+    }
+    CHECK(a.matrix == b.matrix);
+    REQUIRE(a.named_points.size() == b.named_points.size());
+    for (const auto& item : a.named_points)
+    {
+        auto itr = b.named_points.find(item.first);
+        REQUIRE(itr != b.named_points.end());
+        CHECK(itr->second.x == item.second.x);
+        CHECK(itr->second.y == item.second.y);
+    }
+    CHECK(a.color_counts == b.color_counts);
+    CHECK(a.ids == b.ids);
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<binary_data>("binary_data")
+        .property("flag", &binary_data::flag)
+        .property("letter", &binary_data::letter)
+        .property("tiny", &binary_data::tiny)
+        .property("small", &binary_data::small)
+        .property("medium", &binary_data::medium)
+        .property("large", &binary_data::large)
+        .property("u_tiny", &binary_data::u_tiny)
+        .property("u_small", &binary_data::u_small)
+        .property("u_medium", &binary_data::u_medium)
+        .property("u_large", &binary_data::u_large)
+        .property("ratio", &binary_data::ratio)
+        .property("precise", &binary_data::precise)
+        .property("name", &binary_data::name)
+        .property("color", &binary_data::color)
+        .property("origin", &binary_data::origin)
+        .property("samples", &binary_data::samples)
+        .property("indices", &binary_data::indices)
+        .property("mask", &binary_data::mask)
+        .property("history", &binary_data::history)
+        .property("tags", &binary_data::tags)
+        .property("rgba", &binary_data::rgba)
+        .property("points", &binary_data::points)
+        .property("matrix", &binary_data::matrix)
+        .property("named_points", &binary_data::named_points)
+        .property("color_counts", &binary_data::color_counts)
+        .property("ids", &binary_data::ids)
+        .property("no_serialize", &binary_data::no_serialize)
+        (
+            metadata("NO_SERIALIZE", true)
+        )
+        ;
+
+    registration::class_<binary_derived_data>("binary_derived_data")
+        .property("weights", &binary_derived_data::weights)
+        ;
+
+    registration::class_<binary_point>("binary_point")
+        .constructor()(policy::ctor::as_object)
+        .property("x", &binary_point::x)
+        .property("y", &binary_point::y)
+        ;
+
+    registration::class_<binary_node>("binary_node")
+        .property("value", &binary_node::value)
+        .property("next", &binary_node::next)
+        ;
+
+    registration::class_<binary_owner>("binary_owner")
+        .property("data", &binary_owner::data)
+        ;
+
+    registration::class_<binary_nested>("binary_nested")
+        .property("values", &binary_nested::values)
+        ;
+
+    registration::class_<binary_counted>("binary_counted")
+        .property("value", &binary_counted::value)
+        ;
+
+    registration::class_<binary_counted_owner>("binary_counted_owner")
+        .property("counted", &binary_counted_owner::counted)
+        ;
+
+    registration::class_<binary_vector_2d>("binary_vector_2d")
+        .property("x", &binary_vector_2d::x)
+        .property("y", &binary_vector_2d::y)
+        ;
+
+    registration::class_<binary_record_v1>("binary_record_v1")
+        .constructor()(policy::ctor::as_object)
+        .property("id", &binary_record_v1::id)
+        .property("name", &binary_record_v1::name)
+        .property("score", &binary_record_v1::score)
+        .property("values", &binary_record_v1::values)
+        .property("origin", &binary_record_v1::origin)
+        ;
+
+    registration::class_<binary_record_v2>("binary_record_v2")
+        .constructor()(policy::ctor::as_object)
+        .property("name", &binary_record_v2::name)
+        .property("id", &binary_record_v2::id)
+        .property("values", &binary_record_v2::values)
+        .property("origin", &binary_record_v2::origin)
+        .property("extra", &binary_record_v2::extra)
+        ;
+
+    registration::class_<binary_archive_v1>("binary_archive_v1")
+        .property("records", &binary_archive_v1::records)
+        .property("index", &binary_archive_v1::index)
+        ;
+
+    registration::class_<binary_archive_v2>("binary_archive_v2")
+        .property("index", &binary_archive_v2::index)
+        .property("records", &binary_archive_v2::records)
+        ;
+
+    registration::enumeration<binary_color>("binary_color")
+        (
+            value("red", binary_color::red),
+            value("green", binary_color::green),
+            value("blue", binary_color::blue)
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::to_binary", "[io]")
+{
+    SECTION("encoding")
+    {
+        binary_point p(1.0f, -2.0f);
+        const std::string data = io::to_binary(p);
+        // magic, version, a new schema: fingerprint, two fields with name and kind; then two little endian floats
+        REQUIRE(data.size() == 29);
+        CHECK(data.substr(0, 6) == std::string("RTTB\x03\x01", 6));
+        CHECK(data.substr(14) == std::string("\x02\x01x\x0a\x01y\x0a\x00\x00\x80\x3f\x00\x00\x00\xc0", 15));
+    }
+
+    SECTION("invalid instance")
+    {
+        CHECK(io::to_binary(instance()) == std::string());
+
+        std::ostringstream out;
+        CHECK(io::to_binary(instance(), out) == false);
+    }
+
+    SECTION("smaller than json")
+    {
+        const binary_data d = create_data();
+        io::json_write_options options;
+        options.pretty = false;
+        CHECK(io::to_binary(d).size() < io::to_json(d, options).size());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::from_binary", "[io]")
+{
+    SECTION("round trip")
+    {
+        const binary_data d_1 = create_data();
+        binary_data d_2;
+        CHECK(io::from_binary(io::to_binary(d_1), d_2) == true);
+        check_equal(d_1, d_2);
+        CHECK(d_2.no_serialize == 100);
+    }
+
+    SECTION("existing content is replaced")
+    {
+        binary_data d_1;
+        d_1.indices = { 7 };
+        binary_data d_2 = create_data();
+        CHECK(io::from_binary(io::to_binary(d_1), d_2) == true);
+        check_equal(d_1, d_2);
+    }
+
+    SECTION("truncated data")
+    {
+        const binary_data d_1 = create_data();
+        const std::string data = io::to_binary(d_1);
+        for (std::size_t size = 0; size < data.size(); size += 7)
+        {
+            binary_data d;
+            CHECK(io::from_binary(string_view(data.data(), size), d) == false);
+        }
+    }
+
+    SECTION("wrong header or type")
+    {
+        const binary_data d = create_data();
+        binary_point p;
+        CHECK(io::from_binary(string_view("JSON\x01\x01", 6), p) == false);
+        CHECK(io::from_binary(string_view("RTTB\x01\x01", 6), p) == false);
+        CHECK(io::from_binary(string_view("RTTB\x02\x01", 6), p) == false);
+        CHECK(io::from_binary(string_view("RTTB\x03\x02", 6), p) == false);
+        CHECK(io::from_binary(io::to_binary(p), instance()) == false);
+    }
+
+    SECTION("member objects are accessed in place")
+    {
+        binary_counted_owner o_1;
+        o_1.counted.value = "text";
+        binary_counted::copy_count = 0;
+
+        binary_counted_owner o_2;
+        CHECK(io::from_binary(io::to_binary(o_1), o_2) == true);
+        CHECK(o_2.counted.value == "text");
+        CHECK(binary_counted::copy_count == 0);
+    }
+
+    SECTION("wrong fingerprint")
+    {
+        // the fingerprint follows the header and the schema reference
+        const binary_point p_1(1.0f, 2.0f);
+        std::string data = io::to_binary(p_1);
+        data[6] = static_cast<char>(data[6] ^ 1);
+
+        binary_point p_2;
+        CHECK(io::from_binary(data, p_2) == false);
+    }
+
+    SECTION("deeply nested values")
+    {
+        binary_nested n_1;
+        n_1.values = { {} };
+        std::string data = io::to_binary(n_1);
+
+        // the empty inner container is replaced by containers, which have one container each
+        REQUIRE(data.back() == '\0');
+        data.pop_back();
+        for (int i = 0; i < 1000000; ++i)
+            data += std::string("\x01\x0e", 2);
+
+        binary_nested n_2;
+        CHECK(io::from_binary(data, n_2) == false);
+        binary_point p;
+        CHECK(io::from_binary(data, p) == false); // the values are skipped
+    }
+
+    SECTION("fixed size array with a different size")
+    {
+        binary_data d_1 = create_data();
+        std::string data = io::to_binary(d_1);
+
+        // the size and the kind of the elements of 'rgba' is stored in front of its four elements;
+        // eight elements are added, so the following blocks keep their alignment
+        const auto pos = data.find(std::string("\x04\x06\x0a\x14\x1e\x28", 6));
+        REQUIRE(pos != std::string::npos);
+        data[pos] = 12;
+        data.insert(pos + 6, 8, '\x32');
+
+        binary_data d_2;
+        CHECK(io::from_binary(data, d_2) == true);
+        CHECK(d_2.rgba == (std::array<uint8_t, 4>{{0, 0, 0, 0}}));
+        d_2.rgba = d_1.rgba;
+        check_equal(d_1, d_2);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary - streams", "[io]")
+{
+    const binary_data d_1 = create_data();
+
+    SECTION("std::ostream and std::istream")
+    {
+        std::stringstream stream;
+        CHECK(io::to_binary(d_1, stream, 7) == true); // forces a lot of chunks
+        CHECK(stream.str() == io::to_binary(d_1));
+
+        binary_data d_2;
+        CHECK(io::from_binary(stream, d_2, 5) == true);
+        check_equal(d_1, d_2);
+    }
+
+    SECTION("file descriptor")
+    {
+        binary_data d_2;
+        check_fd_round_trip([&](int fd) { return io::to_binary(d_1, fd, 16); },
+                            [&](int fd) { return io::from_binary(fd, d_2, 16); });
+        check_equal(d_1, d_2);
+    }
+
+    SECTION("corrupt sizes")
+    {
+        binary_record_v1 r_1;
+        r_1.name = "record name";
+        r_1.values = { 7, 8, 9 };
+        const std::string data = io::to_binary(r_1);
+        const std::string huge_size("\x80\x80\x80\x80\x80\x20", 6); // 2^40
+
+        // the number of fields of the schema follows the header, the schema reference and the fingerprint;
+        // the size of 'values' follows 'name' and the 8 bytes of 'score'
+        const auto name_pos = data.find("\x0brecord name");
+        REQUIRE(name_pos != std::string::npos);
+        REQUIRE(data[14] == 5);
+        REQUIRE(data[name_pos + 12 + 8] == 3);
+        for (const auto pos : { std::size_t(14), name_pos, name_pos + 12 + 8 })
+        {
+            std::string corrupt = data;
+            corrupt.replace(pos, 1, huge_size);
+
+            binary_record_v1 r_2;
+            CHECK(io::from_binary(corrupt, r_2) == false);
+            std::istringstream stream(corrupt);
+            CHECK(io::from_binary(stream, r_2) == false); // no up front allocation of the size
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary - pointer members", "[io]")
+{
+    SECTION("derived object via base pointer")
+    {
+        binary_derived_data d_1;
+        static_cast<binary_data&>(d_1) = create_data();
+        d_1.weights = { 0.5f, 1.5f };
+        binary_owner owner_1;
+        owner_1.data = &d_1;
+
+        binary_derived_data d_2;
+        binary_owner owner_2;
+        owner_2.data = &d_2;
+        CHECK(io::from_binary(io::to_binary(owner_1), owner_2) == true);
+        CHECK(owner_2.data == &d_2);
+        check_equal(d_1, d_2);
+        CHECK(d_2.weights == d_1.weights);
+
+        // the additional fields of the derived class are skipped
+        binary_data d_3;
+        owner_2.data = &d_3;
+        CHECK(io::from_binary(io::to_binary(owner_1), owner_2) == true);
+        check_equal(d_1, d_3);
+    }
+
+    SECTION("recursive type")
+    {
+        binary_node node_3; node_3.value = 3;
+        binary_node node_2; node_2.value = 2; node_2.next = &node_3;
+        binary_node node_1; node_1.value = 1; node_1.next = &node_2;
+        const std::string data = io::to_binary(node_1);
+
+        binary_node target_3; target_3.value = 42;
+        binary_node target_2;
+        binary_node target_1; target_1.next = &target_2;
+        target_2.next = &target_3;
+        CHECK(io::from_binary(data, target_1) == true);
+        CHECK(target_1.value == 1);
+        CHECK(target_1.next == &target_2);
+        CHECK(target_2.value == 2);
+        CHECK(target_2.next == &target_3);
+        CHECK(target_3.value == 3);
+        CHECK(target_3.next == nullptr);
+
+        // there is no object for the serialized 'node_3', so it is skipped
+        target_1.value = 0;
+        target_2.value = 0;
+        target_2.next = nullptr;
+        CHECK(io::from_binary(data, target_1) == true);
+        CHECK(target_1.value == 1);
+        CHECK(target_2.value == 2);
+        CHECK(target_2.next == nullptr);
+    }
+
+    SECTION("self-referencing pointer")
+    {
+        binary_node node; node.value = 1; node.next = &node;
+        CHECK(io::to_binary(node).empty() == true);
+
+        std::ostringstream out;
+        CHECK(io::to_binary(node, out) == false);
+    }
+
+    SECTION("maximum depth")
+    {
+        // the root, 255 nested objects and the null pointer of the last one
+        std::vector<binary_node> nodes(256);
+        for (std::size_t i = 0; i + 1 < nodes.size(); ++i)
+            nodes[i].next = &nodes[i + 1];
+
+        const std::string data = io::to_binary(nodes.front());
+        CHECK(data.empty() == false);
+
+        binary_node target;
+        CHECK(io::from_binary(data, target) == true);
+
+        binary_node too_deep; too_deep.next = &nodes.front();
+        CHECK(io::to_binary(too_deep).empty() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::binary - schema evolution", "[io]")
+{
+    SECTION("same schema of another type")
+    {
+        binary_point p(1.5f, 2.5f);
+        binary_vector_2d v;
+        CHECK(io::from_binary(io::to_binary(p), v) == true);
+        CHECK(v.x == 1.5f);
+        CHECK(v.y == 2.5f);
+    }
+
+    SECTION("read an old version")
+    {
+        binary_archive_v1 archive_1;
+        for (int i = 0; i < 3; ++i)
+        {
+            binary_record_v1 record;
+            record.id = -i;
+            record.name = "record " + std::to_string(i);
+            record.score = i * 0.5;
+            record.values = { i, i + 1, -i };
+            record.origin = binary_point(1.0f, 2.0f);
+            archive_1.records.push_back(record);
+            archive_1.index[i] = record;
+        }
+
+        binary_archive_v2 archive_2;
+        CHECK(io::from_binary(io::to_binary(archive_1), archive_2) == true);
+        REQUIRE(archive_2.records.size() == 3);
+        REQUIRE(archive_2.index.size() == 3);
+        for (int i = 0; i < 3; ++i)
+        {
+            for (const auto& record : { archive_2.records[i], archive_2.index[i] })
+            {
+                CHECK(record.id == -i);
+                CHECK(record.name == "record " + std::to_string(i));
+                CHECK(record.values == (std::vector<int64_t>{ i, i + 1, -i }));
+                CHECK(record.origin == "-");
+                CHECK(record.extra == 7.0f);
+            }
+        }
+    }
+
+    SECTION("read a new version")
+    {
+        binary_archive_v2 archive_2;
+        binary_record_v2 record;
+        record.id = 42;
+        record.name = "new";
+        record.values = { 5, 6 };
+        record.extra = 1.0f;
+        archive_2.records = { record, record };
+
+        binary_archive_v1 archive_1;
+        CHECK(io::from_binary(io::to_binary(archive_2), archive_1) == true);
+        REQUIRE(archive_1.records.size() == 2);
+        for (const auto& record_1 : archive_1.records)
+        {
+            CHECK(record_1.id == 42);
+            CHECK(record_1.name == "new");
+            CHECK(record_1.score == 0.0);
+            CHECK(record_1.values == (std::vector<int32_t>{ 5, 6 }));
+        }
+    }
+
+    SECTION("values, which do not fit anymore")
+    {
+        binary_record_v2 record_2;
+        record_2.id = 5000000000ll;
+        record_2.values = { 1, 5000000000ll, 3 };
+
+        binary_record_v1 record_1;
+        record_1.id = 17;
+        CHECK(io::from_binary(io::to_binary(record_2), record_1) == true);
+        CHECK(record_1.id == 17);
+        CHECK(record_1.values == (std::vector<int32_t>{ 1, 0, 3 }));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,464 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "unit_tests/io/test_io_streams.h"
+
+#include <catch/catch.hpp>
+#include <rttr/registration>
+#include <rttr/io/json.h>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+namespace
+{
+
+enum class json_color
+{
+    red,
+    green,
+    blue
+};
+
+struct json_point
+{
+    json_point() {}
+    json_point(int x_, int y_) : x(x_), y(y_) {}
+    int x = 0;
+    int y = 0;
+};
+
+struct json_shape
+{
+    json_shape() {}
+    virtual ~json_shape() {}
+
+    void set_visible(bool v) { visible = v; }
+    bool get_visible() const { return visible; }
+
+    json_color color = json_color::blue;
+    std::string name;
+    json_point position;
+    std::map<json_color, json_point> dictionary;
+    std::set<int> ids;
+
+    RTTR_ENABLE()
+private:
+    bool visible = false;
+};
+
+struct json_circle : json_shape
+{
+    double radius = 1.0;
+    std::vector<json_point> points;
+    std::vector<std::vector<int>> matrix;
+    uint64_t big_number = 0;
+    char letter = 'a';
+    int no_serialize = 100;
+
+    RTTR_ENABLE(json_shape)
+};
+
+struct json_node
+{
+    int value = 0;
+    json_node* next = nullptr;
+};
+
+struct json_owner
+{
+    json_shape* shape = nullptr;
+};
+
+struct json_counted
+{
+    json_counted() {}
+    json_counted(const json_counted& other) : value(other.value) { ++copy_count; }
+    json_counted& operator=(const json_counted& other) = default;
+
+    int value = 0;
+    static int copy_count;
+};
+
+int json_counted::copy_count = 0;
+
+struct json_counted_owner
+{
+    json_counted counted;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+json_circle create_circle()
+{
+    json_circle c;
+    c.set_visible(true);
+    c.color = json_color::red;
+    c.name = "Circle \"#1\"";
+    c.position = json_point(12, 66);
+    c.dictionary = { { {json_color::green, json_point(1, 2)}, {json_color::red, json_point(5, 6)} } };
+    c.ids = {3, 1, 2};
+    c.radius = 5.125;
+    c.points = { json_point(1, 1), json_point(23, 42) };
+    c.matrix = { {1, 2, 3}, {}, {4} };
+    c.big_number = 18446744073709551615ull;
+    c.letter = 'z';
+    c.no_serialize = 12345;
+    return c;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void check_equal(const json_circle& a, const json_circle& b)
+{
+    CHECK(a.get_visible() == b.get_visible());
+    CHECK(a.color == b.color);
+    CHECK(a.name == b.name);
+    CHECK(a.position.x == b.position.x);
+    CHECK(a.position.y == b.position.y);
+    REQUIRE(a.dictionary.size() == b.dictionary.size());
+    for (const auto& item : a.dictionary)
+    {
+        auto itr = b.dictionary.find(item.first);
+        REQUIRE(itr != b.dictionary.end());
+        CHECK(itr->second.x == item.second.x);
+        CHECK(itr->second.y == item.second.y);
+    }
+    CHECK(a.ids == b.ids);
+    CHECK(a.radius == b.radius);
+    REQUIRE(a.points.size() == b.points.size());
+    for (std::size_t i = 0; i < a.points.size(); ++i)
+    {
+        CHECK(a.points[i].x == b.points[i].x);
+        CHECK(a.points[i].y == b.points[i].y);
+    }
+    CHECK(a.matrix == b.matrix);
+    CHECK(a.big_number == b.big_number);
+    CHECK(a.letter == b.letter);
+}
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<json_shape>("json_shape")
+        .property("visible", &json_shape::get_visible, &json_shape::set_visible)
+        .property("color", &json_shape::color)
+        .property("name", &json_shape::name)
+        .property("position", &json_shape::position)
+        .property("dictionary", &json_shape::dictionary)
+        .property("ids", &json_shape::ids)
+        ;
+
+    registration::class_<json_circle>("json_circle")
+        .property("radius", &json_circle::radius)
+        .property("points", &json_circle::points)
+        .property("matrix", &json_circle::matrix)
+        .property("big_number", &json_circle::big_number)
+        .property("letter", &json_circle::letter)
+        .property("no_serialize", &json_circle::no_serialize)
+        (
+            metadata("NO_SERIALIZE", true)
+        )
+        ;
+
+    registration::class_<json_point>("json_point")
+        .constructor()(policy::ctor::as_object)
+        .property("x", &json_point::x)
+        .property("y", &json_point::y)
+        ;
+
+    registration::class_<json_node>("json_node")
+        .property("value", &json_node::value)
+        .property("next", &json_node::next)
+        ;
+
+    registration::class_<json_owner>("json_owner")
+        .property("shape", &json_owner::shape)
+        ;
+
+    registration::class_<json_counted>("json_counted")
+        .property("value", &json_counted::value)
+        ;
+
+    registration::class_<json_counted_owner>("json_counted_owner")
+        .property("counted", &json_counted_owner::counted)
+        ;
+
+    registration::enumeration<json_color>("json_color")
+        (
+            value("red", json_color::red),
+            value("green", json_color::green),
+            value("blue", json_color::blue)
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::to_json", "[io]")
+{
+    SECTION("compact")
+    {
+        json_point p(1, -2);
+        io::json_write_options options;
+        options.pretty = false;
+        CHECK(io::to_json(p, options) == R"({"x":1,"y":-2})");
+    }
+
+    SECTION("pretty")
+    {
+        json_point p(3, 4);
+        CHECK(io::to_json(p) == "{\n    \"x\": 3,\n    \"y\": 4\n}");
+    }
+
+    SECTION("invalid instance")
+    {
+        CHECK(io::to_json(instance()) == std::string());
+
+        std::ostringstream out;
+        CHECK(io::to_json(instance(), out) == false);
+    }
+
+    SECTION("no_serialize")
+    {
+        const json_circle c = create_circle();
+        const auto text = io::to_json(c);
+        CHECK(text.find("no_serialize") == std::string::npos);
+        CHECK(text.find("\"radius\"") != std::string::npos);
+        CHECK(text.find("\"red\"") != std::string::npos);
+    }
+
+    SECTION("derived type via base reference")
+    {
+        json_circle c = create_circle();
+        json_shape& s = c;
+        CHECK(io::to_json(s) == io::to_json(c));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::from_json", "[io]")
+{
+    SECTION("round trip")
+    {
+        const json_circle c_1 = create_circle();
+        json_circle c_2;
+        CHECK(io::from_json(io::to_json(c_1), c_2) == true);
+        check_equal(c_1, c_2);
+        CHECK(c_2.no_serialize == 100);
+    }
+
+    SECTION("existing content is replaced")
+    {
+        json_circle c_1;
+        c_1.points = { json_point(7, 8) };
+        json_circle c_2 = create_circle();
+        c_2.ids.insert(42);
+        CHECK(io::from_json(io::to_json(c_1), c_2) == true);
+        check_equal(c_1, c_2);
+    }
+
+    SECTION("unknown members and mismatching values are skipped")
+    {
+        json_point p;
+        const std::string text = R"({"z": {"a": [1, {"b": []}]}, "x": 5, "w": [[1], {}], "y": "text"})";
+        CHECK(io::from_json(text, p) == true);
+        CHECK(p.x == 5);
+        CHECK(p.y == 0);
+    }
+
+    SECTION("members in any order")
+    {
+        json_circle c;
+        const std::string text = R"({"radius": 2.5, "points": [{"y": 2, "x": 1}], "name": "abc", "radius": 3.5})";
+        CHECK(io::from_json(text, c) == true);
+        CHECK(c.radius == 3.5);
+        CHECK(c.name == "abc");
+        REQUIRE(c.points.size() == 1);
+        CHECK(c.points[0].x == 1);
+        CHECK(c.points[0].y == 2);
+    }
+
+    SECTION("invalid json")
+    {
+        json_point p;
+        CHECK(io::from_json(string_view(R"({"x": 5,)"), p) == false);
+        CHECK(io::from_json(string_view("[1, 2]"), p) == false);
+        CHECK(io::from_json(string_view("42"), p) == false);
+        CHECK(io::from_json(string_view("{}"), instance()) == false);
+    }
+
+    SECTION("member objects are accessed in place")
+    {
+        json_counted_owner o_1;
+        o_1.counted.value = 5;
+        json_counted::copy_count = 0;
+        json_counted_owner o_2;
+        CHECK(io::from_json(io::to_json(o_1), o_2) == true);
+        CHECK(o_2.counted.value == 5);
+        CHECK(json_counted::copy_count == 0);
+    }
+
+    SECTION("floating point values, which are not finite")
+    {
+        for (const double value : { std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity() })
+        {
+            json_circle c_1;
+            c_1.radius = value;
+            json_circle c_2;
+            CHECK(io::from_json(io::to_json(c_1), c_2) == true);
+            CHECK(c_2.radius == value);
+        }
+
+        json_circle c_1;
+        c_1.radius = std::numeric_limits<double>::quiet_NaN();
+        json_circle c_2;
+        CHECK(io::from_json(io::to_json(c_1), c_2) == true);
+        CHECK(std::isnan(c_2.radius));
+    }
+
+    SECTION("deeply nested values")
+    {
+        const std::size_t depth = 200000;
+        json_point p;
+        const std::string text = "{\"z\": " + std::string(depth, '[') + std::string(depth, ']') + ", \"x\": 5}";
+        CHECK(io::from_json(text, p) == true);
+        CHECK(p.x == 5);
+
+        CHECK(io::from_json("{\"z\": " + std::string(depth, '['), p) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json - streams", "[io]")
+{
+    const json_circle c_1 = create_circle();
+
+    SECTION("std::ostream and std::istream")
+    {
+        for (const bool pretty : {true, false})
+        {
+            io::json_write_options options;
+            options.pretty = pretty;
+            options.chunk_size = 7; // forces a lot of chunks
+
+            std::stringstream stream;
+            CHECK(io::to_json(c_1, stream, options) == true);
+            CHECK(stream.str() == io::to_json(c_1, options));
+
+            json_circle c_2;
+            CHECK(io::from_json(stream, c_2, 5) == true);
+            check_equal(c_1, c_2);
+        }
+    }
+
+    SECTION("file descriptor")
+    {
+        io::json_write_options options;
+        options.chunk_size = 16;
+        json_circle c_2;
+        check_fd_round_trip([&](int fd) { return io::to_json(c_1, fd, options); },
+                            [&](int fd) { return io::from_json(fd, c_2, 16); });
+        check_equal(c_1, c_2);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("io::json - pointer members", "[io]")
+{
+    SECTION("derived object via base pointer")
+    {
+        json_circle c_1 = create_circle();
+        json_owner owner_1;
+        owner_1.shape = &c_1;
+
+        const auto text = io::to_json(owner_1);
+        CHECK(text.find("\"radius\"") != std::string::npos);
+
+        json_circle c_2;
+        json_owner owner_2;
+        owner_2.shape = &c_2;
+        CHECK(io::from_json(text, owner_2) == true);
+        CHECK(owner_2.shape == &c_2);
+        check_equal(c_1, c_2);
+    }
+
+    SECTION("recursive type")
+    {
+        json_node node_3; node_3.value = 3;
+        json_node node_2; node_2.value = 2; node_2.next = &node_3;
+        json_node node_1; node_1.value = 1; node_1.next = &node_2;
+
+        io::json_write_options options;
+        options.pretty = false;
+        CHECK(io::to_json(node_1, options) == R"({"value":1,"next":{"value":2,"next":{"value":3,"next":null}}})");
+
+        json_node target_2;
+        json_node target_1; target_1.next = &target_2;
+        CHECK(io::from_json(io::to_json(node_1), target_1) == true);
+        CHECK(target_1.value == 1);
+        CHECK(target_1.next == &target_2);
+        CHECK(target_2.value == 2);
+        CHECK(target_2.next == nullptr);
+    }
+
+    SECTION("self-referencing pointer")
+    {
+        json_node node; node.value = 1; node.next = &node;
+        CHECK(io::to_json(node).empty() == true);
+
+        std::ostringstream out;
+        CHECK(io::to_json(node, out) == false);
+    }
+
+    SECTION("maximum depth")
+    {
+        // the root, 255 nested objects and the null pointer of the last one
+        std::vector<json_node> nodes(256);
+        for (std::size_t i = 0; i + 1 < nodes.size(); ++i)
+            nodes[i].next = &nodes[i + 1];
+
+        CHECK(io::to_json(nodes.front()).empty() == false);
+
+        json_node too_deep; too_deep.next = &nodes.front();
+        CHECK(io::to_json(too_deep).empty() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef TEST_IO_STREAMS_H_
+#define TEST_IO_STREAMS_H_
+
+#include <catch/catch.hpp>
+#include <rttr/detail/base/core_prerequisites.h>
+
+#include <cstdio>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes into a temporary file with \p write_func and reads the file back with \p read_func;
+ * both functions get the file descriptor of the file and return `true` on success.
+ */
+template<typename Write_Func, typename Read_Func>
+void check_fd_round_trip(const Write_Func& write_func, const Read_Func& read_func)
+{
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    const int fd = _fileno(file);
+#else
+    const int fd = fileno(file);
+#endif
+    CHECK(write_func(fd) == true);
+
+    std::rewind(file);
+    CHECK(read_func(fd) == true);
+
+    std::fclose(file);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TEST_IO_STREAMS_H_
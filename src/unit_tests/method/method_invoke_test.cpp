@@ -47,6 +47,15 @@ struct method_invoke_test
     std::array<bool, 8> m_invoked;
 };
 
+struct method_invoke_overload_test
+{
+    method_invoke_overload_test() : m_value(0) {}
+    method_invoke_overload_test(int value) : m_value(value) {}
+    method_invoke_overload_test(double value) : m_value(static_cast<int>(value) * 2) {}
+
+    int m_value;
+};
+
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -65,6 +74,15 @@ RTTR_REGISTRATION
         .method("func_8", std::function<int(int)>([](int value){ return value; }))
         .method("func_9", [](int value){ return value; })
         ;
+
+    registration::class_<method_invoke_overload_test>("method_invoke_overload_test")
+        .constructor<>()
+        .constructor<int>()
+        .constructor<double>()
+        .method("calc", [](int value) { return std::string("int"); })
+        .method("calc", [](double value) { return std::string("double"); })
+        .method("calc", [](int value, int factor) { return std::string("int, int"); })
+        ;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -192,3 +210,33 @@ TEST_CASE("method - invoke - lambda", "[method]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke - overloaded repeated", "[method]")
+{
+    type t = type::get<method_invoke_overload_test>();
+
+    // the second call of every signature is answered by the overload cache
+    for (int i = 0; i < 2; ++i)
+    {
+        CHECK(t.invoke("calc", instance(), {23}).to_string() == "int");
+        CHECK(t.invoke("calc", instance(), {23.0}).to_string() == "double");
+        CHECK(t.invoke("calc", instance(), {23, 42}).to_string() == "int, int");
+        CHECK(t.invoke("calc", instance(), {23.0, 42}).is_valid() == false);
+        CHECK(t.invoke("calc", instance(), {std::string("text")}).is_valid() == false);
+
+        CHECK(t.create().get_value<std::shared_ptr<method_invoke_overload_test>>()->m_value == 0);
+        CHECK(t.create({23}).get_value<std::shared_ptr<method_invoke_overload_test>>()->m_value == 23);
+        CHECK(t.create({23.0}).get_value<std::shared_ptr<method_invoke_overload_test>>()->m_value == 46);
+        CHECK(t.create({std::string("text")}).is_valid() == false);
+    }
+
+    // a new overload has to be found, after the cache was used
+    registration::class_<method_invoke_overload_test>("method_invoke_overload_test")
+        .method("calc", [](std::string value) { return std::string("string"); });
+
+    CHECK(t.invoke("calc", instance(), {std::string("text")}).to_string() == "string");
+    CHECK(t.invoke("calc", instance(), {23}).to_string() == "int");
+    CHECK(t.invoke("calc", instance(), {23.0}).to_string() == "double");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/type>
+
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+namespace
+{
+
+struct typed_invoker_test
+{
+    void set_value(int value) { m_value = value; }
+    int get_value() const { return m_value; }
+    int add(int a, int b) const { return a + b; }
+    std::string concat(const std::string& a, const std::string& b) { return a + b; }
+    int& get_ref() { return m_value; }
+    int sum_6(int a, int b, int c, int d, int e, int f) { return a + b + c + d + e + f; }
+    int with_default(int a, int b) { return a * b; }
+
+    static int static_mul(int a, int b) { return a * b; }
+
+    int m_value = 0;
+};
+
+template<typename Signature>
+static bool has_invoker(string_view name)
+{
+    return type::get<typed_invoker_test>().get_method(name).get_invoker<Signature>().is_valid();
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<typed_invoker_test>("typed_invoker_test")
+        .method("set_value", &typed_invoker_test::set_value)
+        .method("get_value", &typed_invoker_test::get_value)
+        .method("add", &typed_invoker_test::add)
+        .method("concat", &typed_invoker_test::concat)
+        .method("get_ref", &typed_invoker_test::get_ref)
+        .method("sum_6", &typed_invoker_test::sum_6)
+        .method("with_default", &typed_invoker_test::with_default)(default_arguments(2))
+        .method("with_policy", &typed_invoker_test::get_ref)(policy::meth::return_ref_as_ptr)
+        .method("static_mul", &typed_invoker_test::static_mul)
+        .method("lambda", [](int value) { return value + 1; });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - typed invoker - member function", "[method]")
+{
+    typed_invoker_test obj;
+    type t = type::get<typed_invoker_test>();
+
+    auto set_value = t.get_method("set_value").get_invoker<void(typed_invoker_test&, int)>();
+    REQUIRE(set_value.is_valid() == true);
+    CHECK(static_cast<bool>(set_value) == true);
+    set_value(obj, 23);
+    CHECK(obj.m_value == 23);
+
+    auto get_value = t.get_method("get_value").get_invoker<int(typed_invoker_test&)>();
+    REQUIRE(get_value.is_valid() == true);
+    CHECK(get_value(obj) == 23);
+
+    auto add = t.get_method("add").get_invoker<int(typed_invoker_test&, int, int)>();
+    REQUIRE(add.is_valid() == true);
+    CHECK(add(obj, 23, 42) == 65);
+
+    auto concat = t.get_method("concat").get_invoker<std::string(typed_invoker_test&, const std::string&, const std::string&)>();
+    REQUIRE(concat.is_valid() == true);
+    CHECK(concat(obj, "Hello ", "World") == "Hello World");
+
+    auto get_ref = t.get_method("get_ref").get_invoker<int&(typed_invoker_test&)>();
+    REQUIRE(get_ref.is_valid() == true);
+    get_ref(obj) = 12;
+    CHECK(obj.m_value == 12);
+
+    auto sum_6 = t.get_method("sum_6").get_invoker<int(typed_invoker_test&, int, int, int, int, int, int)>();
+    REQUIRE(sum_6.is_valid() == true);
+    CHECK(sum_6(obj, 1, 2, 3, 4, 5, 6) == 21);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - typed invoker - static function", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+
+    auto static_mul = t.get_method("static_mul").get_invoker<int(int, int)>();
+    REQUIRE(static_mul.is_valid() == true);
+    CHECK(static_mul(6, 7) == 42);
+
+    auto lambda = t.get_method("lambda").get_invoker<int(int)>();
+    REQUIRE(lambda.is_valid() == true);
+    CHECK(lambda(41) == 42);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - typed invoker - policy and default arguments", "[method]")
+{
+    typed_invoker_test obj;
+    type t = type::get<typed_invoker_test>();
+
+    // default arguments are not used, all arguments have to be provided
+    CHECK((has_invoker<int(typed_invoker_test&, int)>("with_default") == false));
+    auto with_default = t.get_method("with_default").get_invoker<int(typed_invoker_test&, int, int)>();
+    REQUIRE(with_default.is_valid() == true);
+    CHECK(with_default(obj, 3, 4) == 12);
+
+    // the policy is not used, the value is returned as it is
+    auto with_policy = t.get_method("with_policy").get_invoker<int&(typed_invoker_test&)>();
+    REQUIRE(with_policy.is_valid() == true);
+    CHECK(&with_policy(obj) == &obj.m_value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - typed invoker - invalid", "[method]")
+{
+    typed_method_invoker<int(typed_invoker_test&)> default_invoker;
+    CHECK(default_invoker.is_valid() == false);
+    CHECK(static_cast<bool>(default_invoker) == false);
+
+    // wrong return type
+    CHECK((has_invoker<long(typed_invoker_test&)>("get_value") == false));
+    CHECK((has_invoker<void(typed_invoker_test&)>("get_value") == false));
+    CHECK((has_invoker<int(typed_invoker_test&)>("get_ref") == false));
+    // wrong argument types
+    CHECK((has_invoker<void(typed_invoker_test&, double)>("set_value") == false));
+    CHECK((has_invoker<void(typed_invoker_test&, const int&)>("set_value") == false));
+    CHECK((has_invoker<void(typed_invoker_test&)>("set_value") == false));
+    CHECK((has_invoker<std::string(typed_invoker_test&, std::string, std::string)>("concat") == false));
+    // wrong class type
+    CHECK((has_invoker<int(const typed_invoker_test&)>("get_value") == false));
+    CHECK((has_invoker<int(int&)>("get_value") == false));
+    CHECK((has_invoker<int(typed_invoker_test&, int, int)>("static_mul") == false));
+    CHECK((has_invoker<int()>("does_not_exist") == false));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,202 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/misc/flat_map.h"
+
+#include <catch/catch.hpp>
+
+#include <vector>
+
+using namespace rttr;
+
+namespace
+{
+
+//! Items with the same tens digit get the same hash value.
+template<typename T>
+struct tens_hash
+{
+    std::size_t operator()(const T& value) const { return static_cast<std::size_t>(value / 10); }
+};
+
+using test_map = detail::flat_map<int, int, tens_hash>;
+
+static void insert_key(test_map& map, int key)
+{
+    map.insert(std::move(key), key + 1000);
+}
+
+static bool contains(const test_map& map, int key)
+{
+    const auto itr = map.find(key);
+    return (itr != map.end() && *itr == key + 1000);
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_map - insert past the unsorted threshold", "[flat_map]")
+{
+    test_map map;
+    for (int key = 150; key >= 0; key -= 10)
+        insert_key(map, key);
+
+    // 16 unsorted items are allowed, they stay in the order of insertion
+    REQUIRE(map.value_data().size() == 16);
+    CHECK(map.value_data().front() == 1150);
+    CHECK(map.value_data().back() == 1000);
+
+    // the 17th item merges all items into the sorted part
+    insert_key(map, 160);
+    REQUIRE(map.value_data().size() == 17);
+    for (std::size_t i = 0; i < map.value_data().size(); ++i)
+        CHECK(map.value_data()[i] == static_cast<int>(i * 10) + 1000);
+
+    for (int key = 0; key <= 160; key += 10)
+        CHECK(contains(map, key) == true);
+
+    CHECK(contains(map, 5) == false);
+    CHECK(contains(map, 170) == false);
+
+    // a second insertion of a key is ignored
+    map.insert(60, 42);
+    CHECK(map.value_data().size() == 17);
+    CHECK(*map.find(60) == 1060);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_map - duplicate hash values", "[flat_map]")
+{
+    test_map map;
+    insert_key(map, 15);
+    for (int key = 30; key <= 180; key += 10)
+        insert_key(map, key);
+
+    // 15 is in the sorted part, the following items with the same hash in the unsorted part
+    insert_key(map, 18);
+    insert_key(map, 12);
+    insert_key(map, 19);
+
+    for (const auto key : {15, 18, 12, 19})
+        CHECK(contains(map, key) == true);
+
+    CHECK(contains(map, 10) == false);
+    CHECK(contains(map, 14) == false);
+
+    // for equal hash values the sorted item comes first, then the unsorted items in the order of insertion
+    map.sort();
+    REQUIRE(map.value_data().size() == 20);
+    CHECK(map.value_data()[0] == 1015);
+    CHECK(map.value_data()[1] == 1018);
+    CHECK(map.value_data()[2] == 1012);
+    CHECK(map.value_data()[3] == 1019);
+    CHECK(map.value_data()[4] == 1030);
+
+    for (const auto key : {15, 18, 12, 19})
+        CHECK(contains(map, key) == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_map - erase", "[flat_map]")
+{
+    test_map map;
+    for (int key = 10; key <= 170; key += 10)
+        insert_key(map, key);
+
+    // unsorted items with a smaller hash than the sorted ones
+    insert_key(map, 5);
+    insert_key(map, 1);
+    insert_key(map, 175);
+
+    SECTION("sorted part")
+    {
+        map.erase(80);
+        CHECK(contains(map, 80) == false);
+        CHECK(map.value_data().size() == 19);
+
+        // the first unsorted item is not treated as part of the sorted items
+        for (const auto key : {10, 70, 90, 170, 5, 1, 175})
+            CHECK(contains(map, key) == true);
+
+        map.erase(10);
+        map.erase(170);
+        for (const auto key : {20, 160, 5, 1, 175})
+            CHECK(contains(map, key) == true);
+    }
+
+    SECTION("unsorted part")
+    {
+        map.erase(1);
+        CHECK(contains(map, 1) == false);
+        CHECK(map.value_data().size() == 19);
+
+        for (const auto key : {10, 80, 170, 5, 175})
+            CHECK(contains(map, key) == true);
+    }
+
+    SECTION("not contained")
+    {
+        map.erase(3);
+        map.erase(180);
+        CHECK(map.value_data().size() == 20);
+    }
+
+    map.sort();
+    const auto& value_list = map.value_data();
+    for (std::size_t i = 1; i < value_list.size(); ++i)
+        CHECK(value_list[i - 1] / 10 <= value_list[i] / 10);
+
+    for (const auto value : value_list)
+        CHECK(contains(map, value - 1000) == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_map - lookup in both parts", "[flat_map]")
+{
+    test_map map;
+    for (int key = 0; key < 1000; key += 3)
+    {
+        insert_key(map, key);
+        // every inserted key can be found, whether it is sorted already or not
+        CHECK(contains(map, key) == true);
+        CHECK(contains(map, key + 1) == false);
+    }
+
+    const test_map& const_map = map;
+    for (int key = 0; key < 1000; ++key)
+        CHECK(contains(const_map, key) == (key % 3 == 0));
+
+    map.clear();
+    CHECK(map.value_data().empty() == true);
+    CHECK(contains(map, 0) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
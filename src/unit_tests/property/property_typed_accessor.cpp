@@ -0,0 +1,209 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/registration>
+#include <rttr/type>
+
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+
+namespace
+{
+
+struct typed_accessor_base
+{
+    virtual ~typed_accessor_base() {}
+    int         base_value = 1;
+
+    RTTR_ENABLE()
+};
+
+struct typed_accessor_test : typed_accessor_base
+{
+    int                 value = 23;
+    const int           const_value = 42;
+    std::string         text = "hello";
+    const char*         c_str = "world";
+    int                 array[3] = {1, 2, 3};
+
+    const std::string& get_name() const { return m_name; }
+    void set_name(const std::string& name) { m_name = name; }
+
+    int get_count() { return m_count; }
+    void set_count(int count) { m_count = count; }
+
+    std::string m_name = "name";
+    int         m_count = 7;
+
+    RTTR_ENABLE(typed_accessor_base)
+};
+
+static int g_global_value = 5;
+
+template<typename Class_Type, typename T>
+static bool has_accessor(string_view name)
+{
+    return type::get<typed_accessor_test>().get_property(name).get_accessor<Class_Type, T>().is_valid();
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<typed_accessor_base>("typed_accessor_base")
+        .property("base_value", &typed_accessor_base::base_value);
+
+    registration::class_<typed_accessor_test>("typed_accessor_test")
+        .property("value", &typed_accessor_test::value)
+        .property_readonly("const_value", &typed_accessor_test::const_value)
+        .property("text", &typed_accessor_test::text)
+        .property("c_str", &typed_accessor_test::c_str)
+        .property("array", &typed_accessor_test::array)
+        .property("ptr_text", &typed_accessor_test::text)(policy::prop::bind_as_ptr)
+        .property("name", &typed_accessor_test::get_name, &typed_accessor_test::set_name)
+        .property("count", &typed_accessor_test::get_count, &typed_accessor_test::set_count)
+        .property_readonly("readonly_name", &typed_accessor_test::get_name)
+        .property("global_value", &g_global_value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - typed accessor - member object", "[property]")
+{
+    typed_accessor_test obj;
+    type t = type::get<typed_accessor_test>();
+
+    auto value = t.get_property("value").get_accessor<typed_accessor_test, int>();
+    REQUIRE(value.is_valid() == true);
+    CHECK(static_cast<bool>(value) == true);
+    CHECK(value.is_readonly() == false);
+    CHECK(value.get_value(obj) == 23);
+    CHECK(value.set_value(obj, 12) == true);
+    CHECK(obj.value == 12);
+
+    auto text = t.get_property("text").get_accessor<typed_accessor_test, std::string>();
+    REQUIRE(text.is_valid() == true);
+    CHECK(text.get_value(obj) == "hello");
+    CHECK(text.set_value(obj, "foo") == true);
+    CHECK(obj.text == "foo");
+    REQUIRE(text.has_reference() == true);
+    CHECK(&text.get_reference(obj) == &obj.text);
+
+    auto c_str = t.get_property("c_str").get_accessor<typed_accessor_test, const char*>();
+    REQUIRE(c_str.is_valid() == true);
+    CHECK(std::string(c_str.get_value(obj)) == "world");
+
+    auto const_value = t.get_property("const_value").get_accessor<typed_accessor_test, int>();
+    REQUIRE(const_value.is_valid() == true);
+    CHECK(const_value.is_readonly() == true);
+    CHECK(const_value.get_value(obj) == 42);
+    CHECK(const_value.set_value(obj, 1) == false);
+    CHECK(obj.const_value == 42);
+    REQUIRE(const_value.has_reference() == true);
+    CHECK(&const_value.get_reference(obj) == &obj.const_value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - typed accessor - member function", "[property]")
+{
+    typed_accessor_test obj;
+    type t = type::get<typed_accessor_test>();
+
+    auto name = t.get_property("name").get_accessor<typed_accessor_test, std::string>();
+    REQUIRE(name.is_valid() == true);
+    CHECK(name.is_readonly() == false);
+    CHECK(name.get_value(obj) == "name");
+    CHECK(name.set_value(obj, "new name") == true);
+    CHECK(obj.m_name == "new name");
+    REQUIRE(name.has_reference() == true); // the getter returns a reference
+    CHECK(&name.get_reference(obj) == &obj.m_name);
+
+    auto count = t.get_property("count").get_accessor<typed_accessor_test, int>();
+    REQUIRE(count.is_valid() == true);
+    CHECK(count.get_value(obj) == 7);
+    CHECK(count.set_value(obj, 8) == true);
+    CHECK(obj.m_count == 8);
+    CHECK(count.has_reference() == false); // the getter returns a copy
+
+    auto readonly_name = t.get_property("readonly_name").get_accessor<typed_accessor_test, std::string>();
+    REQUIRE(readonly_name.is_valid() == true);
+    CHECK(readonly_name.is_readonly() == true);
+    CHECK(readonly_name.get_value(obj) == "new name");
+    CHECK(readonly_name.set_value(obj, "foo") == false);
+    CHECK(obj.m_name == "new name");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - typed accessor - base class property", "[property]")
+{
+    typed_accessor_test obj;
+    auto base_value = type::get<typed_accessor_test>().get_property("base_value").get_accessor<typed_accessor_base, int>();
+    REQUIRE(base_value.is_valid() == true);
+    CHECK(base_value.get_value(obj) == 1);
+    CHECK(base_value.set_value(obj, 2) == true);
+    CHECK(obj.base_value == 2);
+
+    // the accessor has to be retrieved with the declaring class type
+    auto invalid = type::get<typed_accessor_test>().get_property("base_value").get_accessor<typed_accessor_test, int>();
+    CHECK(invalid.is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - typed accessor - invalid", "[property]")
+{
+    typed_accessor_test obj;
+
+    typed_property_accessor<typed_accessor_test, int> default_accessor;
+    CHECK(default_accessor.is_valid() == false);
+    CHECK(static_cast<bool>(default_accessor) == false);
+    CHECK(default_accessor.is_readonly() == true);
+    CHECK(default_accessor.has_reference() == false);
+    CHECK(default_accessor.set_value(obj, 1) == false);
+
+    // wrong value type
+    CHECK((has_accessor<typed_accessor_test, double>("value") == false));
+    CHECK((has_accessor<typed_accessor_test, int>("text") == false));
+    // wrong class type
+    CHECK((has_accessor<typed_accessor_base, int>("value") == false));
+
+    // not supported
+    CHECK((has_accessor<typed_accessor_test, std::string*>("ptr_text") == false));
+    CHECK((has_accessor<typed_accessor_test, int*>("array") == false));
+    CHECK((has_accessor<typed_accessor_test, int>("global_value") == false));
+    CHECK((has_accessor<typed_accessor_test, int>("does_not_exist") == false));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
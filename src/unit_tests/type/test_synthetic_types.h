@@ -0,0 +1,73 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TEST_SYNTHETIC_TYPES_H_
+#define RTTR_TEST_SYNTHETIC_TYPES_H_
+
+#include <rttr/type>
+
+#include <cstddef>
+#include <vector>
+
+using type_getter_func = rttr::type(*)();
+
+template<typename T>
+rttr::type get_type_func()
+{
+    return rttr::type::get<T>();
+}
+
+template<template<typename, typename> class Synthetic, typename T1, typename... T2>
+void add_type_getters(std::vector<type_getter_func>& func_list)
+{
+    int dummy[] = { (func_list.push_back(&get_type_func<Synthetic<T1, T2>>), 0)... };
+    (void)dummy;
+}
+
+template<template<typename, typename> class Synthetic, typename... T>
+std::vector<type_getter_func> get_type_getters()
+{
+    std::vector<type_getter_func> func_list;
+    int dummy[] = { (add_type_getters<Synthetic, T, T...>(func_list), 0)... };
+    (void)dummy;
+    return func_list;
+}
+
+/*!
+ * Returns 256 functions, which return the type `Synthetic<T1, T2>` for every pair of 16 fundamental types.
+ * The types are registered on the first call of their function.
+ */
+template<template<typename, typename> class Synthetic>
+std::vector<type_getter_func> get_synthetic_type_getters()
+{
+    return get_type_getters<Synthetic, bool, char, signed char, unsigned char,
+                            short, unsigned short, int, unsigned int,
+                            long, unsigned long, long long, unsigned long long,
+                            float, double, long double, std::nullptr_t>();
+}
+
+#endif // RTTR_TEST_SYNTHETIC_TYPES_H_
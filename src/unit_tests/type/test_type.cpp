@@ -257,6 +257,38 @@ TEST_CASE("Test rttr::type - Virtual Inheritance", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - cast cache stats", "[type]")
+{
+    FinalClass final;
+    ClassMultipleBaseA& baseMultiA = final;
+
+    CHECK(rttr_cast<ClassMultiple3C*>(&baseMultiA) == static_cast<ClassMultiple3C*>(&final));
+    reset_cast_cache_stats();
+    CHECK(get_cast_cache_stats().hit_count == 0);
+    CHECK(get_cast_cache_stats().miss_count == 0);
+
+    // the casts are not counted by default
+    CHECK(rttr_cast<ClassMultiple3C*>(&baseMultiA) == static_cast<ClassMultiple3C*>(&final));
+    CHECK(get_cast_cache_stats().hit_count == 0);
+    set_cast_cache_stats_enabled(true);
+
+    // the cached result has to be the same
+    CHECK(rttr_cast<ClassMultiple3C*>(&baseMultiA) == static_cast<ClassMultiple3C*>(&final));
+    CHECK(rttr_cast<ClassMultiple3C*>(&baseMultiA) == static_cast<ClassMultiple3C*>(&final));
+    CHECK(get_cast_cache_stats().hit_count == 2);
+    CHECK(get_cast_cache_stats().miss_count == 0);
+
+    // invalid casts are rejected before the cache is used
+    ClassMultiple6A classMulti6A;
+    ClassMultipleBaseA& baseMulti6A = classMulti6A;
+    CHECK(rttr_cast<ClassMultiple3C*>(&baseMulti6A) == nullptr);
+    CHECK(get_cast_cache_stats().hit_count == 2);
+    CHECK(get_cast_cache_stats().miss_count == 0);
+    set_cast_cache_stats_enabled(false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("type - get_base_classes()", "[type]")
 {
     DiamondBottom d;
@@ -277,6 +309,30 @@ TEST_CASE("type - is_derived_from()", "[type]")
 
     REQUIRE(type::get(d).is_derived_from(type::get<DiamondTop>()) == true); // dynamic
     REQUIRE(type::get(d).is_derived_from<DiamondTop>() == true); // static
+
+    CHECK(type::get<DiamondLeft>().is_derived_from<DiamondRight>() == false);
+    CHECK(type::get<DiamondTop>().is_derived_from<DiamondBottom>() == false);
+    CHECK(type::get<DiamondTop>().is_derived_from<DiamondTop>() == true);
+    CHECK(type::get<int>().is_derived_from<DiamondTop>() == false);
+
+    CHECK(type::get<FinalClass>().is_derived_from<ClassMultipleBaseA>() == true);
+    CHECK(type::get<FinalClass>().is_derived_from<ClassMultiple6E>() == true);
+    CHECK(type::get<ClassMultiple6A>().is_derived_from<ClassMultipleBaseE>() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - is_base_of()", "[type]")
+{
+    CHECK(type::get<DiamondTop>().is_base_of<DiamondBottom>() == true);
+    CHECK(type::get<DiamondLeft>().is_base_of<DiamondBottom>() == true);
+    CHECK(type::get<DiamondBottom>().is_base_of<DiamondTop>() == false);
+    CHECK(type::get<DiamondLeft>().is_base_of<DiamondRight>() == false);
+    CHECK(type::get<DiamondTop>().is_base_of<int>() == false);
+
+    CHECK(type::get<ClassMultipleBaseC>().is_base_of<FinalClass>() == true);
+    CHECK(type::get<ClassMultiple3D>().is_base_of<ClassMultiple6D>() == true);
+    CHECK(type::get<ClassMultiple3D>().is_base_of<ClassMultiple6A>() == false);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
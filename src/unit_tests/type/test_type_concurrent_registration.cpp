@@ -0,0 +1,142 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "unit_tests/type/test_synthetic_types.h"
+
+#include <catch/catch.hpp>
+#include <rttr/type>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace rttr;
+
+namespace
+{
+
+struct concurrent_base
+{
+    virtual ~concurrent_base() {}
+    RTTR_ENABLE()
+};
+
+template<typename T1, typename T2>
+struct concurrent_derived : concurrent_base
+{
+    RTTR_ENABLE(concurrent_base)
+};
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test rttr::type - concurrent registration", "[type]")
+{
+    // the types are not registered yet, they will be registered on first use inside the threads
+    const auto func_list = get_synthetic_type_getters<concurrent_derived>();
+    REQUIRE(func_list.size() == 256);
+
+    const auto base_type = type::get<concurrent_base>();
+    const std::size_t writer_count = 4;
+    std::atomic<bool> start(false);
+    std::atomic<std::size_t> finished_writers(0);
+    std::atomic<std::size_t> reader_errors(0);
+
+    std::vector<std::vector<type>> result_list(writer_count);
+    std::vector<std::thread> thread_list;
+    for (std::size_t i = 0; i < writer_count; ++i)
+    {
+        thread_list.emplace_back([&, i]()
+        {
+            while (!start.load()) { std::this_thread::yield(); }
+
+            // every thread starts at a different position, so different types and the same type are registered at the same time
+            for (std::size_t j = 0; j < func_list.size(); ++j)
+                result_list[i].push_back(func_list[(j + i * func_list.size() / writer_count) % func_list.size()]());
+
+            ++finished_writers;
+        });
+    }
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        thread_list.emplace_back([&]()
+        {
+            while (!start.load()) { std::this_thread::yield(); }
+
+            while (finished_writers.load() != writer_count)
+            {
+                for (const auto& t : type::get_types())
+                {
+                    if (!t.is_valid() || !type::get_by_name(t.get_name()).is_valid())
+                        ++reader_errors;
+                }
+
+                for (const auto& t : base_type.get_derived_classes())
+                {
+                    if (!t.is_derived_from(base_type))
+                        ++reader_errors;
+                }
+
+                if (type::get_by_name(base_type.get_name()) != base_type)
+                    ++reader_errors;
+            }
+        });
+    }
+
+    start = true;
+    for (auto& thread : thread_list)
+        thread.join();
+
+    CHECK(reader_errors.load() == 0);
+
+    std::set<type> type_set;
+    for (const auto& type_list : result_list)
+    {
+        REQUIRE(type_list.size() == func_list.size());
+        type_set.insert(type_list.begin(), type_list.end());
+    }
+
+    // every thread has to retrieve the same type objects
+    CHECK(type_set.size() == func_list.size());
+
+    std::set<type::type_id> id_set;
+    for (const auto& t : type_set)
+    {
+        CHECK(t.is_valid() == true);
+        CHECK(t.is_derived_from(base_type) == true);
+        CHECK(type::get_by_name(t.get_name()) == t);
+        id_set.insert(t.get_id());
+    }
+    CHECK(id_set.size() == type_set.size());
+    CHECK(base_type.get_derived_classes().size() == func_list.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
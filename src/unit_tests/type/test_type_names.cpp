@@ -55,3 +55,22 @@ TEST_CASE("Test rttr::type - type::get_by_name", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    struct name_test_type {};
+}
+
+TEST_CASE("Test rttr::type - get_name() refers to the original name", "[type]")
+{
+    const auto t = type::get<name_test_type*>();
+
+    // no custom name was registered, so no copy of the name is needed
+    CHECK(t.get_name() == detail::get_type_name<name_test_type*>());
+    CHECK(t.get_name().data() == detail::get_type_name<name_test_type*>().data());
+    CHECK(t.get_raw_type().get_name().data() == detail::get_type_name<name_test_type>().data());
+
+    // a custom name of the raw type, is also used for the derived types
+    CHECK(type::get<std::string*>().get_name() == "std::string*");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,106 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include "unit_tests/type/test_synthetic_types.h"
+#include "rttr/detail/type/type_id_limit.h"
+
+#include <catch/catch.hpp>
+#include <rttr/type>
+
+#include <limits>
+#include <set>
+#include <vector>
+
+using namespace rttr;
+
+namespace
+{
+
+template<typename T1, typename T2>
+struct registry_stress_type {};
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test rttr::type - registry size", "[type]")
+{
+    const auto type_count_before = type::get_types().size();
+
+    std::vector<type> type_list;
+    for (const auto func : get_synthetic_type_getters<registry_stress_type>())
+        type_list.push_back(func());
+
+    REQUIRE(type_list.size() == 256);
+    CHECK(type::get_types().size() == type_count_before + 256);
+
+    std::set<type::type_id> id_set;
+    for (const auto& t : type_list)
+    {
+        REQUIRE(t.is_valid() == true);
+        id_set.insert(t.get_id());
+        CHECK(type::get_by_name(t.get_name()) == t);
+    }
+    CHECK(id_set.size() == type_list.size());
+
+    // the ids are dense, i.e. the id is the position inside the type storage
+    type::type_id expected_id = 1;
+    for (const auto& t : type::get_types())
+        CHECK(t.get_id() == expected_id++);
+
+    CHECK(static_cast<std::size_t>(std::numeric_limits<type::type_id>::max()) >= type::get_types().size());
+#if RTTR_USE_32BIT_TYPE_ID
+    CHECK(sizeof(type::type_id) == 4);
+#else
+    CHECK(sizeof(type::type_id) == 2);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test rttr::type - id exhaustion", "[type]")
+{
+    using detail::get_next_type_id;
+
+    // a smaller id type runs out of ids after 255 types; the id '0' is the invalid type
+    CHECK(get_next_type_id<uint8_t>(1) == 1);
+    CHECK(get_next_type_id<uint8_t>(255) == 255);
+    CHECK(get_next_type_id<uint8_t>(256) == 0);
+    CHECK(get_next_type_id<uint8_t>(1000) == 0);
+
+    CHECK(get_next_type_id<uint16_t>(65535) == 65535);
+    CHECK(get_next_type_id<uint16_t>(65536) == 0);
+
+    // the 32 bit mode ('USE_32BIT_TYPE_ID') continues, where the 16 bit ids are exhausted
+    CHECK(get_next_type_id<uint32_t>(65536) == 65536);
+    CHECK(get_next_type_id<uint32_t>(static_cast<std::size_t>(std::numeric_limits<uint32_t>::max())) == std::numeric_limits<uint32_t>::max());
+
+    CHECK(get_next_type_id<type::type_id>(type::get_types().size() + 1) != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
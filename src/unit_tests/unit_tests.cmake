@@ -26,7 +26,9 @@
 ####################################################################################
 
 set(HEADER_FILES test_classes.h
+                 io/test_io_streams.h
                  method/test_method_reflection.h
+                 type/test_synthetic_types.h
                  type/test_type.h
                  variant/test_enums.h
                  version.rc.in
@@ -37,6 +39,7 @@ set(SOURCE_FILES main.cpp
                  misc/array_range_test.cpp
                  misc/string_view_test.cpp
                  misc/enum_flags_test.cpp
+                 misc/flat_map_test.cpp
                  property/property_access_level_test.cpp
                  property/property_misc_test.cpp
                  property/property_class_inheritance.cpp
@@ -45,8 +48,11 @@ set(SOURCE_FILES main.cpp
                  property/property_member_object.cpp
                  property/property_global_function.cpp
                  property/property_global_object.cpp
+                 property/property_typed_accessor.cpp
                  type/test_type.cpp
+                 type/test_type_concurrent_registration.cpp
                  type/test_type_names.cpp
+                 type/test_type_registry.cpp
                  type/type_prop_meth_invoke.cpp
                  destructor/destructor_invoke_test.cpp
                  destructor/destructor_misc_test.cpp
@@ -60,6 +66,9 @@ set(SOURCE_FILES main.cpp
                  enumeration/enumeration_conversion.cpp
                  enumeration/enumeration_misc.cpp
                  instance/instance_test.cpp
+                 io/binary_document_test.cpp
+                 io/binary_test.cpp
+                 io/json_test.cpp
                  method/method_invoke_defaults_test.cpp
                  method/method_access_level_test.cpp
                  method/test_method_reflection.cpp
@@ -68,15 +77,19 @@ set(SOURCE_FILES main.cpp
                  method/method_invoke_test.cpp
                  method/method_param_info_test.cpp
                  method/method_query_test.cpp
+                 method/method_typed_invoker_test.cpp
                  variant/variant_assign_test.cpp
                  variant/variant_conv_test.cpp
                  variant/variant_ctor_test.cpp
+                 variant/variant_emplace_test.cpp
                  variant/variant_cmp_equal_test.cpp
                  variant/variant_cmp_less_test.cpp
                  variant/variant_cmp_greater_test.cpp
                  variant/variant_cmp_less_or_equal.cpp
                  variant/variant_cmp_greater_or_equal.cpp
+                 variant/variant_hash_test.cpp
                  variant/variant_misc_test.cpp
+                 variant/variant_memory_resource_test.cpp
                  variant/variant_conv_to_bool.cpp
                  variant/variant_conv_to_int8.cpp
                  variant/variant_conv_to_int16.cpp
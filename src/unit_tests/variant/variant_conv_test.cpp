@@ -29,6 +29,8 @@
 
 #include <rttr/registration>
 
+#include <limits>
+
 using namespace rttr;
 
 namespace
@@ -98,6 +100,53 @@ enum class test_enum
     second = 2
 };
 
+struct celsius
+{
+    double m_value;
+};
+
+struct kelvin
+{
+    double m_value;
+};
+
+static kelvin convert_to_kelvin(const celsius& c, bool& ok)
+{
+    ok = true;
+    return kelvin{c.m_value + 273.15};
+}
+
+template<typename T>
+static void check_basic_type_conversion(const T& value)
+{
+    variant var = value;
+    bool ok = false;
+    CHECK(var.convert<bool>(&ok) == true);
+    CHECK(ok == true);
+    CHECK(var.convert<int8_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<int16_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<int32_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<int64_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<uint8_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<uint16_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<uint32_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<uint64_t>(&ok) == 12);
+    CHECK(ok == true);
+    CHECK(var.convert<float>(&ok) == 12.0f);
+    CHECK(ok == true);
+    CHECK(var.convert<double>(&ok) == 12.0);
+    CHECK(ok == true);
+    CHECK(var.convert<std::string>(&ok) == "12");
+    CHECK(ok == true);
+}
+
 } // end anonymous namespace
 
 RTTR_REGISTRATION
@@ -302,7 +351,7 @@ TEST_CASE("variant conversion - to std::string", "[variant]")
         CHECK(var.to_string() == "1.567");
 
         var = 3.12345678f;
-        CHECK(var.to_string() == "3.12346");
+        CHECK(var.to_string() == "3.1234567");
 
         var = 0.0f;
         CHECK(var.to_string() == "0");
@@ -574,6 +623,139 @@ TEST_CASE("variant test - convert custom types", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant test - convert between basic types", "[variant]")
+{
+    check_basic_type_conversion(static_cast<int8_t>(12));
+    check_basic_type_conversion(static_cast<int16_t>(12));
+    check_basic_type_conversion(static_cast<int32_t>(12));
+    check_basic_type_conversion(static_cast<int64_t>(12));
+    check_basic_type_conversion(static_cast<uint8_t>(12));
+    check_basic_type_conversion(static_cast<uint16_t>(12));
+    check_basic_type_conversion(static_cast<uint32_t>(12));
+    check_basic_type_conversion(static_cast<uint64_t>(12));
+    check_basic_type_conversion(12.0f);
+    check_basic_type_conversion(12.0);
+    check_basic_type_conversion(std::string("12"));
+
+    variant var = std::string("hello");
+    bool ok = true;
+    CHECK(var.convert<int>(&ok) == 0);
+    CHECK(ok == false);
+
+    var = 300;
+    CHECK(var.convert<uint8_t>(&ok) == 0);
+    CHECK(ok == false);
+
+    var = 'a';
+    CHECK(var.convert<std::string>(&ok) == "a");
+    CHECK(ok == true);
+
+    var = true;
+    CHECK(var.convert<int>(&ok) == 1);
+    CHECK(ok == true);
+    CHECK(var.convert<std::string>(&ok) == "true");
+    CHECK(ok == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant test - convert with converter registered later", "[variant]")
+{
+    variant var = celsius{10.0};
+    bool ok = true;
+    var.convert<kelvin>(&ok);
+    CHECK(ok == false);
+    // the missing converter is remembered, so check it twice
+    var.convert<kelvin>(&ok);
+    CHECK(ok == false);
+    CHECK(var.can_convert<kelvin>() == false);
+
+    type::register_converter_func(convert_to_kelvin);
+
+    CHECK(var.can_convert<kelvin>() == true);
+    const kelvin k = var.convert<kelvin>(&ok);
+    CHECK(ok == true);
+    CHECK(k.m_value == Approx(283.15));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant test - convert text to numbers", "[variant]")
+{
+    bool ok = true;
+
+    SECTION("malformed text")
+    {
+        const char* const texts[] = { "", "-", "+", " 12", "12 ", "1 2", "12abc", "0x10", "--1", ".", "e5", "1e", "1e+", "1.2.3", "nan1" };
+        for (const auto text : texts)
+        {
+            variant var = std::string(text);
+            var.to_int(&ok);
+            CHECK(ok == false);
+            var.to_uint64(&ok);
+            CHECK(ok == false);
+            var.to_float(&ok);
+            CHECK(ok == false);
+            var.to_double(&ok);
+            CHECK(ok == false);
+        }
+    }
+
+    SECTION("integer limits")
+    {
+        CHECK(variant(std::string("2147483647")).to_int32(&ok) == 2147483647);
+        CHECK(ok == true);
+        CHECK(variant(std::string("-2147483648")).to_int32(&ok) == std::numeric_limits<int32_t>::min());
+        CHECK(ok == true);
+        variant(std::string("2147483648")).to_int32(&ok);
+        CHECK(ok == false);
+
+        CHECK(variant(std::string("+18446744073709551615")).to_uint64(&ok) == std::numeric_limits<uint64_t>::max());
+        CHECK(ok == true);
+        variant(std::string("18446744073709551616")).to_uint64(&ok);
+        CHECK(ok == false);
+        variant(std::string("-0")).to_uint64(&ok);
+        CHECK(ok == false);
+
+        CHECK(variant(std::string("-9223372036854775808")).to_int64(&ok) == std::numeric_limits<int64_t>::min());
+        CHECK(ok == true);
+        variant(std::string("99999999999999999999999")).to_int64(&ok);
+        CHECK(ok == false);
+    }
+
+    SECTION("floating point")
+    {
+        CHECK(variant(std::string("1.5e3")).to_double(&ok) == 1500.0);
+        CHECK(ok == true);
+        CHECK(variant(std::string(".5")).to_double(&ok) == 0.5);
+        CHECK(ok == true);
+        CHECK(variant(std::string("5.")).to_float(&ok) == 5.0f);
+        CHECK(ok == true);
+        CHECK(variant(std::string("-INF")).to_double(&ok) == -std::numeric_limits<double>::infinity());
+        CHECK(ok == true);
+        CHECK(variant(std::string("5e-324")).to_double(&ok) == std::numeric_limits<double>::denorm_min());
+        CHECK(ok == true);
+        // exactly between 1 and the next double, rounded to even
+        CHECK(variant(std::string("1.00000000000000011102230246251565404236316680908203125")).to_double(&ok) == 1.0);
+        CHECK(ok == true);
+        CHECK(variant(std::string("1.00000000000000011102230246251565404236316680908203126")).to_double(&ok) ==
+              1.0000000000000002);
+        CHECK(ok == true);
+        CHECK(variant(std::string("0e999999")).to_double(&ok) == 0.0);
+        CHECK(ok == true);
+
+        // out of range
+        variant(std::string("1e309")).to_double(&ok);
+        CHECK(ok == false);
+        variant(std::string("1e-400")).to_double(&ok);
+        CHECK(ok == false);
+        variant(std::string("3.5e38")).to_float(&ok);
+        CHECK(ok == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant test - convert internal", "[variant]")
 {
     variant var = 23;
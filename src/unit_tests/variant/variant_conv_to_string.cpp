@@ -30,6 +30,8 @@
 #include <catch/catch.hpp>
 #include <rttr/registration>
 
+#include <limits>
+
 using namespace rttr;
 
 RTTR_REGISTRATION
@@ -161,18 +163,18 @@ TEST_CASE("variant::to_string() - from float", "[variant]")
         variant var = 214748.9f;
         REQUIRE(var.can_convert<std::string>() == true);
         bool ok = false;
-        CHECK(var.to_string(&ok) == "214749");
+        CHECK(var.to_string(&ok) == "214748.9");
         CHECK(ok == true);
 
         REQUIRE(var.convert(type::get<std::string>()) == true);
-        CHECK(var.get_value<std::string>() == "214749");
+        CHECK(var.get_value<std::string>() == "214748.9");
     }
 
     SECTION("conversion negative")
     {
         variant var = -214748.9f;
         bool ok = false;
-        CHECK(var.to_string(&ok) == "-214749");
+        CHECK(var.to_string(&ok) == "-214748.9");
         CHECK(ok == true);
         CHECK(var.convert(type::get<std::string>()) == true);
     }
@@ -206,6 +208,54 @@ TEST_CASE("variant::to_string() - from double", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant::to_string() - floating point round trip", "[variant]")
+{
+    SECTION("shortest representation")
+    {
+        CHECK(variant(0.1).to_string()      == "0.1");
+        CHECK(variant(0.3f).to_string()     == "0.3");
+        CHECK(variant(-0.0).to_string()     == "-0");
+        CHECK(variant(100.0).to_string()    == "100");
+        CHECK(variant(0.0001).to_string()   == "0.0001");
+        CHECK(variant(1e-05).to_string()    == "1e-05");
+        CHECK(variant(1e15).to_string()     == "1e+15");
+        CHECK(variant(1.5e300).to_string()  == "1.5e+300");
+        CHECK(variant(1234567.0f).to_string() == "1.234567e+06");
+        CHECK(variant(std::numeric_limits<double>::max()).to_string() == "1.7976931348623157e+308");
+        CHECK(variant(std::numeric_limits<float>::max()).to_string()  == "3.4028235e+38");
+        CHECK(variant(std::numeric_limits<double>::denorm_min()).to_string() == "5e-324");
+    }
+
+    SECTION("special values")
+    {
+        CHECK(variant(std::numeric_limits<double>::infinity()).to_string()  == "inf");
+        CHECK(variant(-std::numeric_limits<double>::infinity()).to_string() == "-inf");
+        CHECK(variant(std::numeric_limits<float>::quiet_NaN()).to_string()  == "nan");
+    }
+
+    SECTION("read back")
+    {
+        const double values[] = { 1.0 / 3.0, 2.0 / 3.0, 0.1 + 0.2, 123456.789e-12, 9007199254740993.0, 1.7976931348623157e308,
+                                  std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::min() };
+        for (const auto value : values)
+        {
+            bool ok = false;
+            CHECK(variant(variant(value).to_string()).to_double(&ok) == value);
+            CHECK(ok == true);
+        }
+
+        const float float_values[] = { 1.0f / 3.0f, 0.1f + 0.2f, 7.0385307e-26f, 16777216.0f };
+        for (const auto value : float_values)
+        {
+            bool ok = false;
+            CHECK(variant(variant(value).to_string()).to_float(&ok) == value);
+            CHECK(ok == true);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant::to_string() - from int8_t", "[variant]")
 {
     SECTION("valid conversion positive")
@@ -157,7 +157,7 @@ bool is_stored_internally(const void* obj, const rttr::variant& var)
 
 struct big_custom_type
 {
-    // two doubles, cannot be stored internally inside variant
+    // two doubles, cannot be stored internally inside variant with the default inline storage size
     std::aligned_storage<sizeof(double[2]), 8>::type m_data;
 };
 
@@ -174,7 +174,17 @@ TEST_CASE("check storage type", "[variant]")
     {
         variant var = big_custom_type{};
         const big_custom_type& obj_big = var.get_value<big_custom_type>();
-        CHECK( !is_stored_internally(&obj_big, var) );
+        CHECK( is_stored_internally(&obj_big, var) == (sizeof(big_custom_type) <= RTTR_VARIANT_INLINE_SIZE) );
+    }
+
+    {
+        variant var = std::string("hello");
+        const std::string& ref_str = var.get_value<std::string>();
+        CHECK( is_stored_internally(&ref_str, var) == (sizeof(std::string) <= RTTR_VARIANT_INLINE_SIZE) );
+
+        variant var_2 = std::move(var);
+        CHECK( var.is_valid() == false );
+        CHECK( var_2.get_value<std::string>() == "hello" );
     }
 
     {
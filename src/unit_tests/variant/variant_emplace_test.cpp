@@ -0,0 +1,176 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+#include <rttr/type>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <array>
+
+using namespace rttr;
+
+namespace
+{
+
+struct ctor_counter
+{
+    ctor_counter(int a, std::string b) : m_a(a), m_b(std::move(b)) { ++ctor_count; }
+    ctor_counter(const ctor_counter& other) : m_a(other.m_a), m_b(other.m_b) { ++copy_count; }
+    ctor_counter(ctor_counter&& other) : m_a(other.m_a), m_b(std::move(other.m_b)) { ++move_count; }
+
+    static void reset() { ctor_count = copy_count = move_count = 0; }
+
+    int m_a;
+    std::string m_b;
+    std::array<double, 8> m_big_data;
+
+    static int ctor_count;
+    static int copy_count;
+    static int move_count;
+};
+
+int ctor_counter::ctor_count = 0;
+int ctor_counter::copy_count = 0;
+int ctor_counter::move_count = 0;
+
+struct move_only_buffer
+{
+    move_only_buffer(std::size_t size) : m_data(size, 'x') {}
+    move_only_buffer(const move_only_buffer&) = delete;
+    move_only_buffer(move_only_buffer&&) = default;
+
+    std::vector<char> m_data;
+    std::array<double, 8> m_big_data;
+};
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::emplace()", "[variant]")
+{
+    SECTION("arithmetic type")
+    {
+        variant var = std::string("text");
+        int& value = var.emplace<int>(42);
+        CHECK(var.is_type<int>() == true);
+        CHECK(var.get_value<int>() == 42);
+        CHECK(&value == &var.get_value<int>());
+    }
+
+    SECTION("std::string")
+    {
+        variant var;
+        var.emplace<std::string>(3, 'a');
+        CHECK(var.is_type<std::string>() == true);
+        CHECK(var.get_value<std::string>() == "aaa");
+    }
+
+    SECTION("custom type, no copy or move")
+    {
+        ctor_counter::reset();
+        variant var = 12;
+        ctor_counter& value = var.emplace<ctor_counter>(23, "text");
+        CHECK(var.is_type<ctor_counter>() == true);
+        CHECK(value.m_a == 23);
+        CHECK(value.m_b == "text");
+        CHECK(ctor_counter::ctor_count == 1);
+        CHECK(ctor_counter::copy_count == 0);
+        CHECK(ctor_counter::move_count == 0);
+
+        variant var_2 = var;
+        CHECK(var_2.get_value<ctor_counter>().m_b == "text");
+        CHECK(ctor_counter::copy_count == 1);
+    }
+
+    SECTION("std::nullptr_t")
+    {
+        variant var = 12;
+        var.emplace<std::nullptr_t>();
+        CHECK(var.is_type<std::nullptr_t>() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - move-only types", "[variant]")
+{
+    SECTION("std::unique_ptr")
+    {
+        variant var = std::unique_ptr<int>(new int(42));
+        REQUIRE(var.is_type<std::unique_ptr<int>>() == true);
+        CHECK(*var.get_value<std::unique_ptr<int>>() == 42);
+        CHECK(var.get_type().get_wrapped_type() == type::get<int*>());
+
+        int* raw_ptr = var.get_value<std::unique_ptr<int>>().get();
+
+        variant var_2 = std::move(var);
+        CHECK(var.is_valid() == false);
+        CHECK(var_2.get_value<std::unique_ptr<int>>().get() == raw_ptr);
+
+        variant var_3 = std::string("text");
+        var_3.swap(var_2);
+        CHECK(var_3.get_value<std::unique_ptr<int>>().get() == raw_ptr);
+        CHECK(var_2.get_value<std::string>() == "text");
+    }
+
+    SECTION("copy is refused")
+    {
+        variant var;
+        var.emplace<std::unique_ptr<int>>(new int(42));
+
+        variant var_2 = var;
+        CHECK(var_2.is_valid() == false);
+        CHECK(var.is_valid() == true);
+
+        variant var_3 = 23;
+        var_3 = var;
+        CHECK(var_3.is_valid() == false);
+        CHECK(*var.get_value<std::unique_ptr<int>>() == 42);
+    }
+
+    SECTION("big move-only type")
+    {
+        variant var = move_only_buffer(1024);
+        CHECK(var.is_type<move_only_buffer>() == true);
+        CHECK(var.get_value<move_only_buffer>().m_data.size() == 1024);
+
+        const char* data = var.get_value<move_only_buffer>().m_data.data();
+        std::vector<variant> var_list;
+        var_list.push_back(std::move(var));
+        var_list.emplace_back(std::unique_ptr<int>(new int(1)));
+        var_list.emplace_back(move_only_buffer(16));
+        CHECK(var_list[0].get_value<move_only_buffer>().m_data.data() == data);
+
+        variant copy = var_list[0];
+        CHECK(copy.is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,230 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <map>
+#include <vector>
+#include <string>
+
+using namespace rttr;
+
+namespace
+{
+
+enum class hash_test_enum
+{
+    first = 1,
+    second = 2
+};
+
+struct hash_test_id
+{
+    int id;
+
+    bool operator==(const hash_test_id& other) const { return (id == other.id); }
+};
+
+struct hash_test_id_hash
+{
+    std::size_t operator()(const hash_test_id& value) const { return std::hash<int>()(value.id); }
+};
+
+struct hash_test_no_hash
+{
+    int id;
+
+    bool operator==(const hash_test_no_hash& other) const { return (id == other.id); }
+};
+
+template<typename T>
+static std::size_t hash_of(const T& value)
+{
+    bool ok = false;
+    const std::size_t result = variant(value).get_hash(&ok);
+    CHECK(ok == true);
+    return result;
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - basic types", "[variant]")
+{
+    SECTION("equal values have equal hash values")
+    {
+        CHECK(hash_of(42) == hash_of(42));
+        CHECK(hash_of(std::string("text")) == hash_of(std::string("text")));
+        CHECK(hash_of(string_view("text")) == hash_of(std::string("text")));
+        CHECK(hash_of(1.5) == hash_of(1.5f));
+    }
+
+    SECTION("different values")
+    {
+        CHECK(hash_of(42) != hash_of(43));
+        CHECK(hash_of(std::string("text")) != hash_of(std::string("test")));
+        CHECK(hash_of(1.5) != hash_of(2.5));
+    }
+
+    SECTION("arithmetic types with the same value")
+    {
+        CHECK(variant(12) == variant(12.0));
+        CHECK(hash_of(12) == hash_of(12.0));
+        CHECK(hash_of(12) == hash_of(static_cast<uint8_t>(12)));
+        CHECK(hash_of(-3) == hash_of(static_cast<int64_t>(-3)));
+        CHECK(hash_of(true) == hash_of(1));
+        CHECK(hash_of(0.0) == hash_of(-0.0));
+    }
+
+    SECTION("enumeration")
+    {
+        CHECK(hash_of(hash_test_enum::first) == hash_of(1));
+        CHECK(hash_of(hash_test_enum::first) != hash_of(hash_test_enum::second));
+    }
+
+    SECTION("pointer")
+    {
+        int value = 23;
+        int* ptr = &value;
+        int* null_ptr = nullptr;
+        CHECK(hash_of(ptr) == hash_of(&value));
+        CHECK(hash_of(null_ptr) == hash_of(nullptr));
+    }
+
+    SECTION("invalid variant")
+    {
+        bool ok = false;
+        CHECK(variant().get_hash(&ok) == variant().get_hash());
+        CHECK(ok == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - containers", "[variant]")
+{
+    CHECK(hash_of(std::vector<int>({1, 2, 3})) == hash_of(std::vector<int>({1, 2, 3})));
+    CHECK(hash_of(std::vector<int>({1, 2, 3})) != hash_of(std::vector<int>({3, 2, 1})));
+
+    std::unordered_set<std::string> set_a = { "one", "two", "three", "four" };
+    std::unordered_set<std::string> set_b(64);
+    set_b.insert({ "four", "three", "two", "one" });
+    CHECK(hash_of(set_a) == hash_of(set_b));
+
+    std::map<int, std::string> map_a = { {1, "one"}, {2, "two"} };
+    std::map<int, std::string> map_b = { {1, "one"}, {2, "zwei"} };
+    CHECK(hash_of(map_a) != hash_of(map_b));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - custom types", "[variant]")
+{
+    bool ok = true;
+    const variant a = hash_test_no_hash{1};
+    const variant b = hash_test_no_hash{2};
+
+    // without a hash function, all values of this type have the same hash value
+    CHECK(a.get_hash(&ok) == b.get_hash());
+    CHECK(ok == false);
+
+    // a container of such values cannot be hashed either
+    std::vector<hash_test_no_hash> vec = { hash_test_no_hash{1} };
+    variant(vec).get_hash(&ok);
+    CHECK(ok == false);
+
+    type::register_equal_comparator<hash_test_id>();
+    type::register_hash<hash_test_id, hash_test_id_hash>();
+    CHECK(hash_of(hash_test_id{5}) == hash_test_id_hash()(hash_test_id{5}));
+    CHECK(hash_of(hash_test_id{5}) != hash_of(hash_test_id{6}));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - std::unordered_map", "[variant]")
+{
+    // template instances are only equal comparable when a comparator was registered
+    using key_list = std::vector<uint16_t>;
+    type::register_equal_comparator<key_list>();
+
+    std::unordered_map<variant, int, std::hash<variant>, variant_equal_to> map;
+    map[variant(1)] = 1;
+    map[variant(std::string("two"))] = 2;
+    map[variant(3.5)] = 3;
+    map[variant(key_list({4, 4}))] = 4;
+
+    CHECK(map.size() == 4);
+    CHECK(map.at(variant(1)) == 1);
+    CHECK(map.at(variant(std::string("two"))) == 2);
+    CHECK(map.at(variant(3.5)) == 3);
+    CHECK(map.at(variant(key_list({4, 4}))) == 4);
+    CHECK(map.find(variant(std::string("four"))) == map.end());
+
+    // keys of different types are different keys
+    CHECK(map.find(variant(1.0)) == map.end());
+    map[variant(static_cast<int64_t>(1))] = 5;
+    CHECK(map.size() == 5);
+    CHECK(map.at(variant(1)) == 1);
+
+    map[variant(1)] = 6;
+    CHECK(map.size() == 5);
+    CHECK(map.at(variant(1)) == 6);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::get_hash() - values of different types", "[variant]")
+{
+    // 'operator==' converts the values, but the hash values differ
+    const variant text(std::string("12"));
+    const variant number(12);
+    const variant almost_one(1.0000000000001);
+    const variant one(1);
+    CHECK(text == number);
+    CHECK(almost_one == one);
+
+    variant_equal_to equal_to;
+    CHECK(equal_to(text, number) == false);
+    CHECK(equal_to(almost_one, one) == false);
+    CHECK(equal_to(number, variant(12)) == true);
+    CHECK(equal_to(text, variant(std::string("12"))) == true);
+    CHECK(equal_to(number, variant()) == false);
+    CHECK(equal_to(variant(), variant()) == true);
+
+    std::unordered_set<variant, std::hash<variant>, variant_equal_to> set = { text, number, almost_one, one };
+    CHECK(set.size() == 4);
+    CHECK(set.count(variant(std::string("12"))) == 1);
+    CHECK(set.count(variant(12)) == 1);
+    CHECK(set.count(variant(12.0)) == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+#include <rttr/type>
+#include <rttr/variant_memory_resource.h>
+
+#include <cstdint>
+#include <thread>
+
+using namespace rttr;
+
+namespace
+{
+
+struct counting_resource : variant_memory_resource
+{
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        ++m_allocations;
+        m_allocated_bytes += size;
+        return get_new_delete_variant_memory_resource()->allocate(size, alignment);
+    }
+
+    void deallocate(void* ptr, std::size_t size, std::size_t alignment) RTTR_NOEXCEPT
+    {
+        ++m_deallocations;
+        m_allocated_bytes -= size;
+        get_new_delete_variant_memory_resource()->deallocate(ptr, size, alignment);
+    }
+
+    std::size_t m_allocations = 0;
+    std::size_t m_deallocations = 0;
+    std::size_t m_allocated_bytes = 0;
+};
+
+// too big for the inline storage of a variant
+struct heap_stored_type
+{
+    std::uint64_t m_data[16];
+};
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - memory resource - scoped", "[variant]")
+{
+    counting_resource resource;
+    variant var_outside_scope;
+    {
+        scoped_variant_memory_resource scope(&resource);
+        CHECK(get_variant_memory_resource() == &resource);
+
+        variant var = heap_stored_type{{1, 2, 3}};
+        CHECK(resource.m_allocations == 1);
+        CHECK(var.get_value<heap_stored_type>().m_data[2] == 3);
+
+        variant var_copy = var;
+        CHECK(resource.m_allocations == 2);
+
+        var_outside_scope = var; // copied into a variant, which outlives the scope
+        CHECK(resource.m_allocations == 3);
+
+        variant var_moved = std::move(var);
+        CHECK(resource.m_allocations == 3);
+
+        int small_value = 23;
+        variant var_small = small_value;
+        CHECK(resource.m_allocations == 3);
+    }
+
+    CHECK(get_variant_memory_resource() == get_default_variant_memory_resource());
+    CHECK(resource.m_deallocations == 2);
+
+    // the value is returned to the resource, which allocated it
+    var_outside_scope.clear();
+    CHECK(resource.m_deallocations == 3);
+    CHECK(resource.m_allocated_bytes == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - memory resource - big array", "[variant]")
+{
+    counting_resource resource;
+    {
+        scoped_variant_memory_resource scope(&resource);
+
+        int int_array[100] = {};
+        int_array[99] = 42;
+        variant var = int_array;
+        CHECK(resource.m_allocations == 1);
+        CHECK(var.get_value<int[100]>()[99] == 42);
+
+        variant var_copy = var;
+        CHECK(resource.m_allocations == 2);
+        CHECK(var_copy.get_value<int[100]>()[99] == 42);
+    }
+
+    CHECK(resource.m_deallocations == 2);
+    CHECK(resource.m_allocated_bytes == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - memory resource - per thread", "[variant]")
+{
+    counting_resource resource;
+    counting_resource thread_resource;
+
+    variant_memory_resource* previous = set_default_variant_memory_resource(&resource);
+    {
+        std::thread thread([&]()
+        {
+            scoped_variant_memory_resource scope(&thread_resource);
+            variant var = heap_stored_type();
+        });
+        thread.join();
+
+        variant var = heap_stored_type();
+        CHECK(resource.m_allocations == 1);
+        CHECK(thread_resource.m_allocations == 1);
+        CHECK(thread_resource.m_deallocations == 1);
+    }
+    CHECK(resource.m_deallocations == 1);
+
+    CHECK(set_default_variant_memory_resource(previous) == &resource);
+    CHECK(set_default_variant_memory_resource(nullptr) == previous);
+    CHECK(get_default_variant_memory_resource() == get_new_delete_variant_memory_resource());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,10 @@
 #include <iostream>
 #include <rttr/type>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 using namespace rttr;
 using namespace std;
 
@@ -138,6 +142,66 @@ TEST_CASE("variant - get_wrapped_value", "[variant]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant - try_get_value", "[variant]")
+{
+    SECTION("stored value")
+    {
+        variant var = 42;
+        REQUIRE(var.try_get_value<int>() != nullptr);
+        CHECK(var.try_get_value<int>() == &var.get_value<int>());
+        CHECK(var.try_get_value<const int>() == &var.get_value<int>());
+        CHECK(var.try_get_value<double>() == nullptr);
+        CHECK(var.try_get_value<std::string>() == nullptr);
+
+        var = std::string("text");
+        REQUIRE(var.try_get_value<std::string>() != nullptr);
+        CHECK(*var.try_get_value<std::string>() == "text");
+        CHECK(var.try_get_value<int>() == nullptr);
+
+        var = std::vector<int>(100, 1);
+        REQUIRE(var.try_get_value<std::vector<int>>() != nullptr);
+        CHECK(var.try_get_value<std::vector<int>>()->size() == 100);
+    }
+
+    SECTION("invalid variant")
+    {
+        variant var;
+        CHECK(var.try_get_value<int>() == nullptr);
+
+        var = nullptr;
+        CHECK(var.try_get_value<std::nullptr_t>() != nullptr);
+        CHECK(var.try_get_value<int>() == nullptr);
+    }
+
+    SECTION("wrapped value")
+    {
+        int foo = 12;
+        variant var = std::ref(foo);
+        CHECK(var.try_get_value<int>() == &foo);
+        CHECK(var.try_get_value<std::reference_wrapper<int>>() != nullptr);
+        CHECK(var.try_get_value<double>() == nullptr);
+
+        int* bar = &foo;
+        var = std::ref(bar);
+        CHECK(var.try_get_value<int*>() == &bar);
+        CHECK(var.try_get_value<int>() == nullptr);
+
+        auto shared = std::make_shared<std::string>("text");
+        var = shared;
+        CHECK(var.try_get_value<std::string>() == shared.get());
+        CHECK(var.try_get_value<std::shared_ptr<std::string>>() != nullptr);
+
+        var = std::shared_ptr<std::string>();
+        CHECK(var.try_get_value<std::string>() == nullptr);
+
+        var = detail::make_unique<int>(24);
+        REQUIRE(var.try_get_value<int>() != nullptr);
+        CHECK(*var.try_get_value<int>() == 24);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 RTTR_BEGIN_DISABLE_DEPRECATED_WARNING
 
 TEST_CASE("variant - is_array", "[variant]")
@@ -32,6 +32,9 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <deque>
+#include <list>
+#include <array>
 
 using namespace rttr;
 using namespace std;
@@ -478,6 +481,72 @@ TEST_CASE("variant_sequential_view::set_size()", "[variant_sequential_view]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant_sequential_view::get_data_address()", "[variant_sequential_view]")
+{
+    SECTION("std::vector")
+    {
+        auto vec = std::vector<int>({ 1, 2, 3 });
+        variant var = std::ref(vec);
+        auto view = var.create_sequential_view();
+        CHECK(view.get_data_address() == vec.data());
+
+        CHECK(view.set_size(100) == true);
+        CHECK(view.get_data_address() == vec.data());
+    }
+
+    SECTION("std::array")
+    {
+        std::array<double, 3> obj = { 1.0, 2.0, 3.0 };
+        variant var = std::ref(obj);
+        auto view = var.create_sequential_view();
+        CHECK(view.get_data_address() == obj.data());
+    }
+
+    SECTION("raw array")
+    {
+        int obj[2] = { 0, 0 };
+        variant var = std::ref(obj);
+        auto view = var.create_sequential_view();
+        CHECK(view.get_data_address() == &obj[0]);
+    }
+
+    SECTION("empty std::vector")
+    {
+        variant var = std::vector<int>();
+        auto view = var.create_sequential_view();
+        CHECK(view.get_data_address() == nullptr);
+    }
+
+    SECTION("not contiguous")
+    {
+        variant var = std::vector<bool>({ true, false });
+        CHECK(var.create_sequential_view().get_data_address() == nullptr);
+
+        var = std::deque<int>({ 1, 2 });
+        CHECK(var.create_sequential_view().get_data_address() == nullptr);
+
+        var = std::list<int>({ 1, 2 });
+        CHECK(var.create_sequential_view().get_data_address() == nullptr);
+    }
+
+    SECTION("const std::vector")
+    {
+        auto vec = std::vector<int>({ 1, 2, 3, 4, 5 });
+        variant var = std::cref(vec);
+        auto view = var.create_sequential_view();
+        CHECK(view.get_data_address() == nullptr);
+    }
+
+    SECTION("invalid")
+    {
+        variant var = 1;
+        auto view = var.create_sequential_view();
+        CHECK(view.get_data_address() == nullptr);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant_sequential_view::insert()", "[variant_sequential_view]")
 {
     SECTION("std::vector")
@@ -886,6 +955,49 @@ TEST_CASE("variant_sequential_view::begin/end", "[variant_sequential_view]")
         }
     }
 
+    SECTION("std::deque")
+    {
+        variant var = std::deque<int>({ 1, 2, 3 });
+        auto view = var.create_sequential_view();
+
+        int i = 0;
+        for (auto itr = view.begin(); itr != view.end(); itr++)
+        {
+            CHECK(itr.get_data().to_int() == ++i);
+        }
+        CHECK(i == 3);
+
+        auto itr = view.begin();
+        auto itr_copy = itr++;
+        CHECK(itr_copy.get_data().to_int() == 1);
+        CHECK(itr.get_data().to_int() == 2);
+        CHECK((itr_copy + 2).get_data().to_int() == 3);
+        CHECK((itr - 1) == itr_copy);
+    }
+
+    SECTION("assign iterator of other view")
+    {
+        variant var_list = std::list<int>({ 1, 2, 3 });
+        variant var_deque = std::deque<int>({ 4, 5, 6 });
+        auto view_list = var_list.create_sequential_view();
+        auto view_deque = var_deque.create_sequential_view();
+
+        auto itr = view_list.begin();
+        CHECK(itr.get_data().to_int() == 1);
+
+        itr = view_deque.begin();
+        CHECK(itr.get_data().to_int() == 4);
+        ++itr;
+        CHECK(itr.get_data().to_int() == 5);
+
+        const auto& same_itr = itr;
+        itr = same_itr;
+        CHECK(itr.get_data().to_int() == 5);
+
+        itr = view_list.end();
+        CHECK(itr == view_list.end());
+    }
+
     SECTION("invalid test")
     {
         variant var;